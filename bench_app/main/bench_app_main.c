@@ -0,0 +1,19 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdlib.h>
+
+#include "unity.h"
+
+#include "bench_utils.h"
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+/* Runs only the benchmark cases; exits with the failure count */
+void app_main(void)
+{
+    UNITY_BEGIN();
+    unity_run_tests_by_tag(BENCH_TAG, false);
+    int failures = UNITY_END();
+
+    exit(failures);
+}
@@ -0,0 +1,228 @@
+#include "binary_counter_nb.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdlib.h>     // for malloc, free
+#include "string.h"     // for strncpy
+#include "esp_err.h"    // for ESP errors
+#include "gpio_bank.h"  // for GPIO bank API
+
+/* Logging */
+#include "esp_log.h"
+static const char *TAG = "Binary Counter NB";
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Binary Counter N-bit Handle */
+struct binary_counter_nb {
+    char name[BINARY_COUNTER_NB_NAME_LENGTH]; // Handle name
+
+    gpio_bank_handle_t bank;       // Output GPIO bank
+    uint8_t            value_mask; // (1 << num_bits) - 1
+    uint8_t            value;      // Current value
+};
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+//// CREATE & DELETE -----------------------------------------------------------
+
+#define CHECK_ERR_CREATE_ARGS(create_args)                                     \
+    if (!create_args) {                                                        \
+        ESP_LOGE(TAG, "Pointer to binary_counter_nb_create_args_t is NULL."); \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_HANDLE(out_handle)                                       \
+    if (!out_handle) {                                                         \
+        ESP_LOGE(TAG, "Pointer to binary_counter_nb_handle_t is NULL.");       \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_MALLOC(ptr)                                                  \
+    if (!ptr) {                                                                \
+        ESP_LOGE(TAG, "Could not allocate memory.");                           \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+#define CHECK_ERR_GPIO_BANK_CREATE(err, ptr)                                   \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not create GPIO bank: %s", esp_err_to_name(err)); \
+        free(ptr);                                                             \
+        return err;                                                            \
+    }
+
+#define CHECK_WARN_GPIO_BANK_DELETE(err)                                       \
+    if (err) {                                                                 \
+        ESP_LOGW(TAG, "Could not delete GPIO bank: %s", esp_err_to_name(err)); \
+    }
+
+//// ---------------------------------------------------------------------------
+
+//// HANDLE & OUT PARAM ERRORS -------------------------------------------------
+
+#define CHECK_ERR_HANDLE(handle)                                               \
+    if (!handle) {                                                             \
+        ESP_LOGE(TAG, "Binary counter handle is NULL.");                       \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_PARAM(out_param)                                         \
+    if (!out_param) {                                                          \
+        ESP_LOGE(TAG, "Pointer to out parameter is NULL.");                    \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+//// ---------------------------------------------------------------------------
+
+//// GPIO ERRORS ---------------------------------------------------------------
+
+#define CHECK_ERR_GPIO_BANK_WRITE(err)                                         \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not write GPIO bank: %s", esp_err_to_name(err));  \
+        return err;                                                            \
+    }
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+/* Set Value and GPIOs (value is kept unchanged if the write fails) */
+static esp_err_t _binary_counter_nb_set(
+    binary_counter_nb_handle_t const binary_counter ,
+    uint8_t                          value          )
+{
+    esp_err_t err = ESP_OK;
+
+    value &= binary_counter->value_mask;
+    err = gpio_bank_write(binary_counter->bank, value);
+    CHECK_ERR_GPIO_BANK_WRITE(err);
+
+    binary_counter->value = value;
+    return err;
+}
+
+// -----------------------------------------------------------------------------
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+//// Create & Delete -----------------------------------------------------------
+
+/* Create Binary Counter N-bit */
+esp_err_t binary_counter_nb_create(
+    binary_counter_nb_create_args_t const *create_args ,
+    binary_counter_nb_handle_t            *out_handle  )
+{
+    CHECK_ERR_CREATE_ARGS(create_args);
+    CHECK_ERR_OUT_HANDLE(out_handle);
+    esp_err_t err = ESP_OK;
+
+    // > Allocate Memory for Handle
+    struct binary_counter_nb *binary_counter =
+        malloc(sizeof(struct binary_counter_nb));
+    CHECK_ERR_MALLOC(binary_counter);
+
+    // > Create GPIO Bank
+    gpio_bank_create_args_t bank_args = { .num_gpio = create_args->num_bits };
+    for (int i = 0; i < create_args->num_bits && i < GPIO_BANK_MAX_GPIO; i++)
+        bank_args.gpio[i] = create_args->bit_gpio[i];
+    err = gpio_bank_create(&bank_args, &binary_counter->bank);
+    CHECK_ERR_GPIO_BANK_CREATE(err, binary_counter);
+
+    // > Set Handle
+    strncpy(
+        binary_counter->name           ,
+        create_args->name              ,
+        BINARY_COUNTER_NB_NAME_LENGTH );
+    binary_counter->value_mask = (uint8_t)((1U << create_args->num_bits) - 1);
+    binary_counter->value      = 0;
+
+    // > Set GPIOs to initial value
+    err = _binary_counter_nb_set(binary_counter, create_args->initial_value);
+    if (err) {
+        gpio_bank_delete(binary_counter->bank);
+        free(binary_counter);
+        return err;
+    }
+
+    *out_handle = binary_counter;
+    return err;
+}
+
+/* Delete Binary Counter N-bit */
+esp_err_t binary_counter_nb_delete(
+    binary_counter_nb_handle_t binary_counter )
+{
+    CHECK_ERR_HANDLE(binary_counter);
+    esp_err_t err = ESP_OK;
+
+    // > Delete GPIO Bank (resets GPIOs)
+    err = gpio_bank_delete(binary_counter->bank);
+    CHECK_WARN_GPIO_BANK_DELETE(err);
+
+    // > Free Memory
+    free(binary_counter);
+
+    return err;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Count ---------------------------------------------------------------------
+
+/* Increment */
+esp_err_t binary_counter_nb_increment(
+    binary_counter_nb_handle_t const binary_counter )
+{
+    CHECK_ERR_HANDLE(binary_counter);
+    return _binary_counter_nb_set(binary_counter, binary_counter->value + 1);
+}
+
+/* Decrement */
+esp_err_t binary_counter_nb_decrement(
+    binary_counter_nb_handle_t const binary_counter )
+{
+    CHECK_ERR_HANDLE(binary_counter);
+    return _binary_counter_nb_set(binary_counter, binary_counter->value - 1);
+}
+
+/* Reset */
+esp_err_t binary_counter_nb_reset(
+    binary_counter_nb_handle_t const binary_counter )
+{
+    CHECK_ERR_HANDLE(binary_counter);
+    return _binary_counter_nb_set(binary_counter, 0);
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Value ---------------------------------------------------------------------
+
+/* Set Value */
+esp_err_t binary_counter_nb_set_value(
+    binary_counter_nb_handle_t const binary_counter ,
+    uint8_t                          value          )
+{
+    CHECK_ERR_HANDLE(binary_counter);
+    return _binary_counter_nb_set(binary_counter, value);
+}
+
+/* Get Value */
+esp_err_t binary_counter_nb_get_value(
+    binary_counter_nb_handle_t const  binary_counter ,
+    uint8_t                          *out_value      )
+{
+    CHECK_ERR_HANDLE(binary_counter);
+    CHECK_ERR_OUT_PARAM(out_value);
+    *out_value = binary_counter->value;
+    return ESP_OK;
+}
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,91 @@
+#ifndef __BINARY_COUNTER_NB_H__
+#define __BINARY_COUNTER_NB_H__
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>      // uint8_t
+#include "esp_err.h"     // esp_err_t
+#include "driver/gpio.h" // gpio_num_t
+#include "gpio_bank.h"   // GPIO_BANK_MAX_GPIO
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define BINARY_COUNTER_NB_NAME_LENGTH 32
+#define BINARY_COUNTER_NB_MAX_BITS    GPIO_BANK_MAX_GPIO
+
+//// KCONFIG -------------------------------------------------------------------
+
+#define BINARY_COUNTER_NB_DEFAULT_NAME                /* "binary_counter_nb" */ \
+        CONFIG_BINARY_COUNTER_NB_DEFAULT_NAME
+#define BINARY_COUNTER_NB_DEFAULT_INITIAL_VALUE                         /* 0 */ \
+        CONFIG_BINARY_COUNTER_NB_DEFAULT_INITIAL_VALUE
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Binary Counter N-bit Handle */
+typedef struct binary_counter_nb *binary_counter_nb_handle_t;
+
+/* Binary Counter N-bit Create Args */
+typedef struct {
+    const char *name;          // Handle name
+    uint8_t     num_bits;      // Counter width (1..BINARY_COUNTER_NB_MAX_BITS)
+    uint8_t     initial_value; // Initial value (wrapped to num_bits)
+
+    gpio_num_t bit_gpio[BINARY_COUNTER_NB_MAX_BITS]; // GPIO per bit (LSB first)
+} binary_counter_nb_create_args_t;
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+/* Binary Counter N-bit Default Create Args (GPIOs must be set by the user) */
+#define BINARY_COUNTER_NB_DEFAULT_CREATE_ARGS() {                              \
+    .name          = BINARY_COUNTER_NB_DEFAULT_NAME,                           \
+    .num_bits      = 0,                                                        \
+    .bit_gpio      = { 0 },                                                    \
+    .initial_value = BINARY_COUNTER_NB_DEFAULT_INITIAL_VALUE                   \
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS -------------------------------------------------------------------
+
+/* Create & Delete */
+esp_err_t binary_counter_nb_create(
+    binary_counter_nb_create_args_t const *create_args ,
+    binary_counter_nb_handle_t            *out_handle );
+
+esp_err_t binary_counter_nb_delete(
+    binary_counter_nb_handle_t binary_counter );
+
+/* Count */
+/* Each update drives all bits at once (see gpio_bank_write), so the displayed
+ * value never goes through intermediate states.
+ */
+esp_err_t binary_counter_nb_increment(
+    binary_counter_nb_handle_t const binary_counter );
+
+esp_err_t binary_counter_nb_decrement(
+    binary_counter_nb_handle_t const binary_counter );
+
+esp_err_t binary_counter_nb_reset(
+    binary_counter_nb_handle_t const binary_counter );
+
+/* Value */
+esp_err_t binary_counter_nb_set_value(
+    binary_counter_nb_handle_t const binary_counter ,
+    uint8_t                          value          );
+
+esp_err_t binary_counter_nb_get_value(
+    binary_counter_nb_handle_t const  binary_counter ,
+    uint8_t                          *out_value      );
+
+// -----------------------------------------------------------------------------
+
+#endif // __BINARY_COUNTER_NB_H__
@@ -0,0 +1,45 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include "unity.h"
+
+#include "bench_utils.h"
+
+#include "util/multisampling.h"
+#include "util/storage.h"
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+static esp_err_t _read_constant(void *arg, int *value)
+{
+    *value = *(int *)arg;
+    return ESP_OK;
+}
+
+// BENCHMARKS ------------------------------------------------------------------
+
+TEST_CASE("multisampling of 32 samples", "[distance_sensor]" BENCH_TAG)
+{
+    multisampling_t ms;
+    int code = 2048;
+    int result;
+
+    TEST_ESP_OK(configure_multisampling(&ms, 32));
+    BENCH_RUN("distance_sensor do_multisampling x32", 100000, {
+        do_multisampling(&ms, _read_constant, &code, &result);
+        bench_sink(result);
+    });
+    delete_multisampling(&ms);
+}
+
+TEST_CASE("storage push with full queue", "[distance_sensor]" BENCH_TAG)
+{
+    storage_t storage;
+    distance_sensor_reading_t reading;
+
+    TEST_ESP_OK(configure_storage(&storage, 4));
+    BENCH_RUN("distance_sensor push_reading (drop oldest)", 100000, {
+        make_distance_sensor_reading(&reading, 2048, 1550, 120);
+        push_reading(&storage, &reading);
+    });
+    delete_storage(&storage);
+}
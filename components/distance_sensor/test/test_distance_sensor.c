@@ -0,0 +1,119 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include "unity.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "adc_mock.h"
+
+#include "distance_sensor.h"
+#include "util/multisampling.h"
+#include "util/storage.h"
+
+// STRUCTURES ------------------------------------------------------------------
+
+// The event base is defined by the application using the component
+ESP_EVENT_DEFINE_BASE(DISTANCE_SENSOR_EVENTS);
+
+typedef struct {
+    int next;
+    int calls;
+} sample_counter_t;
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+/* read_fn for do_multisampling: returns 1, 2, 3, ... */
+static esp_err_t _read_counting(void *arg, int *value)
+{
+    sample_counter_t *counter = arg;
+    counter->calls++;
+    *value = ++counter->next;
+    return ESP_OK;
+}
+
+static esp_err_t _read_failing(void *arg, int *value)
+{
+    (void)arg;
+    (void)value;
+    return ESP_FAIL;
+}
+
+// TESTS -----------------------------------------------------------------------
+
+TEST_CASE("multisampling averages samples_per_reading reads", "[distance_sensor]")
+{
+    multisampling_t ms;
+    sample_counter_t counter = { 0 };
+    int result = -1;
+
+    TEST_ESP_OK(configure_multisampling(&ms, 8));
+    TEST_ESP_OK(do_multisampling(&ms, _read_counting, &counter, &result));
+
+    TEST_ASSERT_EQUAL(8, counter.calls);
+    TEST_ASSERT_EQUAL((1 + 8) * 8 / 2 / 8, result);
+    delete_multisampling(&ms);
+}
+
+TEST_CASE("multisampling disabled reads once and forwards errors", "[distance_sensor]")
+{
+    multisampling_t ms;
+    sample_counter_t counter = { 0 };
+    int result = -1;
+
+    TEST_ESP_OK(configure_multisampling(&ms, 0));
+    TEST_ESP_OK(do_multisampling(&ms, _read_counting, &counter, &result));
+    TEST_ASSERT_EQUAL(1, counter.calls);
+    TEST_ASSERT_EQUAL(1, result);
+
+    TEST_ESP_ERR(ESP_FAIL, do_multisampling(&ms, _read_failing, NULL, &result));
+    delete_multisampling(&ms);
+}
+
+TEST_CASE("storage drops the oldest reading when full", "[distance_sensor]")
+{
+    storage_t storage;
+    distance_sensor_reading_t reading;
+
+    TEST_ESP_OK(configure_storage(&storage, 2));
+    for (int i = 1; i <= 3; i++) {
+        make_distance_sensor_reading(&reading, i, 0, 0);
+        TEST_ESP_OK(push_reading(&storage, &reading));
+    }
+
+    TEST_ESP_OK(pop_reading(&storage, &reading));
+    TEST_ASSERT_EQUAL(2, reading.adc_reading);
+    TEST_ESP_OK(pop_reading(&storage, &reading));
+    TEST_ASSERT_EQUAL(3, reading.adc_reading);
+    TEST_ESP_ERR(ESP_FAIL, pop_reading(&storage, &reading));
+    delete_storage(&storage);
+}
+
+TEST_CASE("sensor turns mocked ADC codes into readings", "[distance_sensor]")
+{
+    distance_sensor_create_args_t args = DISTANCE_SENSOR_CREATE_ARGS_DEFAULT();
+    distance_sensor_handle_t sensor = NULL;
+    distance_sensor_reading_t reading;
+
+    args.adc_input.gpio_num = GPIO_NUM_36;   // ADC1 channel 0
+    args.sampling_timer.period_ms = 10;
+    args.multisampling.samples_per_reading = 4;
+    args.storage.queue_size = 1;
+
+    adc_mock_reset();
+    adc_mock_set_raw(ADC_UNIT_1, ADC1_CHANNEL_0, 2048);
+
+    TEST_ESP_OK(distance_sensor_create(&args, &sensor));
+    TEST_ESP_OK(distance_sensor_start(sensor));
+    vTaskDelay(pdMS_TO_TICKS(100));
+    TEST_ESP_OK(distance_sensor_stop(sensor));
+
+    TEST_ESP_OK(distance_sensor_get_reading(sensor, &reading));
+    TEST_ASSERT_EQUAL(2048, reading.adc_reading);
+    TEST_ASSERT_INT_WITHIN(2, 1550, reading.voltage_mv);
+    TEST_ASSERT_GREATER_THAN(60, reading.distance_mm);
+    TEST_ASSERT_LESS_THAN(400, reading.distance_mm);
+    TEST_ASSERT_GREATER_OR_EQUAL(4, adc_mock_get_reads());
+
+    distance_sensor_delete(sensor);
+}
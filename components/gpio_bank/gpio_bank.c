@@ -0,0 +1,268 @@
+#include "gpio_bank.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdlib.h>         // for malloc, free
+#include "esp_err.h"        // for ESP errors
+#include "driver/gpio.h"    // for ESP GPIO driver
+#include "soc/soc.h"        // for REG_WRITE
+#include "soc/gpio_reg.h"   // for GPIO_OUT_W1TS_REG, GPIO_OUT_W1TC_REG
+#include "soc/soc_caps.h"   // for SOC_GPIO_PIN_COUNT
+
+/* Logging */
+#include "esp_log.h"
+static const char *TAG = "GPIO Bank";
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+/* Set masks are precomputed per nibble of the written value */
+#define GPIO_BANK_NIBBLES (GPIO_BANK_MAX_GPIO / 4)
+
+/* GPIOs 32 and above are driven through the OUT1 register block */
+#if SOC_GPIO_PIN_COUNT > 32
+#define GPIO_BANK_HAS_OUT1 1
+#else
+#define GPIO_BANK_HAS_OUT1 0
+#endif
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* GPIO Bank Handle */
+struct gpio_bank {
+    uint8_t    num_gpio;                 // Number of GPIOs in the bank
+    uint8_t    value_mask;               // Valid bits of a written value
+    gpio_num_t gpio[GPIO_BANK_MAX_GPIO]; // GPIO for each bit
+
+    /* Whole bank masks (used to clear the bits not being set) */
+    uint32_t bank_mask_lo; // GPIOs 0..31
+    uint32_t bank_mask_hi; // GPIOs 32..
+
+    /* Set masks for each nibble value of each nibble position */
+    uint32_t set_mask_lo[GPIO_BANK_NIBBLES][16];
+    uint32_t set_mask_hi[GPIO_BANK_NIBBLES][16];
+};
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+//// CREATE & DELETE -----------------------------------------------------------
+
+#define CHECK_ERR_CREATE_ARGS(create_args)                                     \
+    if (!create_args) {                                                        \
+        ESP_LOGE(TAG, "Pointer to gpio_bank_create_args_t is NULL.");          \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_HANDLE(out_handle)                                       \
+    if (!out_handle) {                                                         \
+        ESP_LOGE(TAG, "Pointer to gpio_bank_handle_t is NULL.");               \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_NUM_GPIO(num_gpio)                                           \
+    if (num_gpio == 0 || num_gpio > GPIO_BANK_MAX_GPIO) {                      \
+        ESP_LOGE(TAG, "Number of GPIOs must be between 1 and %d.",             \
+            GPIO_BANK_MAX_GPIO);                                               \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUTPUT_GPIO(gpio)                                            \
+    if (!GPIO_IS_VALID_OUTPUT_GPIO(gpio)) {                                    \
+        ESP_LOGE(TAG, "GPIO %d is not a valid output GPIO.", gpio);            \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_REPEATED_GPIO(mask, gpio)                                    \
+    if (mask & (1ULL << gpio)) {                                               \
+        ESP_LOGE(TAG, "Repeated GPIO %d.", gpio);                              \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_MALLOC(ptr)                                                  \
+    if (!ptr) {                                                                \
+        ESP_LOGE(TAG, "Could not allocate memory.");                           \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+#define CHECK_ERR_GPIO_CONFIG(err, ptr)                                        \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not configure GPIOs: %s", esp_err_to_name(err));  \
+        free(ptr);                                                             \
+        return err;                                                            \
+    }
+
+#define LOG_WARN_GPIO_RESET_PIN(err, gpio)                                     \
+    if (err)                                                                   \
+        ESP_LOGW(TAG, "Error resetting GPIO %d: %s",                           \
+            gpio, esp_err_to_name(err));
+
+//// ---------------------------------------------------------------------------
+
+//// HANDLE ERRORS -------------------------------------------------------------
+
+#define CHECK_ERR_HANDLE(handle)                                               \
+    if (!handle) {                                                             \
+        ESP_LOGE(TAG, "GPIO bank handle is NULL.");                            \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+/* Precompute Set Masks */
+static void _gpio_bank_precompute_masks(
+    struct gpio_bank *gpio_bank )
+{
+    gpio_bank->bank_mask_lo = 0;
+    gpio_bank->bank_mask_hi = 0;
+
+    for (int n = 0; n < GPIO_BANK_NIBBLES; n++) {
+        for (int v = 0; v < 16; v++) {
+            uint32_t lo = 0;
+            uint32_t hi = 0;
+
+            for (int b = 0; b < 4; b++) {
+                int bit = 4 * n + b;
+                if (bit >= gpio_bank->num_gpio || !(v & (1 << b))) continue;
+
+                gpio_num_t gpio = gpio_bank->gpio[bit];
+                if (gpio < 32) lo |= 1UL << gpio;
+                else           hi |= 1UL << (gpio - 32);
+            }
+
+            gpio_bank->set_mask_lo[n][v] = lo;
+            gpio_bank->set_mask_hi[n][v] = hi;
+        }
+
+        gpio_bank->bank_mask_lo |= gpio_bank->set_mask_lo[n][0x0F];
+        gpio_bank->bank_mask_hi |= gpio_bank->set_mask_hi[n][0x0F];
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+//// Create & Delete -----------------------------------------------------------
+
+/* Create GPIO Bank */
+esp_err_t gpio_bank_create(
+    gpio_bank_create_args_t const *create_args ,
+    gpio_bank_handle_t            *out_handle  )
+{
+    CHECK_ERR_CREATE_ARGS(create_args);
+    CHECK_ERR_OUT_HANDLE(out_handle);
+    CHECK_ERR_NUM_GPIO(create_args->num_gpio);
+    esp_err_t err = ESP_OK;
+
+    // > Check GPIOs
+    uint64_t pin_bit_mask = 0;
+    for (int i = 0; i < create_args->num_gpio; i++) {
+        CHECK_ERR_OUTPUT_GPIO(create_args->gpio[i]);
+        CHECK_ERR_REPEATED_GPIO(pin_bit_mask, create_args->gpio[i]);
+        pin_bit_mask |= 1ULL << create_args->gpio[i];
+    }
+
+    // > Allocate Memory for Handle
+    struct gpio_bank *gpio_bank = malloc(sizeof(struct gpio_bank));
+    CHECK_ERR_MALLOC(gpio_bank);
+
+    // > Configure GPIOs as outputs
+    gpio_config_t gpio_conf = {
+        .pin_bit_mask = pin_bit_mask          ,
+        .mode         = GPIO_MODE_OUTPUT      ,
+        .pull_up_en   = GPIO_PULLUP_DISABLE   ,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE ,
+        .intr_type    = GPIO_INTR_DISABLE   };
+    err = gpio_config(&gpio_conf);
+    CHECK_ERR_GPIO_CONFIG(err, gpio_bank);
+
+    // > Set Handle
+    gpio_bank->num_gpio   = create_args->num_gpio;
+    gpio_bank->value_mask = (uint8_t)((1U << create_args->num_gpio) - 1);
+    for (int i = 0; i < create_args->num_gpio; i++)
+        gpio_bank->gpio[i] = create_args->gpio[i];
+
+    // > Precompute Masks
+    _gpio_bank_precompute_masks(gpio_bank);
+
+    *out_handle = gpio_bank;
+    return err;
+}
+
+/* Delete GPIO Bank */
+esp_err_t gpio_bank_delete(
+    gpio_bank_handle_t gpio_bank )
+{
+    CHECK_ERR_HANDLE(gpio_bank);
+    esp_err_t err;
+    int err_count = 0;
+
+    // > Reset GPIOs
+    for (int i = 0; i < gpio_bank->num_gpio; i++) {
+        err = gpio_reset_pin(gpio_bank->gpio[i]);
+        if (err) err_count++;
+        LOG_WARN_GPIO_RESET_PIN(err, gpio_bank->gpio[i]);
+    }
+
+    // > Free Memory
+    free(gpio_bank);
+
+    return err_count ? ESP_FAIL : ESP_OK;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Write ---------------------------------------------------------------------
+
+/* Write Value */
+esp_err_t gpio_bank_write(
+    gpio_bank_handle_t const gpio_bank ,
+    uint8_t                  value     )
+{
+    CHECK_ERR_HANDLE(gpio_bank);
+
+    // > Lookup Set Masks
+    value &= gpio_bank->value_mask;
+    uint32_t set_lo = 0;
+    uint32_t set_hi = 0;
+    for (int n = 0; n < GPIO_BANK_NIBBLES; n++) {
+        set_lo |= gpio_bank->set_mask_lo[n][(value >> (4 * n)) & 0x0F];
+        set_hi |= gpio_bank->set_mask_hi[n][(value >> (4 * n)) & 0x0F];
+    }
+
+    // > Write Set & Clear Registers back to back
+    REG_WRITE(GPIO_OUT_W1TS_REG, set_lo);
+    REG_WRITE(GPIO_OUT_W1TC_REG, gpio_bank->bank_mask_lo & ~set_lo);
+#if GPIO_BANK_HAS_OUT1
+    if (gpio_bank->bank_mask_hi) {
+        REG_WRITE(GPIO_OUT1_W1TS_REG, set_hi);
+        REG_WRITE(GPIO_OUT1_W1TC_REG, gpio_bank->bank_mask_hi & ~set_hi);
+    }
+#else
+    (void) set_hi;
+#endif
+
+    return ESP_OK;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Info ----------------------------------------------------------------------
+
+/* Get Number of GPIOs */
+uint8_t gpio_bank_get_num_gpio(
+    gpio_bank_handle_t const gpio_bank )
+{ return gpio_bank ? gpio_bank->num_gpio : 0; }
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
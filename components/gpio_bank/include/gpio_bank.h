@@ -0,0 +1,59 @@
+#ifndef __GPIO_BANK_H__
+#define __GPIO_BANK_H__
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>      // uint8_t, uint32_t
+#include "esp_err.h"     // esp_err_t
+#include "driver/gpio.h" // gpio_num_t
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+/* Max number of GPIOs in a bank (bit i of the written value drives gpio[i]) */
+#define GPIO_BANK_MAX_GPIO 8
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* GPIO Bank Handle */
+typedef struct gpio_bank *gpio_bank_handle_t;
+
+/* GPIO Bank Create Args */
+typedef struct {
+    uint8_t    num_gpio;                 // Number of GPIOs in the bank
+    gpio_num_t gpio[GPIO_BANK_MAX_GPIO]; // GPIO for each bit (LSB first)
+} gpio_bank_create_args_t;
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS -------------------------------------------------------------------
+
+/* Create & Delete */
+/* The GPIOs are configured as outputs at creation and reset at deletion. */
+esp_err_t gpio_bank_create(
+    gpio_bank_create_args_t const *create_args ,
+    gpio_bank_handle_t            *out_handle );
+
+esp_err_t gpio_bank_delete(
+    gpio_bank_handle_t gpio_bank );
+
+/* Write */
+/* All bits of <value> are driven with one write to the W1TS register and one
+ * to the W1TC register (per 32-GPIO register block), using set masks that are
+ * precomputed at creation. No driver call is involved, so this is safe to use
+ * from time critical code paths. Bits above num_gpio are ignored.
+ */
+esp_err_t gpio_bank_write(
+    gpio_bank_handle_t const gpio_bank ,
+    uint8_t                  value     );
+
+/* Info */
+uint8_t gpio_bank_get_num_gpio(
+    gpio_bank_handle_t const gpio_bank );
+
+// -----------------------------------------------------------------------------
+
+#endif // __GPIO_BANK_H__
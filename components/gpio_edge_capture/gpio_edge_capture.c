@@ -0,0 +1,335 @@
+#include "gpio_edge_capture.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdlib.h>              // for malloc, calloc, free
+#include <stdbool.h>             // for bool
+#include "string.h"              // for strncpy
+#include "esp_err.h"             // for ESP errors
+#include "esp_attr.h"            // for IRAM_ATTR
+#include "esp_timer.h"           // for esp_timer_get_time
+#include "driver/gpio.h"         // for ESP GPIO driver
+#include "hal/gpio_ll.h"         // for gpio_ll_get_level (ISR safe)
+#include "soc/gpio_struct.h"     // for GPIO
+#include "freertos/FreeRTOS.h"   // for FreeRTOS
+#include "freertos/task.h"       // for TimeOut_t
+#include "freertos/semphr.h"     // for binary semaphore
+#include "gpio_edge_capture_debounce.h" // for reader side debounce
+
+/* Logging */
+#include "esp_log.h"
+static const char *TAG = "GPIO Edge Capture";
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* GPIO Edge Capture Handle */
+struct gpio_edge_capture {
+    char       name[GPIO_EDGE_CAPTURE_NAME_LENGTH]; // Handle name
+    gpio_num_t gpio;                                // Input GPIO
+
+    /* Raw edge ring (single producer: ISR, single consumer: reader) */
+    gpio_edge_capture_raw_t *ring;      // Ring buffer
+    uint32_t                 ring_mask; // queue_len - 1
+    uint32_t                 head;      // Written by ISR
+    uint32_t                 tail;      // Written by reader
+    uint32_t                 dropped;   // Written by ISR (ring full)
+    SemaphoreHandle_t        edge_sem;  // Given by ISR on each edge
+
+    /* Debounce state (reader only) */
+    gpio_edge_capture_debounce_t debounce;
+};
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+//// CREATE & DELETE -----------------------------------------------------------
+
+#define CHECK_ERR_CREATE_ARGS(create_args)                                     \
+    if (!create_args) {                                                        \
+        ESP_LOGE(TAG, "Pointer to gpio_edge_capture_create_args_t is NULL.");  \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_HANDLE(out_handle)                                       \
+    if (!out_handle) {                                                         \
+        ESP_LOGE(TAG, "Pointer to gpio_edge_capture_handle_t is NULL.");       \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_INPUT_GPIO(gpio)                                             \
+    if (!GPIO_IS_VALID_GPIO(gpio)) {                                           \
+        ESP_LOGE(TAG, "GPIO %d is not a valid input GPIO.", gpio);             \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_QUEUE_LEN(queue_len)                                         \
+    if (queue_len < 2 || (queue_len & (queue_len - 1))) {                      \
+        ESP_LOGE(TAG, "Queue length must be a power of 2 (at least 2).");      \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_MALLOC(ptr, edge_capture)                                    \
+    if (!ptr) {                                                                \
+        ESP_LOGE(TAG, "Could not allocate memory.");                           \
+        _gpio_edge_capture_free(edge_capture);                                 \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+#define CHECK_ERR_GPIO_CONFIG(err, edge_capture)                               \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not configure GPIO: %s", esp_err_to_name(err));   \
+        _gpio_edge_capture_free(edge_capture);                                 \
+        return err;                                                            \
+    }
+
+#define CHECK_ERR_ISR_SERVICE(err, edge_capture)                               \
+    if (err && err != ESP_ERR_INVALID_STATE) {                                 \
+        ESP_LOGE(TAG, "Could not install GPIO ISR service: %s",                \
+            esp_err_to_name(err));                                             \
+        _gpio_edge_capture_free(edge_capture);                                 \
+        return err;                                                            \
+    }
+
+#define CHECK_ERR_ISR_HANDLER_ADD(err, edge_capture)                           \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not add GPIO ISR handler: %s",                    \
+            esp_err_to_name(err));                                             \
+        gpio_reset_pin(edge_capture->gpio);                                    \
+        _gpio_edge_capture_free(edge_capture);                                 \
+        return err;                                                            \
+    }
+
+#define LOG_WARN_ISR_HANDLER_REMOVE(err)                                       \
+    if (err)                                                                   \
+        ESP_LOGW(TAG, "Error removing GPIO ISR handler: %s",                   \
+            esp_err_to_name(err));
+
+//// ---------------------------------------------------------------------------
+
+//// HANDLE & OUT PARAM ERRORS -------------------------------------------------
+
+#define CHECK_ERR_HANDLE(handle)                                               \
+    if (!handle) {                                                             \
+        ESP_LOGE(TAG, "GPIO edge capture handle is NULL.");                    \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_PARAM(out_param)                                         \
+    if (!out_param) {                                                          \
+        ESP_LOGE(TAG, "Pointer to out parameter is NULL.");                    \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+/* Free Handle Resources */
+static void _gpio_edge_capture_free(
+    struct gpio_edge_capture *edge_capture )
+{
+    if (edge_capture->edge_sem) vSemaphoreDelete(edge_capture->edge_sem);
+    free(edge_capture->ring);
+    free(edge_capture);
+}
+
+/* GPIO ISR Handler */
+/* Timestamp, level, ring push and semaphore give: nothing else. */
+static void IRAM_ATTR _gpio_edge_capture_isr_handler(
+    void *arg )
+{
+    struct gpio_edge_capture *edge_capture = arg;
+
+    int64_t  timestamp = esp_timer_get_time();
+    int      level     = gpio_ll_get_level(&GPIO, edge_capture->gpio);
+    uint32_t head      = edge_capture->head;
+    uint32_t tail      = __atomic_load_n(&edge_capture->tail, __ATOMIC_ACQUIRE);
+
+    // > Push Raw Edge (drop it if the ring is full)
+    if (head - tail <= edge_capture->ring_mask) {
+        gpio_edge_capture_raw_t *raw =
+            &edge_capture->ring[head & edge_capture->ring_mask];
+        raw->timestamp = timestamp;
+        raw->level     = level;
+        __atomic_store_n(&edge_capture->head, head + 1, __ATOMIC_RELEASE);
+    } else {
+        edge_capture->dropped++;
+    }
+
+    // > Wake Reader
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    xSemaphoreGiveFromISR(edge_capture->edge_sem, &higher_priority_task_woken);
+    if (higher_priority_task_woken) portYIELD_FROM_ISR();
+}
+
+/* Pop Raw Edge (false if the ring is empty) */
+static bool _gpio_edge_capture_pop(
+    struct gpio_edge_capture *edge_capture ,
+    gpio_edge_capture_raw_t  *out_raw      )
+{
+    uint32_t tail = edge_capture->tail;
+    uint32_t head = __atomic_load_n(&edge_capture->head, __ATOMIC_ACQUIRE);
+    if (tail == head) return false;
+
+    *out_raw = edge_capture->ring[tail & edge_capture->ring_mask];
+    __atomic_store_n(&edge_capture->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+//// Create & Delete -----------------------------------------------------------
+
+/* Create GPIO Edge Capture */
+esp_err_t gpio_edge_capture_create(
+    gpio_edge_capture_create_args_t const *create_args ,
+    gpio_edge_capture_handle_t            *out_handle  )
+{
+    CHECK_ERR_CREATE_ARGS(create_args);
+    CHECK_ERR_OUT_HANDLE(out_handle);
+    CHECK_ERR_INPUT_GPIO(create_args->gpio);
+    CHECK_ERR_QUEUE_LEN(create_args->queue_len);
+    esp_err_t err = ESP_OK;
+
+    // > Allocate Memory for Handle, Ring & Semaphore
+    struct gpio_edge_capture *edge_capture =
+        calloc(1, sizeof(struct gpio_edge_capture));
+    if (!edge_capture) {
+        ESP_LOGE(TAG, "Could not allocate memory.");
+        return ESP_ERR_NO_MEM;
+    }
+
+    edge_capture->ring =
+        calloc(create_args->queue_len, sizeof(gpio_edge_capture_raw_t));
+    CHECK_ERR_MALLOC(edge_capture->ring, edge_capture);
+
+    edge_capture->edge_sem = xSemaphoreCreateBinary();
+    CHECK_ERR_MALLOC(edge_capture->edge_sem, edge_capture);
+
+    // > Set Handle
+    strncpy(
+        edge_capture->name              ,
+        create_args->name               ,
+        GPIO_EDGE_CAPTURE_NAME_LENGTH );
+    edge_capture->gpio                 = create_args->gpio;
+    edge_capture->ring_mask            = create_args->queue_len - 1;
+    edge_capture->debounce.debounce_us = create_args->debounce_us;
+
+    // > Configure GPIO as input interrupting on any edge
+    gpio_config_t gpio_conf = {
+        .pin_bit_mask = 1ULL << create_args->gpio ,
+        .mode         = GPIO_MODE_INPUT           ,
+        .pull_up_en   = GPIO_PULLUP_DISABLE       ,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE     ,
+        .intr_type    = GPIO_INTR_ANYEDGE       };
+    err = gpio_config(&gpio_conf);
+    CHECK_ERR_GPIO_CONFIG(err, edge_capture);
+
+    err = gpio_set_pull_mode(create_args->gpio, create_args->pull_mode);
+    CHECK_ERR_GPIO_CONFIG(err, edge_capture);
+
+    // > Initial Level
+    edge_capture->debounce.level       = gpio_get_level(create_args->gpio);
+    edge_capture->debounce.level_since = esp_timer_get_time();
+
+    // > Install ISR Service (may be already installed) & Add Handler
+    err = gpio_install_isr_service(0);
+    CHECK_ERR_ISR_SERVICE(err, edge_capture);
+
+    err = gpio_isr_handler_add(
+        create_args->gpio              ,
+        _gpio_edge_capture_isr_handler ,
+        edge_capture                   );
+    CHECK_ERR_ISR_HANDLER_ADD(err, edge_capture);
+
+    *out_handle = edge_capture;
+    return ESP_OK;
+}
+
+/* Delete GPIO Edge Capture */
+esp_err_t gpio_edge_capture_delete(
+    gpio_edge_capture_handle_t edge_capture )
+{
+    CHECK_ERR_HANDLE(edge_capture);
+    esp_err_t err = ESP_OK;
+
+    // > Remove ISR Handler & Reset GPIO
+    err = gpio_isr_handler_remove(edge_capture->gpio);
+    LOG_WARN_ISR_HANDLER_REMOVE(err);
+    gpio_reset_pin(edge_capture->gpio);
+
+    // > Free Memory
+    _gpio_edge_capture_free(edge_capture);
+
+    return err;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Events --------------------------------------------------------------------
+
+/* Get Edge Event */
+esp_err_t gpio_edge_capture_get_event(
+    gpio_edge_capture_handle_t const  edge_capture ,
+    gpio_edge_capture_event_t        *out_event    ,
+    TickType_t                        ticks_to_wait )
+{
+    CHECK_ERR_HANDLE(edge_capture);
+    CHECK_ERR_OUT_PARAM(out_event);
+
+    TimeOut_t timeout;
+    vTaskSetTimeOutState(&timeout);
+
+    while (1) {
+        // > Debounce Buffered Raw Edges
+        gpio_edge_capture_raw_t raw;
+        while (_gpio_edge_capture_pop(edge_capture, &raw))
+            if (_gpio_edge_capture_debounce_edge(&edge_capture->debounce, &raw,
+                    edge_capture->dropped, out_event))
+                return ESP_OK;
+
+        // > Commit Candidate if it has been stable for the debounce time
+        int64_t left_us;
+        if (_gpio_edge_capture_debounce_time(&edge_capture->debounce,
+                esp_timer_get_time(), edge_capture->dropped, out_event, &left_us))
+            return ESP_OK;
+
+        TickType_t wait = ticks_to_wait;
+        if (left_us > 0) {
+            TickType_t left = pdMS_TO_TICKS((uint32_t)((left_us + 999) / 1000)) + 1;
+            if (left < wait) wait = left;
+        }
+
+        // > Wait for Raw Edges (or Candidate Deadline)
+        if (xTaskCheckForTimeOut(&timeout, &ticks_to_wait) == pdTRUE)
+            return ESP_ERR_TIMEOUT;
+        if (ticks_to_wait < wait) wait = ticks_to_wait;
+        xSemaphoreTake(edge_capture->edge_sem, wait);
+    }
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Level ---------------------------------------------------------------------
+
+/* Get Reported Level */
+esp_err_t gpio_edge_capture_get_level(
+    gpio_edge_capture_handle_t const  edge_capture ,
+    int                              *out_level    )
+{
+    CHECK_ERR_HANDLE(edge_capture);
+    CHECK_ERR_OUT_PARAM(out_level);
+    *out_level = edge_capture->debounce.level;
+    return ESP_OK;
+}
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
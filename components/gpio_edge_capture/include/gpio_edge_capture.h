@@ -0,0 +1,107 @@
+#ifndef __GPIO_EDGE_CAPTURE_H__
+#define __GPIO_EDGE_CAPTURE_H__
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>             // int64_t, uint32_t
+#include "esp_err.h"            // esp_err_t
+#include "driver/gpio.h"        // gpio_num_t, gpio_pull_mode_t
+#include "freertos/FreeRTOS.h"  // TickType_t
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define GPIO_EDGE_CAPTURE_NAME_LENGTH 32
+
+//// KCONFIG -------------------------------------------------------------------
+
+#define GPIO_EDGE_CAPTURE_DEFAULT_NAME                /* "gpio_edge_capture" */ \
+        CONFIG_GPIO_EDGE_CAPTURE_DEFAULT_NAME
+#define GPIO_EDGE_CAPTURE_DEFAULT_QUEUE_LEN                            /* 32 */ \
+        CONFIG_GPIO_EDGE_CAPTURE_DEFAULT_QUEUE_LEN
+#define GPIO_EDGE_CAPTURE_DEFAULT_DEBOUNCE_US                        /* 1000 */ \
+        CONFIG_GPIO_EDGE_CAPTURE_DEFAULT_DEBOUNCE_US
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* GPIO Edge Capture Handle */
+typedef struct gpio_edge_capture *gpio_edge_capture_handle_t;
+
+/* GPIO Edge Capture Create Args */
+typedef struct {
+    const char      *name;        // Handle name
+    gpio_num_t       gpio;        // Input GPIO
+    gpio_pull_mode_t pull_mode;   // Input pull mode
+    uint32_t         queue_len;   // Raw edges buffered (power of 2)
+    uint32_t         debounce_us; // Min stable time of a reported level
+} gpio_edge_capture_create_args_t;
+
+/* GPIO Edge Type */
+typedef enum {
+    GPIO_EDGE_CAPTURE_FALLING = 0, // New level is 0
+    GPIO_EDGE_CAPTURE_RISING  = 1  // New level is 1
+} gpio_edge_capture_edge_t;
+
+/* GPIO Edge Event */
+typedef struct {
+    gpio_edge_capture_edge_t edge;         // Edge type
+    int64_t                  timestamp_us; // esp_timer time of the edge
+    int64_t                  width_us;     // Time the previous level lasted
+    uint32_t                 dropped;      // Raw edges lost since last event
+} gpio_edge_capture_event_t;
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+/* GPIO Edge Capture Default Create Args (GPIO must be set by the user) */
+#define GPIO_EDGE_CAPTURE_DEFAULT_CREATE_ARGS() {                              \
+    .name        = GPIO_EDGE_CAPTURE_DEFAULT_NAME,                             \
+    .gpio        = GPIO_NUM_NC,                                                \
+    .pull_mode   = GPIO_FLOATING,                                              \
+    .queue_len   = GPIO_EDGE_CAPTURE_DEFAULT_QUEUE_LEN,                        \
+    .debounce_us = GPIO_EDGE_CAPTURE_DEFAULT_DEBOUNCE_US                       \
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS -------------------------------------------------------------------
+
+/* Create & Delete */
+/* The GPIO is configured as an input interrupting on any edge. The GPIO ISR
+ * service is installed if needed, and left installed at deletion since other
+ * drivers may share it.
+ */
+esp_err_t gpio_edge_capture_create(
+    gpio_edge_capture_create_args_t const *create_args ,
+    gpio_edge_capture_handle_t            *out_handle  );
+
+esp_err_t gpio_edge_capture_delete(
+    gpio_edge_capture_handle_t edge_capture );
+
+/* Events */
+/* The ISR only timestamps each raw edge into a ring buffer, so nothing runs
+ * while the input is idle. Debounce is applied here, in the reader: a level
+ * change is reported once the input has been stable for debounce_us, with the
+ * timestamp of the first edge of the burst. Returns ESP_ERR_TIMEOUT if no
+ * event is available within <ticks_to_wait>. Only one task may read events.
+ */
+esp_err_t gpio_edge_capture_get_event(
+    gpio_edge_capture_handle_t const  edge_capture ,
+    gpio_edge_capture_event_t        *out_event    ,
+    TickType_t                        ticks_to_wait );
+
+/* Level */
+/* Last reported (debounced) level. */
+esp_err_t gpio_edge_capture_get_level(
+    gpio_edge_capture_handle_t const  edge_capture ,
+    int                              *out_level    );
+
+// -----------------------------------------------------------------------------
+
+#endif // __GPIO_EDGE_CAPTURE_H__
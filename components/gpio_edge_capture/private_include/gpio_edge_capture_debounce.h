@@ -0,0 +1,111 @@
+#ifndef __GPIO_EDGE_CAPTURE_DEBOUNCE_H__
+#define __GPIO_EDGE_CAPTURE_DEBOUNCE_H__
+
+// Reader side debounce of the raw edges captured by the ISR. Private to
+// gpio_edge_capture; its tests include it to feed synthetic timestamps.
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>            // int64_t, uint32_t
+#include <stdbool.h>           // bool
+#include "gpio_edge_capture.h" // gpio_edge_capture_event_t
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Raw Edge (as captured by the ISR) */
+typedef struct {
+    int64_t timestamp; // esp_timer time
+    int     level;     // Input level right after the edge
+} gpio_edge_capture_raw_t;
+
+/* Debounce State */
+typedef struct {
+    uint32_t                debounce_us;   // Min stable time
+    int                     level;         // Reported level
+    int64_t                 level_since;   // Time of last reported edge
+    bool                    has_candidate; // Level change not yet stable
+    gpio_edge_capture_raw_t candidate;     // Last raw edge of the burst
+    int64_t                 burst_start;   // First raw edge of the burst
+    uint32_t                dropped_seen;  // Dropped edges already reported
+} gpio_edge_capture_debounce_t;
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS -------------------------------------------------------------------
+
+/* Commit Stable Candidate (true if it changes the reported level) */
+/* <dropped> is the ISR count of raw edges lost so far. */
+static inline bool _gpio_edge_capture_debounce_commit(
+    gpio_edge_capture_debounce_t *debounce  ,
+    uint32_t                      dropped   ,
+    gpio_edge_capture_event_t    *out_event )
+{
+    int level = debounce->candidate.level;
+    if (level == debounce->level) return false; // Glitch, back to level
+
+    out_event->edge         = level ? GPIO_EDGE_CAPTURE_RISING
+                                    : GPIO_EDGE_CAPTURE_FALLING;
+    out_event->timestamp_us = debounce->burst_start;
+    out_event->width_us     = debounce->burst_start - debounce->level_since;
+    out_event->dropped      = dropped - debounce->dropped_seen;
+
+    debounce->level        = level;
+    debounce->level_since  = debounce->burst_start;
+    debounce->dropped_seen = dropped;
+    return true;
+}
+
+/* Debounce Raw Edge (true if the previous candidate is reported) */
+/* A raw edge coming at least debounce_us after the candidate proves the
+ * candidate stable. Either way the raw edge is the new candidate, and starts
+ * a new burst unless it bounces within the current one.
+ */
+static inline bool _gpio_edge_capture_debounce_edge(
+    gpio_edge_capture_debounce_t  *debounce  ,
+    gpio_edge_capture_raw_t const *raw       ,
+    uint32_t                       dropped   ,
+    gpio_edge_capture_event_t     *out_event )
+{
+    bool stable = debounce->has_candidate
+        && raw->timestamp - debounce->candidate.timestamp
+           >= debounce->debounce_us;
+    bool report = stable
+        && _gpio_edge_capture_debounce_commit(debounce, dropped, out_event);
+
+    if (!debounce->has_candidate || stable)
+        debounce->burst_start = raw->timestamp;
+    debounce->candidate     = *raw;
+    debounce->has_candidate = true;
+    return report;
+}
+
+/* Debounce Time (true if the candidate is reported) */
+/* Once no raw edge follows the candidate for debounce_us (at <now_us>), it is
+ * committed. Otherwise <out_left_us> is the time left (0 if no candidate).
+ */
+static inline bool _gpio_edge_capture_debounce_time(
+    gpio_edge_capture_debounce_t *debounce    ,
+    int64_t                       now_us      ,
+    uint32_t                      dropped     ,
+    gpio_edge_capture_event_t    *out_event   ,
+    int64_t                      *out_left_us )
+{
+    *out_left_us = 0;
+    if (!debounce->has_candidate) return false;
+
+    int64_t left_us = debounce->candidate.timestamp + debounce->debounce_us
+                    - now_us;
+    if (left_us > 0) {
+        *out_left_us = left_us;
+        return false;
+    }
+
+    debounce->has_candidate = false;
+    return _gpio_edge_capture_debounce_commit(debounce, dropped, out_event);
+}
+
+// -----------------------------------------------------------------------------
+
+#endif // __GPIO_EDGE_CAPTURE_DEBOUNCE_H__
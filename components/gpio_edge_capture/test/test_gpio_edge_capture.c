@@ -0,0 +1,197 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include "unity.h"
+
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+
+#include "gpio_mock.h"
+
+#include "gpio_edge_capture.h"
+#include "gpio_edge_capture_debounce.h"
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define INPUT_GPIO  GPIO_NUM_4
+#define QUEUE_LEN   4    // Raw edges buffered
+#define DEBOUNCE_US 1000 // Min stable time
+#define STABLE_US   2000 // Spacing of the stable edges (over DEBOUNCE_US)
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+static gpio_edge_capture_handle_t _create(void)
+{
+    gpio_edge_capture_create_args_t args = GPIO_EDGE_CAPTURE_DEFAULT_CREATE_ARGS();
+    args.gpio        = INPUT_GPIO;
+    args.queue_len   = QUEUE_LEN;
+    args.debounce_us = DEBOUNCE_US;
+
+    gpio_edge_capture_handle_t edge_capture = NULL;
+    gpio_mock_reset();
+    TEST_ESP_OK(gpio_edge_capture_create(&args, &edge_capture));
+    return edge_capture;
+}
+
+/* Busy wait (shorter than a tick) */
+static void _spin_us(int64_t us)
+{
+    int64_t end = esp_timer_get_time() + us;
+    while (esp_timer_get_time() < end) { }
+}
+
+/* Debounce state at level 0 since time 0 */
+static gpio_edge_capture_debounce_t _debounce(void)
+{
+    return (gpio_edge_capture_debounce_t) {
+        .debounce_us = DEBOUNCE_US,
+        .level       = 0,
+        .level_since = 0 };
+}
+
+/* Feed a synthetic raw edge (true if it reports an event) */
+static bool _edge(
+    gpio_edge_capture_debounce_t *debounce  ,
+    int64_t                       timestamp ,
+    int                           level     ,
+    uint32_t                      dropped   ,
+    gpio_edge_capture_event_t    *out_event )
+{
+    gpio_edge_capture_raw_t raw = { .timestamp = timestamp, .level = level };
+    return _gpio_edge_capture_debounce_edge(debounce, &raw, dropped, out_event);
+}
+
+// TESTS -----------------------------------------------------------------------
+
+TEST_CASE("a bouncing edge is reported once stable, at the start of the burst", "[gpio_edge_capture]")
+{
+    gpio_edge_capture_debounce_t debounce = _debounce();
+    gpio_edge_capture_event_t    event;
+    int64_t                      left_us;
+
+    // > Bounces closer than the debounce time: one burst
+    TEST_ASSERT_FALSE(_edge(&debounce, 10000, 1, 0, &event));
+    TEST_ASSERT_FALSE(_edge(&debounce, 10100, 0, 0, &event));
+    TEST_ASSERT_FALSE(_edge(&debounce, 10250, 1, 0, &event));
+
+    // > Not stable yet: the window runs from the last bounce
+    TEST_ASSERT_FALSE(_gpio_edge_capture_debounce_time(
+        &debounce, 11000, 0, &event, &left_us));
+    TEST_ASSERT_TRUE(left_us == 250);
+
+    // > Stable: rising edge at the first bounce
+    TEST_ASSERT_TRUE(_gpio_edge_capture_debounce_time(
+        &debounce, 11250, 0, &event, &left_us));
+    TEST_ASSERT_EQUAL(GPIO_EDGE_CAPTURE_RISING, event.edge);
+    TEST_ASSERT_TRUE(event.timestamp_us == 10000);
+    TEST_ASSERT_TRUE(event.width_us == 10000);
+    TEST_ASSERT_EQUAL_UINT32(0, event.dropped);
+    TEST_ASSERT_EQUAL(1, debounce.level);
+
+    // > Nothing left to report
+    TEST_ASSERT_FALSE(_gpio_edge_capture_debounce_time(
+        &debounce, 12000, 0, &event, &left_us));
+    TEST_ASSERT_TRUE(left_us == 0);
+}
+
+TEST_CASE("a glitch back to the reported level is not reported", "[gpio_edge_capture]")
+{
+    gpio_edge_capture_debounce_t debounce = _debounce();
+    gpio_edge_capture_event_t    event;
+    int64_t                      left_us;
+
+    TEST_ASSERT_FALSE(_edge(&debounce, 10000, 1, 0, &event));
+    TEST_ASSERT_FALSE(_edge(&debounce, 10300, 0, 0, &event));
+    TEST_ASSERT_FALSE(_gpio_edge_capture_debounce_time(
+        &debounce, 11300, 0, &event, &left_us));
+    TEST_ASSERT_TRUE(left_us == 0);
+    TEST_ASSERT_EQUAL(0, debounce.level);
+
+    // > The next change is measured from the last reported edge
+    TEST_ASSERT_FALSE(_edge(&debounce, 20000, 1, 0, &event));
+    TEST_ASSERT_TRUE(_gpio_edge_capture_debounce_time(
+        &debounce, 21000, 0, &event, &left_us));
+    TEST_ASSERT_TRUE(event.timestamp_us == 20000);
+    TEST_ASSERT_TRUE(event.width_us == 20000);
+}
+
+TEST_CASE("a raw edge after the debounce time reports the previous one", "[gpio_edge_capture]")
+{
+    gpio_edge_capture_debounce_t debounce = _debounce();
+    gpio_edge_capture_event_t    event;
+    int64_t                      left_us;
+
+    // > Exactly the debounce time apart: the first edge is stable
+    TEST_ASSERT_FALSE(_edge(&debounce, 10000, 1, 0, &event));
+    TEST_ASSERT_TRUE(_edge(&debounce, 10000 + DEBOUNCE_US, 0, 0, &event));
+    TEST_ASSERT_EQUAL(GPIO_EDGE_CAPTURE_RISING, event.edge);
+    TEST_ASSERT_TRUE(event.timestamp_us == 10000);
+
+    // > The new edge starts its own burst
+    TEST_ASSERT_FALSE(_edge(&debounce, 11500, 1, 0, &event));
+    TEST_ASSERT_FALSE(_edge(&debounce, 11600, 0, 0, &event));
+    TEST_ASSERT_TRUE(_gpio_edge_capture_debounce_time(
+        &debounce, 12600, 0, &event, &left_us));
+    TEST_ASSERT_EQUAL(GPIO_EDGE_CAPTURE_FALLING, event.edge);
+    TEST_ASSERT_TRUE(event.timestamp_us == 10000 + DEBOUNCE_US);
+    TEST_ASSERT_TRUE(event.width_us == DEBOUNCE_US);
+}
+
+TEST_CASE("dropped edges are reported once, with the next event", "[gpio_edge_capture]")
+{
+    gpio_edge_capture_debounce_t debounce = _debounce();
+    gpio_edge_capture_event_t    event;
+
+    TEST_ASSERT_FALSE(_edge(&debounce, 10000, 1, 0, &event));
+    TEST_ASSERT_TRUE(_edge(&debounce, 20000, 0, 3, &event));
+    TEST_ASSERT_EQUAL_UINT32(3, event.dropped);
+    TEST_ASSERT_TRUE(_edge(&debounce, 30000, 1, 3, &event));
+    TEST_ASSERT_EQUAL_UINT32(0, event.dropped);
+    TEST_ASSERT_TRUE(_edge(&debounce, 40000, 0, 5, &event));
+    TEST_ASSERT_EQUAL_UINT32(2, event.dropped);
+}
+
+TEST_CASE("raw edges beyond a full ring are dropped and counted", "[gpio_edge_capture]")
+{
+    gpio_edge_capture_handle_t edge_capture = _create();
+    gpio_edge_capture_event_t  event;
+    int                        level;
+
+    // > Fill the ring with stable edges, nobody reading
+    for (int i = 0; i < QUEUE_LEN; i++) {
+        gpio_mock_set_input(INPUT_GPIO, (i + 1) % 2);
+        _spin_us(STABLE_US);
+    }
+
+    // > Ring full: these are lost
+    gpio_mock_set_input(INPUT_GPIO, 1);
+    gpio_mock_set_input(INPUT_GPIO, 0);
+    gpio_mock_set_input(INPUT_GPIO, 1);
+
+    // > Buffered edges still reported, the first one with the dropped count
+    int64_t prev_us = 0;
+    for (int i = 0; i < QUEUE_LEN; i++) {
+        TEST_ESP_OK(gpio_edge_capture_get_event(edge_capture, &event,
+            pdMS_TO_TICKS(100)));
+        TEST_ASSERT_EQUAL(i % 2 ? GPIO_EDGE_CAPTURE_FALLING
+                                : GPIO_EDGE_CAPTURE_RISING, event.edge);
+        TEST_ASSERT_EQUAL_UINT32(i ? 0 : 3, event.dropped);
+        if (i) TEST_ASSERT_TRUE(event.timestamp_us - prev_us >= STABLE_US);
+        prev_us = event.timestamp_us;
+    }
+
+    // > Nothing else: the lost edges leave the reported level behind
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, gpio_edge_capture_get_event(
+        edge_capture, &event, pdMS_TO_TICKS(20)));
+    TEST_ESP_OK(gpio_edge_capture_get_level(edge_capture, &level));
+    TEST_ASSERT_EQUAL(0, level);
+
+    // > The ring takes edges again
+    gpio_mock_set_input(INPUT_GPIO, 0);
+    gpio_mock_set_input(INPUT_GPIO, 1);
+    TEST_ESP_OK(gpio_edge_capture_get_event(edge_capture, &event,
+        pdMS_TO_TICKS(100)));
+    TEST_ASSERT_EQUAL(GPIO_EDGE_CAPTURE_RISING, event.edge);
+    TEST_ASSERT_EQUAL_UINT32(0, event.dropped);
+
+    TEST_ESP_OK(gpio_edge_capture_delete(edge_capture));
+}
@@ -0,0 +1,759 @@
+#include "i2c_bus.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdlib.h>              // for calloc, free
+#include "string.h"              // for strncpy, memset
+#include "esp_err.h"             // for ESP errors
+#include "esp_timer.h"           // for esp_timer_get_time
+#include "freertos/FreeRTOS.h"   // for FreeRTOS
+#include "freertos/task.h"       // for bus task & notifications
+#include "freertos/queue.h"      // for priority queues
+#include "freertos/semphr.h"     // for device lock & completion
+#include "i2c_bus_sim.h"         // for simulated targets
+
+/* Logging */
+#include "esp_log.h"
+static const char *TAG = "I2C Bus";
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* I2C Bus Device */
+struct i2c_bus_device {
+    char             name[I2C_BUS_DEVICE_NAME_LENGTH]; // Device name
+    uint8_t          address;                          // 7 bit address
+    i2c_bus_handle_t bus;                              // Owning bus
+    int8_t           mux;                              // Mux index (-1: none)
+    uint8_t          mux_mask;                         // Channel control byte
+
+    SemaphoreHandle_t lock; // One transaction in flight per device
+    SemaphoreHandle_t done; // Given by the bus task on completion
+
+    /* Transaction in flight (owned by the bus task while queued) */
+    i2c_bus_transaction_t const *txn;       // Submitted transaction
+    esp_err_t                    err;       // Result
+    int64_t                      submit_us; // Submit time
+    int64_t                      ready_us;  // Due time of a delayed read
+    int64_t                      busy_us;   // Bus time so far
+    struct i2c_bus_device       *next;      // Next in the deferred list
+
+    i2c_bus_device_stats_t stats; // Updated by the bus task
+};
+
+/* I2C Bus */
+struct i2c_bus {
+    char       name[I2C_BUS_NAME_LENGTH]; // Handle name
+    i2c_port_t i2c_port;                  // Owned port
+    bool       uninstall_at_delete;       // Driver installed by the bus
+
+    QueueHandle_t     queues[I2C_BUS_PRIORITY_MAX]; // Devices, per priority
+    TaskHandle_t      task;                         // Bus task
+    SemaphoreHandle_t stopped;                      // Given by exiting task
+    volatile bool     running;                      // Cleared at delete
+    uint32_t          devices;                      // Devices added
+
+    struct i2c_bus_device *deferred;   // Delayed reads (bus task only)
+    portMUX_TYPE           stats_lock; // Protects device stats
+
+    /* Muxes (appended at device add, selection owned by the bus task) */
+    struct {
+        uint8_t address;  // Mux address
+        bool    known;    // Selection matches the mux (false after errors)
+        uint8_t selected; // Last control byte written
+    } muxes[I2C_BUS_MUX_MAX];
+    volatile uint8_t mux_count;
+};
+
+// -----------------------------------------------------------------------------
+
+// GLOBALS ---------------------------------------------------------------------
+
+/* Bus owning each port */
+static i2c_bus_handle_t _buses[I2C_NUM_MAX] = { NULL };
+static portMUX_TYPE     _buses_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+//// CREATE & DELETE -----------------------------------------------------------
+
+#define CHECK_ERR_CREATE_ARGS(create_args)                                     \
+    if (!create_args) {                                                        \
+        ESP_LOGE(TAG, "Pointer to i2c_bus_create_args_t is NULL.");            \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_HANDLE(out_handle)                                       \
+    if (!out_handle) {                                                         \
+        ESP_LOGE(TAG, "Pointer to out handle is NULL.");                       \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_I2C_PORT(i2c_port)                                           \
+    if ((unsigned) i2c_port >= I2C_NUM_MAX) {                                  \
+        ESP_LOGE(TAG, "I2C port %d is not valid.", (int) i2c_port);            \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_QUEUE_LEN(queue_len)                                         \
+    if (!queue_len) {                                                          \
+        ESP_LOGE(TAG, "Queue length must be at least 1.");                     \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_I2C_MODE_IS_MASTER(mode)                                     \
+    if (mode != I2C_MODE_MASTER) {                                             \
+        ESP_LOGE(TAG, "I2C driver mode is not I2C_MODE_MASTER.");              \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_MALLOC(ptr, bus)                                             \
+    if (!ptr) {                                                                \
+        ESP_LOGE(TAG, "Could not allocate memory.");                           \
+        _i2c_bus_free(bus);                                                    \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+#define CHECK_ERR_PORT_OWNED(err, i2c_port, bus)                               \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "I2C port %d is already owned.", (int) i2c_port);        \
+        _i2c_bus_free(bus);                                                    \
+        return err;                                                            \
+    }
+
+#define CHECK_ERR_I2C_DRIVER(err, what, bus)                                   \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not %s I2C driver: %s", what,                     \
+            esp_err_to_name(err));                                             \
+        _i2c_bus_unregister(bus);                                              \
+        _i2c_bus_free(bus);                                                    \
+        return err;                                                            \
+    }
+
+#define CHECK_ERR_TASK_CREATE(ok, bus)                                         \
+    if (ok != pdPASS) {                                                        \
+        ESP_LOGE(TAG, "Could not create bus task.");                           \
+        _i2c_bus_uninstall(bus);                                               \
+        _i2c_bus_unregister(bus);                                              \
+        _i2c_bus_free(bus);                                                    \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+#define CHECK_ERR_BUS_HAS_DEVICES(bus)                                         \
+    if (bus->devices) {                                                        \
+        ESP_LOGE(TAG, "Bus still has %u devices.", (unsigned) bus->devices);   \
+        return ESP_ERR_INVALID_STATE;                                          \
+    }
+
+#define CHECK_WARN_I2C_DRIVER_DELETE(err)                                      \
+    if (err) {                                                                 \
+        ESP_LOGW(TAG, "Could not uninstall I2C driver: %s",                    \
+            esp_err_to_name(err));                                             \
+    }
+
+//// ---------------------------------------------------------------------------
+
+//// HANDLE & PARAM ERRORS -----------------------------------------------------
+
+#define CHECK_ERR_HANDLE(handle)                                               \
+    if (!handle) {                                                             \
+        ESP_LOGE(TAG, "I2C bus (or device) handle is NULL.");                  \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_IN_PARAM(in_param)                                           \
+    if (!in_param) {                                                           \
+        ESP_LOGE(TAG, "Pointer to in parameter is NULL.");                     \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_PARAM(out_param)                                         \
+    if (!out_param) {                                                          \
+        ESP_LOGE(TAG, "Pointer to out parameter is NULL.");                    \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_MUX_CHANNEL(mux)                                             \
+    if (mux && mux->enable && mux->channel >= I2C_BUS_MUX_CHANNELS) {          \
+        ESP_LOGE(TAG, "Mux channel %u is not valid.", mux->channel);           \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_MUX_COUNT(mux_index)                                         \
+    if (mux_index < 0) {                                                       \
+        ESP_LOGE(TAG, "Bus has %d muxes already.", I2C_BUS_MUX_MAX);           \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+#define CHECK_ERR_TRANSACTION(txn)                                             \
+    if ((!txn->write_len && !txn->read_len)        ||                          \
+        ( txn->write_len && !txn->write_data)      ||                          \
+        ( txn->read_len  && !txn->read_data)       ||                          \
+        (unsigned) txn->priority >= I2C_BUS_PRIORITY_MAX) {                    \
+        ESP_LOGE(TAG, "Transaction is empty or not valid.");                   \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+//// Create & Delete -----------------------------------------------------------
+
+/* Free Bus (and whatever was created) */
+static void _i2c_bus_free(
+    i2c_bus_handle_t bus )
+{
+    if (!bus) return;
+    for (int p = 0; p < I2C_BUS_PRIORITY_MAX; p++)
+        if (bus->queues[p]) vQueueDelete(bus->queues[p]);
+    if (bus->stopped) vSemaphoreDelete(bus->stopped);
+    free(bus);
+}
+
+/* Uninstall the I2C driver, if installed by <bus> */
+static esp_err_t _i2c_bus_uninstall(
+    i2c_bus_handle_t bus )
+{
+    esp_err_t err = ESP_OK;
+#if !I2C_BUS_SIM
+    if (bus->uninstall_at_delete) err = i2c_driver_delete(bus->i2c_port);
+#endif
+    return err;
+}
+
+/* Register <bus> as owner of its port (ESP_ERR_INVALID_STATE if taken) */
+static esp_err_t _i2c_bus_register(
+    i2c_bus_handle_t bus )
+{
+    esp_err_t err = ESP_OK;
+    portENTER_CRITICAL(&_buses_lock);
+    if (_buses[bus->i2c_port]) err = ESP_ERR_INVALID_STATE;
+    else                       _buses[bus->i2c_port] = bus;
+    portEXIT_CRITICAL(&_buses_lock);
+    return err;
+}
+
+static void _i2c_bus_unregister(
+    i2c_bus_handle_t bus )
+{
+    portENTER_CRITICAL(&_buses_lock);
+    if (_buses[bus->i2c_port] == bus) _buses[bus->i2c_port] = NULL;
+    portEXIT_CRITICAL(&_buses_lock);
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Bus Task ------------------------------------------------------------------
+
+/* Run: [start, addr+W, write] [start, addr+R, read] stop, as one command
+ * link. With both phases this is a write-read with repeated start. */
+static esp_err_t _i2c_bus_run(
+    i2c_bus_handle_t const  bus        ,
+    uint8_t                 address    ,
+    uint8_t          const *write_data ,
+    size_t                  write_len  ,
+    uint8_t                *read_data  ,
+    size_t                  read_len   ,
+    TickType_t              timeout    )
+{
+    esp_err_t err = ESP_OK;
+
+#if I2C_BUS_SIM
+    // > Simulated Target
+    err = i2c_bus_sim_execute(bus->i2c_port, address,
+        write_data, write_len, read_data, read_len, timeout);
+#else
+    // > I2C Driver
+    uint8_t          buffer[I2C_LINK_RECOMMENDED_SIZE(2)] = { 0 }; // 2 phases
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(buffer, sizeof(buffer));
+    if (!cmd) return ESP_ERR_NO_MEM;
+
+    // > Build Command Link
+    err = i2c_master_start(cmd);
+    if (!err && write_len) {
+        err = i2c_master_write_byte(
+            cmd, (address << 1) | I2C_MASTER_WRITE, true);
+        if (!err) err = i2c_master_write(cmd, write_data, write_len, true);
+        if (!err && read_len) err = i2c_master_start(cmd);
+    }
+    if (!err && read_len) {
+        err = i2c_master_write_byte(
+            cmd, (address << 1) | I2C_MASTER_READ, true);
+        if (!err) err = i2c_master_read(
+            cmd, read_data, read_len, I2C_MASTER_LAST_NACK);
+    }
+    if (!err) err = i2c_master_stop(cmd);
+
+    // > Run
+    if (!err) err = i2c_master_cmd_begin(bus->i2c_port, cmd, timeout);
+    i2c_cmd_link_delete_static(cmd);
+#endif
+
+    return err;
+}
+
+/* Write control byte <mask> to mux <m>, unless the mux already has it */
+static esp_err_t _i2c_bus_mux_write(
+    i2c_bus_handle_t const bus     ,
+    int                    m       ,
+    uint8_t                mask    ,
+    TickType_t             timeout ,
+    uint32_t              *selects )
+{
+    if (bus->muxes[m].known && bus->muxes[m].selected == mask) return ESP_OK;
+
+    esp_err_t err = _i2c_bus_run(
+        bus, bus->muxes[m].address, &mask, 1, NULL, 0, timeout);
+    bus->muxes[m].known    = !err;
+    bus->muxes[m].selected = mask;
+    (*selects)++;
+    return err;
+}
+
+/* Select the mux channel of <device> (closing channels of other muxes). A
+ * device on the bus itself closes every mux: a device behind an open channel
+ * could answer at its address too. Closed muxes cost no write.
+ */
+static esp_err_t _i2c_bus_mux_select(
+    i2c_bus_handle_t        const bus     ,
+    i2c_bus_device_handle_t const device  ,
+    TickType_t                    timeout ,
+    uint32_t                     *selects )
+{
+    esp_err_t err = ESP_OK;
+
+    for (int m = 0; m < bus->mux_count && !err; m++)
+        if (m != device->mux)
+            err = _i2c_bus_mux_write(bus, m, 0x00, timeout, selects);
+    if (!err && device->mux >= 0)
+        err = _i2c_bus_mux_write(
+            bus, device->mux, device->mux_mask, timeout, selects);
+
+    return err;
+}
+
+/* Execute a transaction phase of <device> (mux channel selected first) */
+static esp_err_t _i2c_bus_execute(
+    i2c_bus_handle_t         const  bus        ,
+    i2c_bus_device_handle_t  const  device     ,
+    uint8_t                  const *write_data ,
+    size_t                          write_len  ,
+    uint8_t                        *read_data  ,
+    size_t                          read_len   ,
+    TickType_t                      timeout    )
+{
+    int64_t  start_us = esp_timer_get_time();
+    uint32_t selects  = 0;
+
+    esp_err_t err = _i2c_bus_mux_select(bus, device, timeout, &selects);
+    if (!err) err = _i2c_bus_run(bus, device->address,
+        write_data, write_len, read_data, read_len, timeout);
+
+    device->busy_us += esp_timer_get_time() - start_us;
+    if (selects) {
+        portENTER_CRITICAL(&bus->stats_lock);
+        device->stats.mux_selects += selects;
+        portEXIT_CRITICAL(&bus->stats_lock);
+    }
+    return err;
+}
+
+/* Complete the transaction of <device> and wake its caller */
+static void _i2c_bus_complete(
+    i2c_bus_handle_t        const bus    ,
+    i2c_bus_device_handle_t const device ,
+    esp_err_t                     err    )
+{
+    i2c_bus_transaction_t const *txn = device->txn;
+    int64_t latency_us = esp_timer_get_time() - device->submit_us;
+
+    // > Stats
+    portENTER_CRITICAL(&bus->stats_lock);
+    device->stats.transactions++;
+    if (err) device->stats.errors++;
+    else     device->stats.bytes += txn->write_len + txn->read_len;
+    device->stats.busy_us    += device->busy_us;
+    device->stats.latency_us += latency_us;
+    if (latency_us > device->stats.latency_max_us)
+        device->stats.latency_max_us = (uint32_t) latency_us;
+    portEXIT_CRITICAL(&bus->stats_lock);
+
+    // > Wake Caller
+    device->err = err;
+    xSemaphoreGive(device->done);
+}
+
+/* Serve the next queued transaction, highest priority first */
+static bool _i2c_bus_serve_next(
+    i2c_bus_handle_t const bus )
+{
+    i2c_bus_device_handle_t device = NULL;
+    for (int p = I2C_BUS_PRIORITY_MAX - 1; p >= 0 && !device; p--)
+        if (xQueueReceive(bus->queues[p], &device, 0) != pdTRUE) device = NULL;
+    if (!device) return false;
+
+    i2c_bus_transaction_t const *txn = device->txn;
+    esp_err_t err = ESP_OK;
+
+    // > No delay: one bus transaction (write & read merged, repeated start)
+    if (!txn->delay_us) {
+        err = _i2c_bus_execute(bus, device,
+            txn->write_data, txn->write_len,
+            txn->read_data,  txn->read_len, txn->timeout);
+        _i2c_bus_complete(bus, device, err);
+        return true;
+    }
+
+    // > Delay: write now (if any), read once due, serving others meanwhile
+    if (txn->write_len) {
+        err = _i2c_bus_execute(bus, device,
+            txn->write_data, txn->write_len, NULL, 0, txn->timeout);
+        if (err || !txn->read_len) {
+            _i2c_bus_complete(bus, device, err);
+            return true;
+        }
+    }
+    device->ready_us = esp_timer_get_time() + txn->delay_us;
+    device->next     = bus->deferred;
+    bus->deferred    = device;
+    return true;
+}
+
+/* Serve the earliest delayed read that is due */
+static bool _i2c_bus_serve_deferred(
+    i2c_bus_handle_t const bus )
+{
+    int64_t now_us = esp_timer_get_time();
+
+    // > Find earliest due
+    struct i2c_bus_device **earliest = NULL;
+    for (struct i2c_bus_device **it = &bus->deferred; *it; it = &(*it)->next)
+        if ((*it)->ready_us <= now_us &&
+            (!earliest || (*it)->ready_us < (*earliest)->ready_us))
+            earliest = it;
+    if (!earliest) return false;
+
+    // > Unlink & Read
+    i2c_bus_device_handle_t device = *earliest;
+    *earliest = device->next;
+    esp_err_t err = _i2c_bus_execute(bus, device, NULL, 0,
+        device->txn->read_data, device->txn->read_len, device->txn->timeout);
+    _i2c_bus_complete(bus, device, err);
+    return true;
+}
+
+/* Ticks until the earliest delayed read is due (portMAX_DELAY if none) */
+static TickType_t _i2c_bus_next_wait(
+    i2c_bus_handle_t const bus )
+{
+    if (!bus->deferred) return portMAX_DELAY;
+
+    int64_t earliest_us = bus->deferred->ready_us;
+    for (struct i2c_bus_device *it = bus->deferred->next; it; it = it->next)
+        if (it->ready_us < earliest_us) earliest_us = it->ready_us;
+
+    int64_t wait_us = earliest_us - esp_timer_get_time();
+    int64_t tick_us = portTICK_PERIOD_MS * 1000;
+    return wait_us <= 0 ? 0 : (TickType_t) ((wait_us + tick_us - 1) / tick_us);
+}
+
+/* Bus Task */
+static void _i2c_bus_task(
+    void *arg )
+{
+    i2c_bus_handle_t bus  = (i2c_bus_handle_t) arg;
+    TickType_t       wait = portMAX_DELAY;
+
+    while (1) {
+        // > Wait for a submit or the next delayed read
+        ulTaskNotifyTake(pdTRUE, wait);
+        if (!bus->running) break;
+
+        // > Serve everything ready back to back (due reads first)
+        while (_i2c_bus_serve_deferred(bus) || _i2c_bus_serve_next(bus));
+
+        wait = _i2c_bus_next_wait(bus);
+    }
+
+    xSemaphoreGive(bus->stopped);
+    vTaskDelete(NULL);
+}
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+//// Create & Delete -----------------------------------------------------------
+
+/* Create I2C Bus */
+esp_err_t i2c_bus_create(
+    i2c_bus_create_args_t const *create_args ,
+    i2c_bus_handle_t            *out_handle  )
+{
+    CHECK_ERR_CREATE_ARGS(create_args);
+    CHECK_ERR_OUT_HANDLE(out_handle);
+    CHECK_ERR_I2C_PORT(create_args->i2c_port);
+    CHECK_ERR_QUEUE_LEN(create_args->queue_len);
+    if (create_args->i2c_driver.install && create_args->i2c_driver.set_config)
+        CHECK_ERR_I2C_MODE_IS_MASTER(create_args->i2c_driver.config.mode);
+    esp_err_t err = ESP_OK;
+
+    // > Allocate Handle, Queues & Semaphore
+    i2c_bus_handle_t bus = calloc(1, sizeof(struct i2c_bus));
+    CHECK_ERR_MALLOC(bus, bus);
+    for (int p = 0; p < I2C_BUS_PRIORITY_MAX; p++) {
+        bus->queues[p] = xQueueCreate(
+            create_args->queue_len, sizeof(i2c_bus_device_handle_t));
+        CHECK_ERR_MALLOC(bus->queues[p], bus);
+    }
+    bus->stopped = xSemaphoreCreateBinary();
+    CHECK_ERR_MALLOC(bus->stopped, bus);
+
+    strncpy(bus->name, create_args->name, I2C_BUS_NAME_LENGTH - 1);
+    bus->i2c_port = create_args->i2c_port;
+    portMUX_INITIALIZE(&bus->stats_lock);
+
+    // > Take Ownership of Port
+    err = _i2c_bus_register(bus);
+    CHECK_ERR_PORT_OWNED(err, bus->i2c_port, bus);
+
+    // > I2C Driver (none on a simulated bus)
+#if !I2C_BUS_SIM
+    if (create_args->i2c_driver.install) {
+        if (create_args->i2c_driver.set_config) {
+            err = i2c_param_config(
+                bus->i2c_port, &create_args->i2c_driver.config);
+            CHECK_ERR_I2C_DRIVER(err, "configure", bus);
+        }
+        err = i2c_driver_install(bus->i2c_port, I2C_MODE_MASTER, 0, 0, 0);
+        CHECK_ERR_I2C_DRIVER(err, "install", bus);
+        bus->uninstall_at_delete = true;
+    }
+#endif
+
+    // > Bus Task
+    bus->running = true;
+    BaseType_t ok = xTaskCreate(
+        &_i2c_bus_task                ,
+        bus->name                     ,
+        create_args->task_stack_size  ,
+        bus                           ,
+        create_args->task_priority    ,
+        &bus->task                   );
+    CHECK_ERR_TASK_CREATE(ok, bus);
+
+    ESP_LOGI(TAG, "Bus '%s' owns I2C port %d.", bus->name, (int) bus->i2c_port);
+    *out_handle = bus;
+    return err;
+}
+
+/* Delete I2C Bus */
+esp_err_t i2c_bus_delete(
+    i2c_bus_handle_t bus )
+{
+    CHECK_ERR_HANDLE(bus);
+    CHECK_ERR_BUS_HAS_DEVICES(bus);
+    esp_err_t err = ESP_OK;
+
+    // > Stop Bus Task
+    bus->running = false;
+    xTaskNotifyGive(bus->task);
+    xSemaphoreTake(bus->stopped, portMAX_DELAY);
+
+    // > Uninstall I2C Driver?
+    err = _i2c_bus_uninstall(bus);
+    CHECK_WARN_I2C_DRIVER_DELETE(err);
+
+    // > Release Port & Free
+    _i2c_bus_unregister(bus);
+    _i2c_bus_free(bus);
+
+    return err;
+}
+
+/* Get I2C Bus of Port */
+esp_err_t i2c_bus_get(
+    i2c_port_t        i2c_port   ,
+    i2c_bus_handle_t *out_handle )
+{
+    CHECK_ERR_I2C_PORT(i2c_port);
+    CHECK_ERR_OUT_HANDLE(out_handle);
+
+    portENTER_CRITICAL(&_buses_lock);
+    *out_handle = _buses[i2c_port];
+    portEXIT_CRITICAL(&_buses_lock);
+
+    return *out_handle ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Devices -------------------------------------------------------------------
+
+/* Add Device */
+esp_err_t i2c_bus_add_device(
+    i2c_bus_handle_t         const  bus        ,
+    const char                     *name       ,
+    uint8_t                         address    ,
+    i2c_bus_device_handle_t        *out_device )
+{ return i2c_bus_add_mux_device(bus, name, address, NULL, out_device); }
+
+/* Add Device behind a Mux Channel */
+esp_err_t i2c_bus_add_mux_device(
+    i2c_bus_handle_t         const  bus        ,
+    const char                     *name       ,
+    uint8_t                         address    ,
+    i2c_bus_mux_channel_t    const *mux        ,
+    i2c_bus_device_handle_t        *out_device )
+{
+    CHECK_ERR_HANDLE(bus);
+    CHECK_ERR_IN_PARAM(name);
+    CHECK_ERR_OUT_HANDLE(out_device);
+    CHECK_ERR_MUX_CHANNEL(mux);
+
+    // > Mux (registered once per address)
+    int mux_index = -1;
+    if (mux && mux->enable) {
+        portENTER_CRITICAL(&_buses_lock);
+        for (int m = 0; m < bus->mux_count; m++)
+            if (bus->muxes[m].address == mux->address) mux_index = m;
+        if (mux_index < 0 && bus->mux_count < I2C_BUS_MUX_MAX) {
+            mux_index = bus->mux_count;
+            bus->muxes[mux_index].address = mux->address;
+            bus->muxes[mux_index].known   = false;
+            bus->mux_count++;
+        }
+        portEXIT_CRITICAL(&_buses_lock);
+        CHECK_ERR_MUX_COUNT(mux_index);
+    }
+
+    // > Allocate Device & Semaphores
+    i2c_bus_device_handle_t device = calloc(1, sizeof(struct i2c_bus_device));
+    if (device) {
+        device->lock = xSemaphoreCreateMutex();
+        device->done = xSemaphoreCreateBinary();
+    }
+    if (!device || !device->lock || !device->done) {
+        ESP_LOGE(TAG, "Could not allocate memory.");
+        if (device && device->lock) vSemaphoreDelete(device->lock);
+        if (device && device->done) vSemaphoreDelete(device->done);
+        free(device);
+        return ESP_ERR_NO_MEM;
+    }
+
+    strncpy(device->name, name, I2C_BUS_DEVICE_NAME_LENGTH - 1);
+    device->address  = address;
+    device->bus      = bus;
+    device->mux      = mux_index;
+    device->mux_mask = mux_index < 0 ? 0 : (uint8_t) (1 << mux->channel);
+
+    portENTER_CRITICAL(&_buses_lock);
+    bus->devices++;
+    portEXIT_CRITICAL(&_buses_lock);
+
+    *out_device = device;
+    return ESP_OK;
+}
+
+/* Remove Device (waits for its transaction in flight, if any) */
+esp_err_t i2c_bus_remove_device(
+    i2c_bus_device_handle_t device )
+{
+    CHECK_ERR_HANDLE(device);
+
+    xSemaphoreTake(device->lock, portMAX_DELAY);
+
+    portENTER_CRITICAL(&_buses_lock);
+    device->bus->devices--;
+    portEXIT_CRITICAL(&_buses_lock);
+
+    vSemaphoreDelete(device->lock);
+    vSemaphoreDelete(device->done);
+    free(device);
+
+    return ESP_OK;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Transfer ------------------------------------------------------------------
+
+/* Transfer */
+esp_err_t i2c_bus_transfer(
+    i2c_bus_device_handle_t const  device        ,
+    i2c_bus_transaction_t   const *transaction   ,
+    TickType_t                     ticks_to_wait )
+{
+    CHECK_ERR_HANDLE(device);
+    CHECK_ERR_IN_PARAM(transaction);
+    CHECK_ERR_TRANSACTION(transaction);
+    i2c_bus_handle_t bus = device->bus;
+
+    // > One transaction in flight per device
+    if (xSemaphoreTake(device->lock, ticks_to_wait) != pdTRUE)
+        return ESP_ERR_TIMEOUT;
+
+    // > Submit
+    device->txn       = transaction;
+    device->err       = ESP_OK;
+    device->busy_us   = 0;
+    device->submit_us = esp_timer_get_time();
+    if (xQueueSend(
+            bus->queues[transaction->priority], &device, ticks_to_wait
+        ) != pdTRUE) {
+        xSemaphoreGive(device->lock);
+        return ESP_ERR_TIMEOUT;
+    }
+    xTaskNotifyGive(bus->task);
+
+    // > Wait for Completion (always comes: every phase has a driver timeout)
+    xSemaphoreTake(device->done, portMAX_DELAY);
+    esp_err_t err = device->err;
+
+    xSemaphoreGive(device->lock);
+    return err;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Stats ---------------------------------------------------------------------
+
+/* Get Device Stats */
+esp_err_t i2c_bus_device_get_stats(
+    i2c_bus_device_handle_t const  device    ,
+    i2c_bus_device_stats_t        *out_stats )
+{
+    CHECK_ERR_HANDLE(device);
+    CHECK_ERR_OUT_PARAM(out_stats);
+
+    portENTER_CRITICAL(&device->bus->stats_lock);
+    *out_stats = device->stats;
+    portEXIT_CRITICAL(&device->bus->stats_lock);
+
+    return ESP_OK;
+}
+
+/* Reset Device Stats */
+esp_err_t i2c_bus_device_reset_stats(
+    i2c_bus_device_handle_t const device )
+{
+    CHECK_ERR_HANDLE(device);
+
+    portENTER_CRITICAL(&device->bus->stats_lock);
+    memset(&device->stats, 0, sizeof(device->stats));
+    portEXIT_CRITICAL(&device->bus->stats_lock);
+
+    return ESP_OK;
+}
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,122 @@
+#include "i2c_bus_sim.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdbool.h>             // for bool
+#include "esp_err.h"             // for ESP errors
+#include "freertos/FreeRTOS.h"   // for FreeRTOS
+#include "freertos/task.h"       // for vTaskDelay
+
+/* Logging */
+#include "esp_log.h"
+static const char *TAG = "I2C Bus Sim";
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define I2C_BUS_SIM_ADDRESSES 128 // 7 bit addresses
+
+// -----------------------------------------------------------------------------
+
+// GLOBALS ---------------------------------------------------------------------
+
+/* Target attached at each port & address */
+static struct {
+    bool                 attached;
+    i2c_bus_sim_target_t target;
+} _targets[I2C_NUM_MAX][I2C_BUS_SIM_ADDRESSES];
+static portMUX_TYPE _targets_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+#define CHECK_ERR_PORT_ADDRESS(i2c_port, address)                              \
+    if ((unsigned) i2c_port >= I2C_NUM_MAX ||                                  \
+        address >= I2C_BUS_SIM_ADDRESSES) {                                    \
+        ESP_LOGE(TAG, "I2C port %d or address 0x%02x is not valid.",           \
+            (int) i2c_port, address);                                          \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_TARGET(target)                                               \
+    if (!target || !target->write || !target->read) {                          \
+        ESP_LOGE(TAG, "Simulated target needs write and read functions.");     \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+// -----------------------------------------------------------------------------
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+/* Attach Target */
+esp_err_t i2c_bus_sim_attach(
+    i2c_port_t                  i2c_port ,
+    uint8_t                     address  ,
+    i2c_bus_sim_target_t const *target   )
+{
+    CHECK_ERR_PORT_ADDRESS(i2c_port, address);
+    CHECK_ERR_TARGET(target);
+    esp_err_t err = ESP_OK;
+
+    portENTER_CRITICAL(&_targets_lock);
+    if (_targets[i2c_port][address].attached) err = ESP_ERR_INVALID_STATE;
+    else {
+        _targets[i2c_port][address].target   = *target;
+        _targets[i2c_port][address].attached = true;
+    }
+    portEXIT_CRITICAL(&_targets_lock);
+
+    if (err) ESP_LOGE(TAG, "Address 0x%02x of I2C port %d is taken.",
+        address, (int) i2c_port);
+    return err;
+}
+
+/* Detach Target */
+esp_err_t i2c_bus_sim_detach(
+    i2c_port_t i2c_port ,
+    uint8_t    address  )
+{
+    CHECK_ERR_PORT_ADDRESS(i2c_port, address);
+
+    portENTER_CRITICAL(&_targets_lock);
+    _targets[i2c_port][address].attached = false;
+    portEXIT_CRITICAL(&_targets_lock);
+
+    return ESP_OK;
+}
+
+/* Execute Transaction */
+esp_err_t i2c_bus_sim_execute(
+    i2c_port_t           i2c_port   ,
+    uint8_t              address    ,
+    uint8_t      const  *write_data ,
+    size_t               write_len  ,
+    uint8_t             *read_data  ,
+    size_t               read_len   ,
+    TickType_t           timeout    )
+{
+    CHECK_ERR_PORT_ADDRESS(i2c_port, address);
+    esp_err_t err = ESP_OK;
+
+    // > Target (no target: nobody ACKs the address)
+    bool                 attached;
+    i2c_bus_sim_target_t target;
+    portENTER_CRITICAL(&_targets_lock);
+    attached = _targets[i2c_port][address].attached;
+    target   = _targets[i2c_port][address].target;
+    portEXIT_CRITICAL(&_targets_lock);
+    if (!attached) return ESP_FAIL;
+
+    // > Phases
+    if (write_len) err = target.write(target.ctx, write_data, write_len);
+    if (!err && read_len) err = target.read(target.ctx, read_data, read_len);
+
+    // > SCL held: the driver gives up after the timeout
+    if (err == ESP_ERR_TIMEOUT) vTaskDelay(timeout);
+
+    return err;
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,226 @@
+#ifndef __I2C_BUS_H__
+#define __I2C_BUS_H__
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdbool.h>            // bool
+#include <stdint.h>             // uint8_t, uint32_t, uint64_t
+#include <stddef.h>             // size_t
+#include "esp_err.h"            // esp_err_t
+#include "i2c_bus_driver.h"     // i2c_port_t, i2c_config_t
+#include "freertos/FreeRTOS.h"  // TickType_t, UBaseType_t
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define I2C_BUS_NAME_LENGTH        16
+#define I2C_BUS_DEVICE_NAME_LENGTH 16
+#define I2C_BUS_MUX_MAX            8 // Muxes per bus (TCA9548A: 0x70 to 0x77)
+#define I2C_BUS_MUX_CHANNELS       8 // Channels per mux
+
+//// KCONFIG -------------------------------------------------------------------
+
+#define I2C_BUS_DEFAULT_NAME                                   /* "i2c_bus" */ \
+        CONFIG_I2C_BUS_DEFAULT_NAME
+#define I2C_BUS_DEFAULT_I2C_PORT                           /* (I2C_NUM_0) 0 */ \
+        (i2c_port_t)CONFIG_I2C_BUS_DEFAULT_I2C_PORT
+#define I2C_BUS_DEFAULT_QUEUE_LEN                                      /* 8 */ \
+        CONFIG_I2C_BUS_DEFAULT_QUEUE_LEN
+#define I2C_BUS_DEFAULT_TASK_PRIORITY                                 /* 10 */ \
+        CONFIG_I2C_BUS_DEFAULT_TASK_PRIORITY
+#define I2C_BUS_DEFAULT_TASK_STACK_SIZE                             /* 3072 */ \
+        CONFIG_I2C_BUS_DEFAULT_TASK_STACK_SIZE
+#define I2C_BUS_DEFAULT_SCL_IO                                        /* 19 */ \
+        CONFIG_I2C_BUS_DEFAULT_SCL_IO
+#define I2C_BUS_DEFAULT_SDA_IO                                        /* 18 */ \
+        CONFIG_I2C_BUS_DEFAULT_SDA_IO
+#define I2C_BUS_DEFAULT_CLK_SPEED                                 /* 400000 */ \
+        CONFIG_I2C_BUS_DEFAULT_CLK_SPEED
+
+/* Simulated bus (see i2c_bus_sim.h) */
+#define I2C_BUS_SIM                                                    /* 0 */ \
+        CONFIG_I2C_BUS_SIM
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// ENUMS -----------------------------------------------------------------------
+
+/* I2C Bus Transaction Priority */
+typedef enum {
+    I2C_BUS_PRIORITY_LOW    = 0, // Background (e.g. dumps, scans)
+    I2C_BUS_PRIORITY_NORMAL = 1, // Periodic sensor reads
+    I2C_BUS_PRIORITY_HIGH   = 2, // Latency sensitive
+    I2C_BUS_PRIORITY_MAX
+} i2c_bus_priority_t;
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* I2C Bus Handle */
+typedef struct i2c_bus *i2c_bus_handle_t;
+
+/* I2C Bus Device Handle */
+typedef struct i2c_bus_device *i2c_bus_device_handle_t;
+
+/* I2C Bus Create Args */
+typedef struct {
+    const char *name;     // Handle (and task) name
+    i2c_port_t  i2c_port; // Port owned by the bus
+
+    struct {
+        bool         install;    // Install driver (uninstalled at delete)?
+        bool         set_config; // Set I2C configuration before install?
+        i2c_config_t config;     // I2C configuration (master mode)
+    } i2c_driver;
+
+    uint32_t    queue_len;       // Transactions waiting per priority
+    UBaseType_t task_priority;   // Bus task priority
+    uint32_t    task_stack_size; // Bus task stack size
+} i2c_bus_create_args_t;
+
+/* I2C Bus Transaction */
+/* A write, an optional delay and a read, all optional but not both empty.
+ * With no delay, write and read go in one bus transaction (repeated start).
+ * With a delay, the bus serves other devices until the read is due.
+ */
+typedef struct {
+    uint8_t const     *write_data; // Bytes to write
+    size_t             write_len;  // 0: no write
+    uint32_t           delay_us;   // Between write and read
+    uint8_t           *read_data;  // Buffer for read bytes
+    size_t             read_len;   // 0: no read
+    i2c_bus_priority_t priority;   // Queue to submit to
+    TickType_t         timeout;    // Driver timeout of each bus phase
+} i2c_bus_transaction_t;
+
+/* I2C Bus Mux Channel */
+/* TCA9548A style mux: writing a control byte to the mux address enables the
+ * channels set in it. Devices behind different channels may share addresses.
+ */
+typedef struct {
+    bool    enable;  // Device behind a mux?
+    uint8_t address; // Mux address
+    uint8_t channel; // 0 to I2C_BUS_MUX_CHANNELS - 1
+} i2c_bus_mux_channel_t;
+
+/* I2C Bus Device Stats */
+typedef struct {
+    uint32_t transactions;   // Completed transactions (ok or not)
+    uint32_t errors;         // Failed transactions
+    uint32_t mux_selects;    // Mux control bytes sent before transactions
+    uint64_t bytes;          // Bytes written and read
+    uint64_t busy_us;        // Time on the bus (throughput: bytes / busy_us)
+    uint64_t latency_us;     // Submit to done, summed (mean: / transactions)
+    uint32_t latency_max_us; // Submit to done, worst
+} i2c_bus_device_stats_t;
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+/* I2C Bus Default Create Args */
+#define I2C_BUS_DEFAULT_CREATE_ARGS() {                                        \
+    .name     = I2C_BUS_DEFAULT_NAME,                                          \
+    .i2c_port = I2C_BUS_DEFAULT_I2C_PORT,                                      \
+    .i2c_driver = {                                                            \
+        .install    = true,                                                    \
+        .set_config = true,                                                    \
+        .config = {                                                            \
+            .mode             = I2C_MODE_MASTER,                               \
+            .scl_io_num       = I2C_BUS_DEFAULT_SCL_IO,                        \
+            .sda_io_num       = I2C_BUS_DEFAULT_SDA_IO,                        \
+            .scl_pullup_en    = true,                                          \
+            .sda_pullup_en    = true,                                          \
+            .master.clk_speed = I2C_BUS_DEFAULT_CLK_SPEED                      \
+        }                                                                      \
+    },                                                                         \
+    .queue_len       = I2C_BUS_DEFAULT_QUEUE_LEN,                              \
+    .task_priority   = I2C_BUS_DEFAULT_TASK_PRIORITY,                          \
+    .task_stack_size = I2C_BUS_DEFAULT_TASK_STACK_SIZE                         \
+}
+
+/* I2C Bus Transaction: Write Only */
+#define I2C_BUS_TRANSACTION_WRITE(data, len, prio, ticks) {                    \
+    .write_data = (data), .write_len = (len),                                  \
+    .priority   = (prio), .timeout   = (ticks)                                 \
+}
+
+/* I2C Bus Transaction: Read Only */
+#define I2C_BUS_TRANSACTION_READ(data, len, prio, ticks) {                     \
+    .read_data = (data), .read_len = (len),                                    \
+    .priority  = (prio), .timeout  = (ticks)                                   \
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS -------------------------------------------------------------------
+
+/* Create & Delete */
+/* A bus owns its port: only one bus per port may exist, and the rest of the
+ * application should reach the port through it (see i2c_bus_get). A bus can
+ * only be deleted once all its devices are removed.
+ */
+esp_err_t i2c_bus_create(
+    i2c_bus_create_args_t const *create_args ,
+    i2c_bus_handle_t            *out_handle  );
+
+esp_err_t i2c_bus_delete(
+    i2c_bus_handle_t bus );
+
+/* Get the bus owning <i2c_port> (ESP_ERR_NOT_FOUND if none) */
+esp_err_t i2c_bus_get(
+    i2c_port_t        i2c_port   ,
+    i2c_bus_handle_t *out_handle );
+
+/* Devices */
+esp_err_t i2c_bus_add_device(
+    i2c_bus_handle_t         const  bus        ,
+    const char                     *name       ,
+    uint8_t                         address    ,
+    i2c_bus_device_handle_t        *out_device );
+
+/* Add a device behind a mux channel (NULL or !enable: on the bus itself).
+ * Before each transaction the bus task selects the channel, only writing the
+ * mux when the cached selection differs, and closes any channel open on other
+ * muxes first. Before a transaction of a device on the bus itself, every mux
+ * with a channel open (or unknown after an error) is closed, so that devices
+ * behind it cannot answer at the same address.
+ */
+esp_err_t i2c_bus_add_mux_device(
+    i2c_bus_handle_t         const  bus        ,
+    const char                     *name       ,
+    uint8_t                         address    ,
+    i2c_bus_mux_channel_t    const *mux        ,
+    i2c_bus_device_handle_t        *out_device );
+
+esp_err_t i2c_bus_remove_device(
+    i2c_bus_device_handle_t device );
+
+/* Transfer */
+/* Submits <transaction> to the bus task and blocks until it is done. Queued
+ * transactions are served highest priority first, FIFO within a priority.
+ * A device has one transaction in flight at a time: concurrent callers on the
+ * same device wait their turn. <ticks_to_wait> bounds the wait for a free
+ * queue slot (ESP_ERR_TIMEOUT); once queued, the call waits for the result,
+ * which is the driver error of the failing phase (ESP_FAIL on NACK).
+ */
+esp_err_t i2c_bus_transfer(
+    i2c_bus_device_handle_t const  device        ,
+    i2c_bus_transaction_t   const *transaction   ,
+    TickType_t                     ticks_to_wait );
+
+/* Stats */
+esp_err_t i2c_bus_device_get_stats(
+    i2c_bus_device_handle_t const  device    ,
+    i2c_bus_device_stats_t        *out_stats );
+
+esp_err_t i2c_bus_device_reset_stats(
+    i2c_bus_device_handle_t const device );
+
+// -----------------------------------------------------------------------------
+
+#endif // __I2C_BUS_H__
@@ -0,0 +1,61 @@
+#ifndef __I2C_BUS_DRIVER_H__
+#define __I2C_BUS_DRIVER_H__
+
+// INCLUDES --------------------------------------------------------------------
+
+#include "sdkconfig.h"          // CONFIG_IDF_TARGET_LINUX
+
+#if !CONFIG_IDF_TARGET_LINUX
+#include "driver/i2c.h"         // i2c_port_t, i2c_config_t, I2C_MODE_MASTER
+#else
+#include <stdbool.h>            // bool
+#include <stdint.h>             // uint8_t, uint32_t
+#endif
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* I2C Driver Types */
+/* The linux target has no I2C driver (the bus is always simulated there), so
+ * the driver types the bus API carries are declared here instead, with the
+ * same names and fields. Chip targets use the driver's own.
+ */
+#if CONFIG_IDF_TARGET_LINUX
+
+typedef int i2c_port_t;
+
+#define I2C_NUM_0   0 // I2C port 0
+#define I2C_NUM_1   1 // I2C port 1
+#define I2C_NUM_MAX 2 // Ports per chip (ESP32)
+
+typedef enum {
+    I2C_MODE_SLAVE  = 0,
+    I2C_MODE_MASTER = 1,
+    I2C_MODE_MAX
+} i2c_mode_t;
+
+typedef struct {
+    i2c_mode_t mode;          // Master or slave
+    int        sda_io_num;    // SDA GPIO
+    int        scl_io_num;    // SCL GPIO
+    bool       sda_pullup_en; // Internal SDA pull-up
+    bool       scl_pullup_en; // Internal SCL pull-up
+    union {
+        struct {
+            uint32_t clk_speed;    // Master clock (Hz)
+        } master;
+        struct {
+            uint8_t  addr_10bit_en; // 10 bit slave address?
+            uint16_t slave_addr;    // Slave address
+            uint32_t maximum_speed; // Expected master clock (Hz)
+        } slave;
+    };
+    uint32_t clk_flags;       // Clock source flags
+} i2c_config_t;
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+#endif // __I2C_BUS_DRIVER_H__
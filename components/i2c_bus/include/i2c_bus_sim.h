@@ -0,0 +1,62 @@
+#ifndef __I2C_BUS_SIM_H__
+#define __I2C_BUS_SIM_H__
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>             // uint8_t
+#include <stddef.h>             // size_t
+#include "esp_err.h"            // esp_err_t
+#include "i2c_bus_driver.h"     // i2c_port_t
+#include "freertos/FreeRTOS.h"  // TickType_t
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* I2C Bus Simulated Target */
+/* A device model answering one address. Each phase returns what the device
+ * does on the wire:
+ *  - ESP_OK:          every byte ACKed (write) or sent (read).
+ *  - ESP_FAIL:        address or data NACKed (e.g. busy converting).
+ *  - ESP_ERR_TIMEOUT: SCL held low; the bus waits the transaction timeout.
+ * Phases are called from the bus task, one at a time per port.
+ */
+typedef struct {
+    esp_err_t (*write)(void *ctx, uint8_t const *data, size_t len);
+    esp_err_t (*read) (void *ctx, uint8_t       *data, size_t len);
+    void       *ctx; // Passed to write & read
+} i2c_bus_sim_target_t;
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS -------------------------------------------------------------------
+
+/* Attach & Detach */
+/* Targets may be attached before the bus of <i2c_port> is created. Only used
+ * when I2C_BUS_SIM is set: otherwise transactions go to the I2C driver.
+ */
+esp_err_t i2c_bus_sim_attach(
+    i2c_port_t                  i2c_port ,
+    uint8_t                     address  ,
+    i2c_bus_sim_target_t const *target   );
+
+esp_err_t i2c_bus_sim_detach(
+    i2c_port_t i2c_port ,
+    uint8_t    address  );
+
+/* Execute */
+/* Runs one bus transaction (write, then read with repeated start) against the
+ * target at <address>, with the same results as the I2C driver.
+ */
+esp_err_t i2c_bus_sim_execute(
+    i2c_port_t           i2c_port   ,
+    uint8_t              address    ,
+    uint8_t      const  *write_data ,
+    size_t               write_len  ,
+    uint8_t             *read_data  ,
+    size_t               read_len   ,
+    TickType_t           timeout    );
+
+// -----------------------------------------------------------------------------
+
+#endif // __I2C_BUS_SIM_H__
@@ -0,0 +1,63 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include "unity.h"
+
+#include "bench_utils.h"
+
+#include "i2c_bus.h"
+#include "i2c_bus_sim.h"
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define BENCH_PORT    I2C_NUM_0
+#define BENCH_ADDRESS 0x48
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+/* Target that ACKs everything and reads zeros: the bus path is all we time */
+static esp_err_t _ack_write(void *ctx, uint8_t const *data, size_t len)
+{
+    (void)ctx; (void)data; (void)len;
+    return ESP_OK;
+}
+
+static esp_err_t _ack_read(void *ctx, uint8_t *data, size_t len)
+{
+    (void)ctx;
+    for (size_t i = 0; i < len; i++) data[i] = 0;
+    return ESP_OK;
+}
+
+// BENCHMARKS ------------------------------------------------------------------
+
+TEST_CASE("transfer round trip through the bus task", "[i2c_bus]" BENCH_TAG)
+{
+    i2c_bus_create_args_t args = I2C_BUS_DEFAULT_CREATE_ARGS();
+    i2c_bus_handle_t bus = NULL;
+    i2c_bus_device_handle_t dev = NULL;
+    i2c_bus_sim_target_t target = { .write = _ack_write, .read = _ack_read };
+    args.i2c_port = BENCH_PORT;
+    TEST_ESP_OK(i2c_bus_create(&args, &bus));
+    TEST_ESP_OK(i2c_bus_sim_attach(BENCH_PORT, BENCH_ADDRESS, &target));
+    TEST_ESP_OK(i2c_bus_add_device(bus, "ack", BENCH_ADDRESS, &dev));
+
+    uint8_t cmd = 0xE7, reply[3];
+    i2c_bus_transaction_t wr = {
+        .write_data = &cmd,  .write_len = 1,
+        .read_data  = reply, .read_len  = sizeof(reply),
+        .priority   = I2C_BUS_PRIORITY_NORMAL, .timeout = pdMS_TO_TICKS(10)
+    };
+    BENCH_RUN("i2c_bus_transfer write-read 1+3 (sim)", 20000, {
+        i2c_bus_transfer(dev, &wr, portMAX_DELAY);
+    });
+
+    i2c_bus_device_stats_t stats;
+    TEST_ESP_OK(i2c_bus_device_get_stats(dev, &stats));
+    bench_report("i2c_bus submit to done", stats.transactions,
+        (int64_t) stats.latency_us);
+    TEST_ASSERT_EQUAL(0, stats.errors);
+
+    TEST_ESP_OK(i2c_bus_remove_device(dev));
+    TEST_ESP_OK(i2c_bus_sim_detach(BENCH_PORT, BENCH_ADDRESS));
+    TEST_ESP_OK(i2c_bus_delete(bus));
+}
@@ -0,0 +1,266 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+
+#include "i2c_bus.h"
+#include "i2c_bus_sim.h"
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define TEST_PORT    I2C_NUM_0
+#define TEST_ADDRESS 0x48
+#define TEST_TIMEOUT pdMS_TO_TICKS(20)
+
+#define TEST_MUX_ADDRESS    0x70 // TCA9548A
+#define TEST_MUX_CHANNEL    2
+#define TEST_MUXED_ADDRESS  0x40 // Behind TEST_MUX_CHANNEL
+#define TEST_MUX_ROUNDS     10
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Register file target: a write sets the register pointer (first byte) and
+ * stores the rest from there; a read returns bytes from the pointer on. */
+typedef struct {
+    uint8_t  regs[16];
+    uint8_t  pointer;
+    bool     stuck;
+    uint32_t writes;
+    uint32_t reads;
+} regfile_t;
+
+/* Mux target: keeps the control byte written to it. Device targets check it
+ * on every access (the model does not route channels itself). */
+typedef struct {
+    uint8_t  control;
+    uint32_t writes;
+} mux_t;
+
+typedef struct {
+    mux_t const *mux;
+    uint8_t      expected; // Control byte the device may be reached with
+    uint32_t     accesses;
+    uint32_t     violations;
+} mux_probe_t;
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+static esp_err_t _regfile_write(void *ctx, uint8_t const *data, size_t len)
+{
+    regfile_t *rf = ctx;
+    if (rf->stuck) return ESP_ERR_TIMEOUT;
+    rf->writes++;
+    rf->pointer = data[0] % sizeof(rf->regs);
+    for (size_t i = 1; i < len; i++)
+        rf->regs[(rf->pointer + i - 1) % sizeof(rf->regs)] = data[i];
+    return ESP_OK;
+}
+
+static esp_err_t _regfile_read(void *ctx, uint8_t *data, size_t len)
+{
+    regfile_t *rf = ctx;
+    if (rf->stuck) return ESP_ERR_TIMEOUT;
+    rf->reads++;
+    for (size_t i = 0; i < len; i++)
+        data[i] = rf->regs[(rf->pointer + i) % sizeof(rf->regs)];
+    return ESP_OK;
+}
+
+static esp_err_t _mux_write(void *ctx, uint8_t const *data, size_t len)
+{
+    mux_t *mux = ctx;
+    mux->control = data[len - 1];
+    mux->writes++;
+    return ESP_OK;
+}
+
+static esp_err_t _mux_read(void *ctx, uint8_t *data, size_t len)
+{
+    mux_t *mux = ctx;
+    for (size_t i = 0; i < len; i++) data[i] = mux->control;
+    return ESP_OK;
+}
+
+static esp_err_t _probe_access(mux_probe_t *probe)
+{
+    probe->accesses++;
+    if (probe->mux->control != probe->expected) probe->violations++;
+    return ESP_OK;
+}
+
+static esp_err_t _probe_write(void *ctx, uint8_t const *data, size_t len)
+{ return _probe_access(ctx); }
+
+static esp_err_t _probe_read(void *ctx, uint8_t *data, size_t len)
+{ return _probe_access(ctx); }
+
+static i2c_bus_handle_t _bus_create(void)
+{
+    i2c_bus_create_args_t args = I2C_BUS_DEFAULT_CREATE_ARGS();
+    i2c_bus_handle_t bus = NULL;
+    args.i2c_port = TEST_PORT;
+    TEST_ESP_OK(i2c_bus_create(&args, &bus));
+    return bus;
+}
+
+static void _regfile_attach(regfile_t *rf, uint8_t address)
+{
+    i2c_bus_sim_target_t target = {
+        .write = _regfile_write, .read = _regfile_read, .ctx = rf
+    };
+    memset(rf, 0, sizeof(*rf));
+    TEST_ESP_OK(i2c_bus_sim_attach(TEST_PORT, address, &target));
+}
+
+// TESTS -----------------------------------------------------------------------
+
+TEST_CASE("simulated bus writes and reads back with repeated start", "[i2c_bus]")
+{
+    regfile_t rf;
+    i2c_bus_device_handle_t dev = NULL;
+    i2c_bus_handle_t bus = _bus_create();
+    _regfile_attach(&rf, TEST_ADDRESS);
+    TEST_ESP_OK(i2c_bus_add_device(bus, "regfile", TEST_ADDRESS, &dev));
+
+    uint8_t write[] = { 0x02, 0xAB, 0xCD };
+    i2c_bus_transaction_t w = I2C_BUS_TRANSACTION_WRITE(
+        write, sizeof(write), I2C_BUS_PRIORITY_NORMAL, TEST_TIMEOUT);
+    TEST_ESP_OK(i2c_bus_transfer(dev, &w, portMAX_DELAY));
+
+    uint8_t pointer = 0x02, read[2] = { 0 };
+    i2c_bus_transaction_t wr = {
+        .write_data = &pointer, .write_len = 1,
+        .read_data  = read,     .read_len  = sizeof(read),
+        .priority   = I2C_BUS_PRIORITY_NORMAL, .timeout = TEST_TIMEOUT
+    };
+    TEST_ESP_OK(i2c_bus_transfer(dev, &wr, portMAX_DELAY));
+    TEST_ASSERT_EQUAL_HEX8(0xAB, read[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xCD, read[1]);
+
+    i2c_bus_device_stats_t stats;
+    TEST_ESP_OK(i2c_bus_device_get_stats(dev, &stats));
+    TEST_ASSERT_EQUAL(2, stats.transactions);
+    TEST_ASSERT_EQUAL(0, stats.errors);
+    TEST_ASSERT_EQUAL(3 + 1 + 2, stats.bytes);
+
+    TEST_ESP_OK(i2c_bus_remove_device(dev));
+    TEST_ESP_OK(i2c_bus_sim_detach(TEST_PORT, TEST_ADDRESS));
+    TEST_ESP_OK(i2c_bus_delete(bus));
+}
+
+TEST_CASE("simulated bus NACKs addresses with no target", "[i2c_bus]")
+{
+    i2c_bus_device_handle_t dev = NULL;
+    i2c_bus_handle_t bus = _bus_create();
+    TEST_ESP_OK(i2c_bus_add_device(bus, "nobody", 0x33, &dev));
+
+    uint8_t byte = 0;
+    i2c_bus_transaction_t w = I2C_BUS_TRANSACTION_WRITE(
+        &byte, 1, I2C_BUS_PRIORITY_NORMAL, TEST_TIMEOUT);
+    TEST_ESP_ERR(ESP_FAIL, i2c_bus_transfer(dev, &w, portMAX_DELAY));
+
+    i2c_bus_device_stats_t stats;
+    TEST_ESP_OK(i2c_bus_device_get_stats(dev, &stats));
+    TEST_ASSERT_EQUAL(1, stats.errors);
+
+    TEST_ESP_OK(i2c_bus_remove_device(dev));
+    TEST_ESP_OK(i2c_bus_delete(bus));
+}
+
+TEST_CASE("stuck target times out after the transaction timeout", "[i2c_bus]")
+{
+    regfile_t rf;
+    i2c_bus_device_handle_t dev = NULL;
+    i2c_bus_handle_t bus = _bus_create();
+    _regfile_attach(&rf, TEST_ADDRESS);
+    rf.stuck = true;
+    TEST_ESP_OK(i2c_bus_add_device(bus, "regfile", TEST_ADDRESS, &dev));
+
+    uint8_t byte = 0;
+    i2c_bus_transaction_t w = I2C_BUS_TRANSACTION_WRITE(
+        &byte, 1, I2C_BUS_PRIORITY_NORMAL, TEST_TIMEOUT);
+    int64_t start_us = esp_timer_get_time();
+    TEST_ESP_ERR(ESP_ERR_TIMEOUT, i2c_bus_transfer(dev, &w, portMAX_DELAY));
+    TEST_ASSERT_GREATER_OR_EQUAL(
+        (TEST_TIMEOUT - 1) * portTICK_PERIOD_MS * 1000,
+        esp_timer_get_time() - start_us);
+
+    TEST_ESP_OK(i2c_bus_remove_device(dev));
+    TEST_ESP_OK(i2c_bus_sim_detach(TEST_PORT, TEST_ADDRESS));
+    TEST_ESP_OK(i2c_bus_delete(bus));
+}
+
+TEST_CASE("only one bus owns a port", "[i2c_bus]")
+{
+    i2c_bus_handle_t bus = _bus_create(), other = NULL, got = NULL;
+    i2c_bus_create_args_t args = I2C_BUS_DEFAULT_CREATE_ARGS();
+    args.i2c_port = TEST_PORT;
+
+    TEST_ESP_ERR(ESP_ERR_INVALID_STATE, i2c_bus_create(&args, &other));
+    TEST_ESP_OK(i2c_bus_get(TEST_PORT, &got));
+    TEST_ASSERT(got == bus);
+
+    TEST_ESP_OK(i2c_bus_delete(bus));
+    TEST_ESP_ERR(ESP_ERR_NOT_FOUND, i2c_bus_get(TEST_PORT, &got));
+}
+
+TEST_CASE("devices on the bus itself close open mux channels first", "[i2c_bus]")
+{
+    mux_t mux = { 0 };
+    mux_probe_t direct = { .mux = &mux, .expected = 0x00 };
+    mux_probe_t muxed  = { .mux = &mux, .expected = 1 << TEST_MUX_CHANNEL };
+    i2c_bus_sim_target_t mux_target = {
+        .write = _mux_write, .read = _mux_read, .ctx = &mux };
+    i2c_bus_sim_target_t direct_target = {
+        .write = _probe_write, .read = _probe_read, .ctx = &direct };
+    i2c_bus_sim_target_t muxed_target = {
+        .write = _probe_write, .read = _probe_read, .ctx = &muxed };
+    i2c_bus_mux_channel_t channel = {
+        .enable = true, .address = TEST_MUX_ADDRESS, .channel = TEST_MUX_CHANNEL
+    };
+
+    i2c_bus_device_handle_t direct_dev = NULL, muxed_dev = NULL;
+    i2c_bus_handle_t bus = _bus_create();
+    TEST_ESP_OK(i2c_bus_sim_attach(TEST_PORT, TEST_MUX_ADDRESS, &mux_target));
+    TEST_ESP_OK(i2c_bus_sim_attach(TEST_PORT, TEST_ADDRESS, &direct_target));
+    TEST_ESP_OK(i2c_bus_sim_attach(TEST_PORT, TEST_MUXED_ADDRESS, &muxed_target));
+    TEST_ESP_OK(i2c_bus_add_device(bus, "direct", TEST_ADDRESS, &direct_dev));
+    TEST_ESP_OK(i2c_bus_add_mux_device(
+        bus, "muxed", TEST_MUXED_ADDRESS, &channel, &muxed_dev));
+
+    // > Interleave (twice in a row each: the second one writes no mux)
+    uint8_t byte = 0;
+    i2c_bus_transaction_t w = I2C_BUS_TRANSACTION_WRITE(
+        &byte, 1, I2C_BUS_PRIORITY_NORMAL, TEST_TIMEOUT);
+    for (int i = 0; i < TEST_MUX_ROUNDS; i++) {
+        TEST_ESP_OK(i2c_bus_transfer(muxed_dev, &w, portMAX_DELAY));
+        TEST_ESP_OK(i2c_bus_transfer(muxed_dev, &w, portMAX_DELAY));
+        TEST_ESP_OK(i2c_bus_transfer(direct_dev, &w, portMAX_DELAY));
+        TEST_ESP_OK(i2c_bus_transfer(direct_dev, &w, portMAX_DELAY));
+    }
+    TEST_ASSERT_EQUAL(2 * TEST_MUX_ROUNDS, direct.accesses);
+    TEST_ASSERT_EQUAL(2 * TEST_MUX_ROUNDS, muxed.accesses);
+    TEST_ASSERT_EQUAL(0, direct.violations);
+    TEST_ASSERT_EQUAL(0, muxed.violations);
+
+    // > One open and one close per round, charged to the device that did it
+    i2c_bus_device_stats_t direct_stats, muxed_stats;
+    TEST_ESP_OK(i2c_bus_device_get_stats(direct_dev, &direct_stats));
+    TEST_ESP_OK(i2c_bus_device_get_stats(muxed_dev, &muxed_stats));
+    TEST_ASSERT_EQUAL(2 * TEST_MUX_ROUNDS, mux.writes);
+    TEST_ASSERT_EQUAL(TEST_MUX_ROUNDS, direct_stats.mux_selects);
+    TEST_ASSERT_EQUAL(TEST_MUX_ROUNDS, muxed_stats.mux_selects);
+
+    TEST_ESP_OK(i2c_bus_remove_device(direct_dev));
+    TEST_ESP_OK(i2c_bus_remove_device(muxed_dev));
+    TEST_ESP_OK(i2c_bus_sim_detach(TEST_PORT, TEST_MUX_ADDRESS));
+    TEST_ESP_OK(i2c_bus_sim_detach(TEST_PORT, TEST_ADDRESS));
+    TEST_ESP_OK(i2c_bus_sim_detach(TEST_PORT, TEST_MUXED_ADDRESS));
+    TEST_ESP_OK(i2c_bus_delete(bus));
+}
@@ -5,9 +5,13 @@
 
 #include <stdbool.h>    // bool
 #include <stdint.h>     // uint8_t, uint16_t, uint64_t
+#include <stddef.h>     // size_t
 #include "esp_err.h"    // esp_err_t
 #include "si7021_i2c.h" // si7021_i2c_create_args_t, si7021_i2c_handle_t
 
+#include "freertos/FreeRTOS.h" // TickType_t
+#include "freertos/queue.h"    // QueueHandle_t
+
 // -----------------------------------------------------------------------------
 
 // ENUMS -----------------------------------------------------------------------
@@ -57,6 +61,13 @@ typedef enum {
     SI7021_FW_VERSION_2_0 = 0x20,
 } si7021_fw_version_t;
 
+/* Si7021 Measure Kind (Async) */
+typedef enum {
+    SI7021_MEASURE_RH          , // RH only
+    SI7021_MEASURE_TEMP        , // Temperature only
+    SI7021_MEASURE_RH_AND_TEMP , // RH, then temperature from that measurement
+} si7021_measure_kind_t;
+
 // -----------------------------------------------------------------------------
 
 // STRUCTURES ------------------------------------------------------------------
@@ -64,6 +75,20 @@ typedef enum {
 /* Si7021 Handle */
 typedef struct si7021_handle *si7021_handle_t;
 
+/* Si7021 Measure Result (Async & Group) */
+typedef struct {
+    si7021_measure_kind_t kind;         // Requested measurement
+    esp_err_t             err;          // ESP_OK if values are valid
+    float                 rh_percent;   // Valid for RH and RH & temp
+    float                 temp_celsius; // Valid for temp and RH & temp
+} si7021_measure_result_t;
+
+/* Si7021 Async Measure Callback */
+typedef void (*si7021_measure_cb_t)(
+    si7021_handle_t                si7021 ,
+    si7021_measure_result_t const *result ,
+    void                          *arg    );
+
 /* Si7021 CRC Config */
 typedef struct {
     bool global; // For all commands with CRC support
@@ -75,18 +100,22 @@ typedef struct {
     bool snb;    // For last bytes of serial number [31:0]
 } si7021_crc_config_t;
 
-/* Si7021 Read Wait */
+/* Si7021 Read Wait (us) */
+/* Measurement waits are kept to the microsecond (see si7021_i2c measure);
+ * register, serial number and firmware reads sleep whole ticks, rounded up.
+ */
 typedef struct {
-    TickType_t global;     // For all commands reading data from the sensor
-
-    /* If 0, global is used */
-    TickType_t rh;         // For RH measurements
-    TickType_t temp;       // For temperature measurements
-    TickType_t user_reg;   // For reading the user register
-    TickType_t heater_reg; // For reading the heater register
-    TickType_t sna;        // For reading the serial number [63:32]
-    TickType_t snb;        // For reading the serial number [31:0]
-    TickType_t fw;         // For reading the firmware version
+    uint32_t global;     // For all commands reading data from the sensor
+
+    /* If 0, global is used. If both are 0 for rh or temp, the conversion
+     * time of the active resolution (plus margin) is used instead. */
+    uint32_t rh;         // For RH measurements
+    uint32_t temp;       // For temperature measurements
+    uint32_t user_reg;   // For reading the user register
+    uint32_t heater_reg; // For reading the heater register
+    uint32_t sna;        // For reading the serial number [63:32]
+    uint32_t snb;        // For reading the serial number [31:0]
+    uint32_t fw;         // For reading the firmware version
 } si7021_read_wait_t;
 
 /* Si7021 User Register Info */
@@ -140,6 +169,18 @@ typedef struct {
 
 //// KCONFIG -------------------------------------------------------------------
 
+/* Conversion Time Margin */
+#define SI7021_CONVERSION_MARGIN_US                                  /* 500 */ \
+        CONFIG_SI7021_CONVERSION_MARGIN_US
+
+/* Async Measurements */
+#define SI7021_ASYNC_QUEUE_LENGTH                                      /* 4 */ \
+        CONFIG_SI7021_ASYNC_QUEUE_LENGTH
+#define SI7021_ASYNC_READ_RETRIES                                      /* 3 */ \
+        CONFIG_SI7021_ASYNC_READ_RETRIES
+#define SI7021_ASYNC_READ_RETRY_US                                  /* 2000 */ \
+        CONFIG_SI7021_ASYNC_READ_RETRY_US
+
 ////// Si7021 Default Create Args ----------------------------------------------
 
 /* Handle name */
@@ -158,23 +199,23 @@ typedef struct {
 #define SI7021_DEFAULT_CRC_CONFIG_SNB                          /* (false) 0 */ \
         (bool)CONFIG_SI7021_DEFAULT_CRC_CONFIG_SNB
 
-/* Read Wait Timeouts (ms) */
-#define SI7021_DEFAULT_READ_WAIT_MS_GLOBAL                             /* 0 */ \
-        CONFIG_SI7021_DEFAULT_READ_WAIT_MS_GLOBAL
-#define SI7021_DEFAULT_READ_WAIT_MS_RH                                /* 30 */ \
-        CONFIG_SI7021_DEFAULT_READ_WAIT_MS_RH
-#define SI7021_DEFAULT_READ_WAIT_MS_TEMP                              /* 20 */ \
-        CONFIG_SI7021_DEFAULT_READ_WAIT_MS_TEMP
-#define SI7021_DEFAULT_READ_WAIT_MS_USER_REG                          /* 10 */ \
-        CONFIG_SI7021_DEFAULT_READ_WAIT_MS_USER_REG
-#define SI7021_DEFAULT_READ_WAIT_MS_HEATER_REG                        /* 10 */ \
-        CONFIG_SI7021_DEFAULT_READ_WAIT_MS_HEATER_REG
-#define SI7021_DEFAULT_READ_WAIT_MS_SNA                               /* 10 */ \
-        CONFIG_SI7021_DEFAULT_READ_WAIT_MS_SNA
-#define SI7021_DEFAULT_READ_WAIT_MS_SNB                               /* 10 */ \
-        CONFIG_SI7021_DEFAULT_READ_WAIT_MS_SNB
-#define SI7021_DEFAULT_READ_WAIT_MS_FW                                /* 10 */ \
-        CONFIG_SI7021_DEFAULT_READ_WAIT_MS_FW
+/* Read Wait Timeouts (us) */
+#define SI7021_DEFAULT_READ_WAIT_US_GLOBAL                             /* 0 */ \
+        CONFIG_SI7021_DEFAULT_READ_WAIT_US_GLOBAL
+#define SI7021_DEFAULT_READ_WAIT_US_RH                                 /* 0 */ \
+        CONFIG_SI7021_DEFAULT_READ_WAIT_US_RH
+#define SI7021_DEFAULT_READ_WAIT_US_TEMP                               /* 0 */ \
+        CONFIG_SI7021_DEFAULT_READ_WAIT_US_TEMP
+#define SI7021_DEFAULT_READ_WAIT_US_USER_REG                       /* 10000 */ \
+        CONFIG_SI7021_DEFAULT_READ_WAIT_US_USER_REG
+#define SI7021_DEFAULT_READ_WAIT_US_HEATER_REG                     /* 10000 */ \
+        CONFIG_SI7021_DEFAULT_READ_WAIT_US_HEATER_REG
+#define SI7021_DEFAULT_READ_WAIT_US_SNA                            /* 10000 */ \
+        CONFIG_SI7021_DEFAULT_READ_WAIT_US_SNA
+#define SI7021_DEFAULT_READ_WAIT_US_SNB                            /* 10000 */ \
+        CONFIG_SI7021_DEFAULT_READ_WAIT_US_SNB
+#define SI7021_DEFAULT_READ_WAIT_US_FW                             /* 10000 */ \
+        CONFIG_SI7021_DEFAULT_READ_WAIT_US_FW
 
 /* At Init Options */
 #define SI7021_DEFAULT_AT_INIT_RESET                            /* (true) 1 */ \
@@ -224,16 +265,14 @@ typedef struct {
         .snb    = SI7021_DEFAULT_CRC_CONFIG_SNB                                \
     },                                                                         \
     .read_wait = {                                                             \
-        .global     = SI7021_DEFAULT_READ_WAIT_MS_GLOBAL / portTICK_PERIOD_MS, \
-        .rh         = SI7021_DEFAULT_READ_WAIT_MS_RH / portTICK_PERIOD_MS,     \
-        .temp       = SI7021_DEFAULT_READ_WAIT_MS_TEMP / portTICK_PERIOD_MS,   \
-        .user_reg   = SI7021_DEFAULT_READ_WAIT_MS_USER_REG                     \
-            / portTICK_PERIOD_MS,                                              \
-        .heater_reg = SI7021_DEFAULT_READ_WAIT_MS_HEATER_REG                   \
-            / portTICK_PERIOD_MS,                                              \
-        .sna        = SI7021_DEFAULT_READ_WAIT_MS_SNA / portTICK_PERIOD_MS,    \
-        .snb        = SI7021_DEFAULT_READ_WAIT_MS_SNB / portTICK_PERIOD_MS,    \
-        .fw         = SI7021_DEFAULT_READ_WAIT_MS_FW / portTICK_PERIOD_MS      \
+        .global     = SI7021_DEFAULT_READ_WAIT_US_GLOBAL,                      \
+        .rh         = SI7021_DEFAULT_READ_WAIT_US_RH,                          \
+        .temp       = SI7021_DEFAULT_READ_WAIT_US_TEMP,                        \
+        .user_reg   = SI7021_DEFAULT_READ_WAIT_US_USER_REG,                    \
+        .heater_reg = SI7021_DEFAULT_READ_WAIT_US_HEATER_REG,                  \
+        .sna        = SI7021_DEFAULT_READ_WAIT_US_SNA,                         \
+        .snb        = SI7021_DEFAULT_READ_WAIT_US_SNB,                         \
+        .fw         = SI7021_DEFAULT_READ_WAIT_US_FW                           \
     },                                                                         \
     .at_init = {                                                               \
         .reset = SI7021_DEFAULT_AT_INIT_RESET,                                 \
@@ -350,6 +389,16 @@ float si7021_convert_rh(
 float si7021_convert_temp(
     uint16_t temp_code );
 
+/* Conversion (fixed point) */
+/* Integer only (multiply & shift): hundredths of %RH (0 to 10000) and of ºC.
+ * Rounded to nearest, so within one hundredth of the float conversion.
+ */
+int32_t si7021_convert_rh_centi(
+    uint16_t rh_code );
+
+int32_t si7021_convert_temp_centi(
+    uint16_t temp_code );
+
 float si7021_calc_heater_level(
     uint8_t heater_level );
 
@@ -361,6 +410,11 @@ esp_err_t si7021_create(
 esp_err_t si7021_delete(
     si7021_handle_t si7021 );
 
+/* I2C Handle (owned by <si7021>; e.g. for si7021_i2c_get_stats) */
+esp_err_t si7021_get_i2c_handle(
+    si7021_handle_t     const  si7021     ,
+    si7021_i2c_handle_t       *out_handle );
+
 /* CRC Config */
 esp_err_t si7021_get_crc_config(
     si7021_handle_t     const si7021           ,
@@ -379,6 +433,17 @@ esp_err_t si7021_set_read_wait(
     si7021_handle_t    const  si7021     ,
     si7021_read_wait_t const *read_wait );
 
+/* Conversion Time */
+/* Datasheet maximum conversion time of <kind> plus SI7021_CONVERSION_MARGIN_US,
+ * for the resolution last written to (or read from) the user register. It is
+ * RH12_TEMP14 (the slowest) after create and reset. An RH measurement also
+ * converts temperature, so its time includes both.
+ */
+esp_err_t si7021_get_conversion_time_us(
+    si7021_handle_t       const  si7021          ,
+    si7021_measure_kind_t        kind              ,
+    uint32_t                    *out_conversion_us );
+
 /* Measurement */
 esp_err_t si7021_measure_rh(
     si7021_handle_t const  si7021          ,
@@ -388,20 +453,82 @@ esp_err_t si7021_measure_temp(
     si7021_handle_t const  si7021            ,
     float                 *out_temp_celsius );
 
-/* Internally, this function only needs to call si7021_measure_rh, as issuing
- * a 'Measure RH' command automatically takes a temperature measurement too,
- * whose value can be retrieved with a specific command without issuing a
- * 'Measure Temp' command again.
+/* Measurement (fixed point, see si7021_convert_rh_centi) */
+esp_err_t si7021_measure_rh_centi(
+    si7021_handle_t const  si7021        ,
+    int32_t               *out_rh_centi );
+
+esp_err_t si7021_measure_temp_centi(
+    si7021_handle_t const  si7021          ,
+    int32_t               *out_temp_centi );
+
+/* Issuing a 'Measure RH' command automatically takes a temperature measurement
+ * too, whose value can be retrieved with a specific command without issuing a
+ * 'Measure Temp' command again. That command needs no wait, so it goes as one
+ * write-read right after the RH read (see si7021_i2c_measure_rh_and_temp_*).
  */
 esp_err_t si7021_measure_rh_and_temp(
     si7021_handle_t const  si7021            ,
     float                 *out_rh_percent    ,
     float                 *out_temp_celsius );
 
+/* Measurement (Group) */
+/* Measures <count> sensors (e.g. on one bus behind mux channels, see
+ * si7021_i2c_create_args_t) in about one conversion time: the no hold master
+ * commands are written back to back, the task waits once for the slowest
+ * conversion, and then all results are read. Each result carries its own
+ * error; the first one is returned. Like other blocking commands, it must not
+ * be used while async requests are in flight on any of the handles.
+ */
+esp_err_t si7021_measure_group(
+    si7021_handle_t         const *si7021s     ,
+    size_t                         count       ,
+    si7021_measure_kind_t          kind        ,
+    si7021_measure_result_t       *out_results );
+
+/* Measurement (Async) */
+/* The no hold master command is issued right away (or when the requests ahead
+ * of it are done) and the result is read by a one-shot esp_timer at the
+ * conversion deadline (RH or temp read wait, or else the conversion time of
+ * the active resolution), so the caller never blocks for the conversion. Up
+ * to SI7021_ASYNC_QUEUE_LENGTH requests are kept in flight and served in
+ * order, back to back; ESP_ERR_NO_MEM is returned when full.
+ *
+ * <cb> runs in the esp_timer task (or in the caller, if the command cannot be
+ * issued), so it must be short. The _to_queue variant sends the result
+ * (si7021_measure_result_t sized items) to <queue> without waiting instead.
+ *
+ * Blocking commands must not be issued while async requests are in flight.
+ * At si7021_delete pending requests are dropped without calling back; the
+ * one in flight is cancelled if its read is not due yet, or else waited for
+ * (callback included) before the handle is freed.
+ */
+esp_err_t si7021_measure_async(
+    si7021_handle_t       const  si7021 ,
+    si7021_measure_kind_t        kind   ,
+    si7021_measure_cb_t          cb     ,
+    void                        *arg    );
+
+esp_err_t si7021_measure_async_to_queue(
+    si7021_handle_t       const si7021 ,
+    si7021_measure_kind_t       kind   ,
+    QueueHandle_t               queue  );
+
 /* Reset */
+/* Invalidates the register shadows: they are read back on next access. */
 esp_err_t si7021_reset(
     si7021_handle_t const si7021 );
 
+/* Register Shadows */
+/* The handle keeps a copy of User Register 1 and the Heater Control Register,
+ * loaded at si7021_create. Getters are served from the copies and setters do a
+ * single write, so no read-modify-write goes to the bus. The copies are only
+ * wrong if something else writes the registers (another master, a brown-out
+ * reset); si7021_sync_registers reads both back from the device.
+ */
+esp_err_t si7021_sync_registers(
+    si7021_handle_t const si7021 );
+
 /* User Register Control */
 esp_err_t si7021_get_user_register_info(
     si7021_handle_t             const  si7021                  ,
@@ -414,10 +541,9 @@ esp_err_t si7021_set_user_register_info(
 
 /* User Register Control (derived)*/
 /* Internally, these functions use si7021_get_user_register_info and
- * si7021_get_user_register_info, as these two functions read and write over
- * the same Si7021 register. As such, if the user wishes to check or modify both
- * resolution and heater state, it is more efficient to use the previous two
- * functions.
+ * si7021_set_user_register_info over the register shadow: getters do no I/O
+ * and setters a single write. si7021_get_vdd_status is the exception, as VDD
+ * status is live: it reads the register back.
  */
 esp_err_t si7021_get_resolution(
     si7021_handle_t     const  si7021          ,
@@ -0,0 +1,146 @@
+#ifndef __SI7021_HEATER_H__
+#define __SI7021_HEATER_H__
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>             // uint8_t, uint32_t
+#include "esp_err.h"            // esp_err_t
+#include "freertos/FreeRTOS.h"  // UBaseType_t
+#include "si7021.h"             // si7021_handle_t
+
+// -----------------------------------------------------------------------------
+
+// ENUMS -----------------------------------------------------------------------
+
+/* Si7021 Heater Controller State */
+typedef enum {
+    SI7021_HEATER_CTRL_IDLE    , // Checking RH every period
+    SI7021_HEATER_CTRL_HEATING , // Pulse on: measurements paused
+    SI7021_HEATER_CTRL_COOLING , // Pulse done: readings compensated
+} si7021_heater_ctrl_state_t;
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+//// KCONFIG -------------------------------------------------------------------
+
+#define SI7021_HEATER_DEFAULT_CHECK_PERIOD_MS                      /* 10000 */ \
+        CONFIG_SI7021_HEATER_DEFAULT_CHECK_PERIOD_MS
+#define SI7021_HEATER_DEFAULT_RH_TRIGGER                              /* 95 */ \
+        CONFIG_SI7021_HEATER_DEFAULT_RH_TRIGGER
+#define SI7021_HEATER_DEFAULT_LEVEL                                 /* 0x0F */ \
+        CONFIG_SI7021_HEATER_DEFAULT_LEVEL
+#define SI7021_HEATER_DEFAULT_PULSE_MS                             /* 30000 */ \
+        CONFIG_SI7021_HEATER_DEFAULT_PULSE_MS
+#define SI7021_HEATER_DEFAULT_COOLDOWN_MS                          /* 60000 */ \
+        CONFIG_SI7021_HEATER_DEFAULT_COOLDOWN_MS
+#define SI7021_HEATER_DEFAULT_TAU_MS                               /* 15000 */ \
+        CONFIG_SI7021_HEATER_DEFAULT_TAU_MS
+#define SI7021_HEATER_DEFAULT_HOLDOFF_MS                          /* 600000 */ \
+        CONFIG_SI7021_HEATER_DEFAULT_HOLDOFF_MS
+#define SI7021_HEATER_DEFAULT_TASK_PRIORITY                            /* 2 */ \
+        CONFIG_SI7021_HEATER_DEFAULT_TASK_PRIORITY
+#define SI7021_HEATER_DEFAULT_TASK_STACK_SIZE                       /* 3072 */ \
+        CONFIG_SI7021_HEATER_DEFAULT_TASK_STACK_SIZE
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Si7021 Heater Controller Handle */
+typedef struct si7021_heater_ctrl *si7021_heater_ctrl_handle_t;
+
+/* Si7021 Heater Controller Create Args */
+typedef struct {
+    si7021_handle_t si7021;          // Controlled sensor (owned by the caller)
+    uint32_t        check_period_ms; // RH check period while idle
+    float           rh_trigger;      // %RH that starts a pulse
+    uint8_t         level;           // Heater level during a pulse
+    uint32_t        pulse_ms;        // Heater on time (bounded)
+    uint32_t        cooldown_ms;     // Compensated readings after a pulse
+    uint32_t        tau_ms;          // Self-heating decay time constant
+    uint32_t        holdoff_ms;      // From end of cooldown to next pulse
+    UBaseType_t     task_priority;   // Controller task priority
+    uint32_t        task_stack_size; // Controller task stack size
+} si7021_heater_ctrl_create_args_t;
+
+/* Si7021 Heater Controller Status */
+typedef struct {
+    si7021_heater_ctrl_state_t state;          // Current state
+    uint32_t                   pulses;         // Pulses run so far
+    float                      offset_celsius; // Self-heating now subtracted
+} si7021_heater_ctrl_status_t;
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+/* Si7021 Heater Controller Default Create Args (si7021 must be set) */
+#define SI7021_HEATER_CTRL_DEFAULT_CREATE_ARGS() {                             \
+    .si7021          = NULL,                                                   \
+    .check_period_ms = SI7021_HEATER_DEFAULT_CHECK_PERIOD_MS,                  \
+    .rh_trigger      = SI7021_HEATER_DEFAULT_RH_TRIGGER,                       \
+    .level           = SI7021_HEATER_DEFAULT_LEVEL,                            \
+    .pulse_ms        = SI7021_HEATER_DEFAULT_PULSE_MS,                         \
+    .cooldown_ms     = SI7021_HEATER_DEFAULT_COOLDOWN_MS,                      \
+    .tau_ms          = SI7021_HEATER_DEFAULT_TAU_MS,                           \
+    .holdoff_ms      = SI7021_HEATER_DEFAULT_HOLDOFF_MS,                       \
+    .task_priority   = SI7021_HEATER_DEFAULT_TASK_PRIORITY,                    \
+    .task_stack_size = SI7021_HEATER_DEFAULT_TASK_STACK_SIZE                   \
+}
+
+/* Si7021 Heater Controller State to String */
+#define SI7021_HEATER_CTRL_STATE_TO_STRING(state) (                            \
+    (state == SI7021_HEATER_CTRL_IDLE)    ? "Idle"    :                        \
+    (state == SI7021_HEATER_CTRL_HEATING) ? "Heating" :                        \
+    (state == SI7021_HEATER_CTRL_COOLING) ? "Cooling" :                        \
+    "Unknown"                                                                  \
+)
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS -------------------------------------------------------------------
+
+/* Create & Delete */
+/* The controller runs in its own task, never blocking the caller nor the
+ * esp_timer task: while idle it checks RH every period and, near saturation,
+ * turns the heater on for a bounded pulse to evaporate condensation, then lets
+ * the die cool down. Delete waits for a check in progress, then leaves the
+ * heater off.
+ */
+esp_err_t si7021_heater_ctrl_create(
+    si7021_heater_ctrl_create_args_t const *create_args ,
+    si7021_heater_ctrl_handle_t            *out_handle  );
+
+esp_err_t si7021_heater_ctrl_delete(
+    si7021_heater_ctrl_handle_t ctrl );
+
+/* Measurement (through the controller) */
+/* While the controller runs, measure through these instead of si7021_measure_*
+ * so the sensor is never commanded by two tasks at once:
+ *  - Idle:    live readings.
+ *  - Heating: measurements paused; the last readings before the pulse.
+ *  - Cooling: live readings minus the self-heating offset, which decays
+ *             exponentially from the one seen right after the pulse. RH is
+ *             corrected to the compensated temperature (Magnus ratio).
+ */
+esp_err_t si7021_heater_ctrl_measure_temp(
+    si7021_heater_ctrl_handle_t const  ctrl             ,
+    float                             *out_temp_celsius );
+
+esp_err_t si7021_heater_ctrl_measure_rh_and_temp(
+    si7021_heater_ctrl_handle_t const  ctrl             ,
+    float                             *out_rh_percent   ,
+    float                             *out_temp_celsius );
+
+/* Status */
+esp_err_t si7021_heater_ctrl_get_status(
+    si7021_heater_ctrl_handle_t const  ctrl       ,
+    si7021_heater_ctrl_status_t       *out_status );
+
+// -----------------------------------------------------------------------------
+
+#endif // __SI7021_HEATER_H__
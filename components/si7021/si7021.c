@@ -4,8 +4,13 @@
 
 #include "string.h"     // for strncpy
 #include "esp_err.h"    // for ESP errors
+#include "esp_timer.h"  // for async conversion deadline timer
 #include "si7021_i2c.h" // for Si7021 I2C API
 
+#include "freertos/FreeRTOS.h" // for FreeRTOS
+#include "freertos/task.h"     // for vTaskDelay (group measurement)
+#include "freertos/semphr.h"   // for async stop handshake at delete
+
 /* Logging */
 #include "esp_log.h"
 static const char *TAG = "Si7021";
@@ -14,6 +19,13 @@ static const char *TAG = "Si7021";
 
 // STRUCTURES ------------------------------------------------------------------
 
+/* Si7021 Async Request */
+typedef struct {
+    si7021_measure_kind_t  kind; // Requested measurement
+    si7021_measure_cb_t    cb;   // Completion callback
+    void                  *arg;  // Callback argument
+} si7021_async_request_t;
+
 /* Si7021 Handle */
 struct si7021_handle {
     char name[SI7021_HANDLE_NAME_LENGTH]; // Handle name
@@ -21,6 +33,31 @@ struct si7021_handle {
     si7021_i2c_handle_t i2c;        // Si7021 I2C handle
     si7021_crc_config_t crc_config; // CRC config
     si7021_read_wait_t  read_wait;  // Read wait timeouts
+    si7021_resolution_t resolution; // Last known user register resolution
+
+    /* Register shadows */
+    struct {
+        bool    user_valid;   // user_reg mirrors the device
+        bool    heater_valid; // heater_reg mirrors the device
+        uint8_t user_reg;     // User Register 1 copy
+        uint8_t heater_reg;   // Heater Control Register copy
+    } shadow;
+
+    /* Async measurements */
+    /* current & retries belong to whoever runs the request in flight (busy):
+     * the issuing caller, then the timer callback. The rest is locked. */
+    struct {
+        esp_timer_handle_t     timer;   // Conversion deadline timer
+        SemaphoreHandle_t      stopped; // Given when idle after delete started
+        portMUX_TYPE           lock;    // Protects ring, busy & running
+        bool                   running; // Cleared at delete
+        bool                   busy;    // Current request in flight
+        uint8_t                head;    // Next request in ring
+        uint8_t                count;   // Requests in ring
+        uint8_t                retries; // Read retries of current request
+        si7021_async_request_t current; // Request in flight
+        si7021_async_request_t ring[SI7021_ASYNC_QUEUE_LENGTH];
+    } async;
 };
 
 // -----------------------------------------------------------------------------
@@ -47,15 +84,24 @@ struct si7021_handle {
         return ESP_ERR_NO_MEM;                                                 \
     }
 
-#define CHECK_ERR_SI7021_I2C_CREATE(err)                                       \
+#define CHECK_ERR_SI7021_I2C_CREATE(err, si7021)                               \
     if (err) {                                                                 \
         ESP_LOGE(TAG, "Could not create Si7021 I2C handle.");                  \
+        free(si7021);                                                          \
         return err;                                                            \
     }
 
-#define LOG_ERR_SI7021_AT_INIT(err, phase)                                     \
+#define CHECK_ERR_SI7021_AT_INIT(err, si7021)                                  \
+    if (err) {                                                                 \
+        si7021_i2c_delete(si7021->i2c);                                        \
+        free(si7021);                                                          \
+        return err;                                                            \
+    }
+
+#define LOG_ERR_SI7021_AT_INIT(err, phase) {                                   \
     ESP_LOGE(TAG, "Could not %s Si7021 at init.", phase);                      \
-    return err;
+    return err;                                                                \
+}
 
 #define CHECK_WARN_SI7021_I2C_DELETE(err)                                      \
     if (err) {                                                                 \
@@ -63,6 +109,24 @@ struct si7021_handle {
             esp_err_to_name(err));                                             \
     }
 
+#define CHECK_ERR_ASYNC_SEMAPHORE_CREATE(semaphore, si7021)                    \
+    if (!semaphore) {                                                          \
+        ESP_LOGE(TAG, "Could not create async stop semaphore.");               \
+        si7021_i2c_delete(si7021->i2c);                                        \
+        free(si7021);                                                          \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+#define CHECK_ERR_ASYNC_TIMER_CREATE(err, si7021)                              \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not create async timer: %s",                      \
+            esp_err_to_name(err));                                             \
+        vSemaphoreDelete(si7021->async.stopped);                               \
+        si7021_i2c_delete(si7021->i2c);                                        \
+        free(si7021);                                                          \
+        return err;                                                            \
+    }
+
 //// ---------------------------------------------------------------------------
 
 //// HANDLE & IN/OUT PARAM ERRORS ----------------------------------------------
@@ -101,11 +165,22 @@ struct si7021_handle {
         return err;                                                            \
     }
 
-#define CHECK_ERR_SI7021_I2C_MEASURE_TEMP_FROM_PREV_RH_MEASUREMENT(err)        \
+//// ---------------------------------------------------------------------------
+
+//// ASYNC MEASUREMENT ERRORS --------------------------------------------------
+
+#define CHECK_ERR_MEASURE_KIND(kind)                                           \
+    if (kind != SI7021_MEASURE_RH   &&                                         \
+        kind != SI7021_MEASURE_TEMP &&                                         \
+        kind != SI7021_MEASURE_RH_AND_TEMP) {                                  \
+        ESP_LOGE(TAG, "Unknown measure kind %d.", (int) kind);                 \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_ASYNC_QUEUE_FULL(err)                                        \
     if (err) {                                                                 \
-        ESP_LOGE(TAG, "Si7021 I2C read temp from previous RH measurement "     \
-                      "command failed."                                        \
-        );                                                                     \
+        ESP_LOGE(TAG, "Async request queue is full (%d requests).",            \
+            SI7021_ASYNC_QUEUE_LENGTH);                                        \
         return err;                                                            \
     }
 
@@ -183,6 +258,58 @@ struct si7021_handle {
 
 // PRIVATE FUNCTIONS -----------------------------------------------------------
 
+/* Read Wait of a register, serial number or firmware read: the global one if
+ * set, else <wait_us> (ticks, rounded up) */
+static TickType_t _si7021_read_wait_ticks(
+    si7021_handle_t const si7021  ,
+    uint32_t              wait_us )
+{
+    uint32_t tick_us = portTICK_PERIOD_MS * 1000;
+    if (si7021->read_wait.global) wait_us = si7021->read_wait.global;
+    return (wait_us + tick_us - 1) / tick_us;
+}
+
+/* Register shadows: load User Register 1 */
+static esp_err_t _si7021_shadow_load_user_reg(
+    si7021_handle_t const si7021 )
+{
+    esp_err_t err = ESP_OK;
+
+    uint8_t    user_register = 0;
+    TickType_t read_wait     = _si7021_read_wait_ticks(
+        si7021, si7021->read_wait.user_reg);
+    err = si7021_i2c_read_user_reg_1(si7021->i2c, &user_register, read_wait);
+    CHECK_ERR_SI7021_I2C_READ_USER_REG(err);
+
+    si7021->shadow.user_reg   = user_register;
+    si7021->shadow.user_valid = true;
+    si7021->resolution = (si7021_resolution_t)(
+        user_register & SI7021_USER_REGISTER_MASK_RESOLUTION);
+
+    return err;
+}
+
+/* Register shadows: load Heater Control Register */
+static esp_err_t _si7021_shadow_load_heater_reg(
+    si7021_handle_t const si7021 )
+{
+    esp_err_t err = ESP_OK;
+
+    uint8_t    heater_register = 0;
+    TickType_t read_wait       = _si7021_read_wait_ticks(
+        si7021, si7021->read_wait.heater_reg);
+    err = si7021_i2c_read_heater_control_reg(
+        si7021->i2c      ,
+        &heater_register ,
+        read_wait       );
+    CHECK_ERR_SI7021_I2C_READ_HEATER_CONTROL_REG(err);
+
+    si7021->shadow.heater_reg   = heater_register;
+    si7021->shadow.heater_valid = true;
+
+    return err;
+}
+
 /* Create: at init */
 esp_err_t _si7021_at_init(
     si7021_handle_t      const  si7021      ,
@@ -214,6 +341,11 @@ esp_err_t _si7021_at_init(
         )) != ESP_OK
     ) LOG_ERR_SI7021_AT_INIT(err, "set user register info");
 
+    // > Load register shadows
+    if (
+        (err = si7021_sync_registers(si7021))
+    ) LOG_ERR_SI7021_AT_INIT(err, "load register shadows");
+
     // > Dump device info?
     if (
         create_args->at_init.dump.device_info &&
@@ -240,21 +372,21 @@ inline esp_err_t _si7021_i2c_measure_rh(
     si7021_i2c_handle_t  i2c           ,
     uint16_t            *out_rh_code   ,
     bool                 crc_config    ,
-    TickType_t           read_wait     )
+    uint32_t             read_wait_us  )
 {
 #ifdef CONFIG_SI7021_USE_MEASURE_RH_HOLD_MASTER
     return si7021_i2c_measure_rh_hold_master(
         i2c,
         out_rh_code,
         crc_config,
-        read_wait
+        read_wait_us
     );
 #else
     return si7021_i2c_measure_rh_nohold_master(
         i2c,
         out_rh_code,
         crc_config,
-        read_wait
+        read_wait_us
     );
 #endif
 }
@@ -264,25 +396,219 @@ inline esp_err_t _si7021_i2c_measure_temp(
     si7021_i2c_handle_t  i2c           ,
     uint16_t            *out_temp_code ,
     bool                 crc_config    ,
-    TickType_t           read_wait     )
+    uint32_t             read_wait_us  )
 {
-#ifdef SI7021_USE_MEASURE_TEMP_HOLD_MASTER
+#ifdef CONFIG_SI7021_USE_MEASURE_TEMP_HOLD_MASTER
     return si7021_i2c_measure_temp_hold_master(
         i2c,
         out_temp_code,
         crc_config,
-        read_wait
+        read_wait_us
     );
 #else
     return si7021_i2c_measure_temp_nohold_master(
         i2c,
         out_temp_code,
         crc_config,
-        read_wait
+        read_wait_us
     );
 #endif
 }
 
+/* Si7021 I2C Measure RH and Temp */
+inline esp_err_t _si7021_i2c_measure_rh_and_temp(
+    si7021_i2c_handle_t  i2c           ,
+    uint16_t            *out_rh_code   ,
+    uint16_t            *out_temp_code ,
+    bool                 crc_config    ,
+    uint32_t             read_wait_us  )
+{
+#ifdef CONFIG_SI7021_USE_MEASURE_RH_HOLD_MASTER
+    return si7021_i2c_measure_rh_and_temp_hold_master(
+        i2c,
+        out_rh_code,
+        out_temp_code,
+        crc_config,
+        read_wait_us
+    );
+#else
+    return si7021_i2c_measure_rh_and_temp_nohold_master(
+        i2c,
+        out_rh_code,
+        out_temp_code,
+        crc_config,
+        read_wait_us
+    );
+#endif
+}
+
+//// Conversion Time -----------------------------------------------------------
+
+/* Max Conversion Times (us, datasheet table 2) */
+typedef struct {
+    uint32_t rh;   // RH conversion only (a measurement adds temp)
+    uint32_t temp; // Temperature conversion
+} si7021_conversion_us_t;
+
+static si7021_conversion_us_t _si7021_conversion_us_of(
+    si7021_resolution_t resolution )
+{
+    switch (resolution) {
+        case SI7021_RESOLUTION_RH08_TEMP12:
+            return (si7021_conversion_us_t) { .rh =  3100, .temp =  3800 };
+        case SI7021_RESOLUTION_RH10_TEMP13:
+            return (si7021_conversion_us_t) { .rh =  4500, .temp =  6200 };
+        case SI7021_RESOLUTION_RH11_TEMP11:
+            return (si7021_conversion_us_t) { .rh =  7000, .temp =  2400 };
+        case SI7021_RESOLUTION_RH12_TEMP14:
+        default:
+            return (si7021_conversion_us_t) { .rh = 12000, .temp = 10800 };
+    }
+}
+
+/* Conversion Time of <kind> at the active resolution (us, with margin) */
+static uint32_t _si7021_conversion_us(
+    si7021_handle_t       const si7021 ,
+    si7021_measure_kind_t       kind   )
+{
+    si7021_conversion_us_t conv = _si7021_conversion_us_of(si7021->resolution);
+    return SI7021_CONVERSION_MARGIN_US + (kind == SI7021_MEASURE_TEMP
+        ? conv.temp
+        : conv.rh + conv.temp);
+}
+
+/* Measure Wait of <kind> (us): read wait if set, else conversion time */
+static uint32_t _si7021_measure_wait_us(
+    si7021_handle_t       const si7021 ,
+    si7021_measure_kind_t       kind   )
+{
+    uint32_t read_wait_us = si7021->read_wait.global
+        ? si7021->read_wait.global
+        : kind == SI7021_MEASURE_TEMP
+            ? si7021->read_wait.temp
+            : si7021->read_wait.rh;
+    return read_wait_us
+        ? read_wait_us
+        : _si7021_conversion_us(si7021, kind);
+}
+
+/* Measure Finish: convert the read <code> into <result> (and read the
+ * temperature of the same conversion for RH & temp, in a single attempt as
+ * it may run in the esp_timer task) */
+static void _si7021_measure_finish(
+    si7021_handle_t         const  si7021 ,
+    uint16_t                       code   ,
+    si7021_measure_result_t       *result )
+{
+    if (result->kind == SI7021_MEASURE_TEMP) {
+        result->temp_celsius = si7021_convert_temp(code);
+        return;
+    }
+
+    result->rh_percent = si7021_convert_rh(code);
+    if (result->kind == SI7021_MEASURE_RH_AND_TEMP) {
+        uint16_t temp_code = 0;
+        result->err = si7021_i2c_read_prev_temp_result(
+            si7021->i2c, &temp_code);
+        result->temp_celsius = si7021_convert_temp(temp_code);
+    }
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Async Measurements --------------------------------------------------------
+
+/* Async: Deliver Result of Current Request */
+static void _si7021_async_deliver(
+    si7021_handle_t         const  si7021 ,
+    si7021_measure_result_t const *result )
+{
+    if (si7021->async.current.cb)
+        si7021->async.current.cb(si7021, result, si7021->async.current.arg);
+}
+
+/* Async: Issue Next Request (or go idle) */
+/* Once the conversion timer is armed the handle is not touched again here,
+ * nor in the timer callback: si7021_delete relies on it (see there).
+ */
+static void _si7021_async_next(
+    si7021_handle_t const si7021 )
+{
+    while (1) {
+        // > Pop Request (going idle at delete: let it free the handle)
+        portENTER_CRITICAL(&si7021->async.lock);
+        if (!si7021->async.count || !si7021->async.running) {
+            bool stopped = !si7021->async.running;
+            si7021->async.busy = false;
+            portEXIT_CRITICAL(&si7021->async.lock);
+            if (stopped) xSemaphoreGive(si7021->async.stopped);
+            return;
+        }
+        si7021->async.current = si7021->async.ring[si7021->async.head];
+        si7021->async.head    = (si7021->async.head + 1) % SI7021_ASYNC_QUEUE_LENGTH;
+        si7021->async.count--;
+        portEXIT_CRITICAL(&si7021->async.lock);
+
+        // > Issue Measure Command & Schedule Read at Conversion Deadline
+        si7021_measure_kind_t kind = si7021->async.current.kind;
+        esp_err_t err = kind == SI7021_MEASURE_TEMP
+            ? si7021_i2c_start_measure_temp(si7021->i2c)
+            : si7021_i2c_start_measure_rh(si7021->i2c);
+        if (!err) {
+            si7021->async.retries = 0;
+            err = esp_timer_start_once(
+                si7021->async.timer                          ,
+                _si7021_measure_wait_us(si7021, kind)       );
+        }
+        if (!err) return;
+
+        // > Could not issue: report and go on with the next one
+        si7021_measure_result_t result = { .kind = kind, .err = err };
+        _si7021_async_deliver(si7021, &result);
+    }
+}
+
+/* Async: Conversion Deadline Timer Callback */
+static void _si7021_async_timer_cb(
+    void *arg )
+{
+    si7021_handle_t         si7021 = (si7021_handle_t) arg;
+    si7021_measure_kind_t   kind   = si7021->async.current.kind;
+    si7021_measure_result_t result = { .kind = kind };
+
+    // > Read Result
+    uint16_t code      = 0;
+    bool     crc_check = si7021->crc_config.global || (
+        kind == SI7021_MEASURE_TEMP
+            ? si7021->crc_config.temp
+            : si7021->crc_config.rh );
+    result.err = si7021_i2c_read_measure_result(si7021->i2c, &code, crc_check);
+
+    // > Still converting (NACK): try again a bit later
+    if (result.err == ESP_FAIL &&
+        si7021->async.retries < SI7021_ASYNC_READ_RETRIES) {
+        si7021->async.retries++;
+        if (esp_timer_start_once(
+                si7021->async.timer, SI7021_ASYNC_READ_RETRY_US) == ESP_OK)
+            return;
+    }
+
+    // > Convert (and read temperature from the same RH measurement)
+    if (!result.err) _si7021_measure_finish(si7021, code, &result);
+
+    _si7021_async_deliver(si7021, &result);
+    _si7021_async_next(si7021);
+}
+
+/* Async: Queue Callback (for si7021_measure_async_to_queue) */
+static void _si7021_async_queue_cb(
+    si7021_handle_t                si7021 ,
+    si7021_measure_result_t const *result ,
+    void                          *arg    )
+{ xQueueSend((QueueHandle_t) arg, result, 0); }
+
+//// ---------------------------------------------------------------------------
+
 // -----------------------------------------------------------------------------
 
 // PUBLIC FUNCTIONS ------------------------------------------------------------
@@ -293,16 +619,32 @@ inline esp_err_t _si7021_i2c_measure_temp(
 float si7021_convert_rh(
     uint16_t rh_code )
 {
-    float rh = (125.0 * (float) rh_code) / 65536.0 - 6.0;
-    return rh < 0.0   ? 0.0 
-         : rh > 100.0 ? 100.0
+    float rh = (125.0f * (float) rh_code) / 65536.0f - 6.0f;
+    return rh < 0.0f   ? 0.0f
+         : rh > 100.0f ? 100.0f
          : rh;
 }
 
 /* Get temperature in Celsius from 16-bit temperature code*/
 float si7021_convert_temp(
     uint16_t temp_code )
-{ return (175.72 * (float) temp_code) / 65536.0 - 46.85; }
+{ return (175.72f * (float) temp_code) / 65536.0f - 46.85f; }
+
+/* Fixed point: code * scale / 2^16, rounded, with scale in hundredths. The
+ * products fit in 32 bits (17572 * 65535 < 2^31), so there is no division
+ * and no floating point. */
+int32_t si7021_convert_rh_centi(
+    uint16_t rh_code )
+{
+    int32_t rh = (int32_t) ((12500u * rh_code + 0x8000u) >> 16) - 600;
+    return rh < 0     ? 0
+         : rh > 10000 ? 10000
+         : rh;
+}
+
+int32_t si7021_convert_temp_centi(
+    uint16_t temp_code )
+{ return (int32_t) ((17572u * temp_code + 0x8000u) >> 16) - 4685; }
 
 /* Get current (mA) from heater level code */
 float si7021_calc_heater_level(
@@ -369,7 +711,7 @@ esp_err_t si7021_create(
     // > Create Si7021 I2C handle
     si7021_i2c_handle_t i2c = NULL;
     err = si7021_i2c_create(&create_args->i2c, &i2c);
-    CHECK_ERR_SI7021_I2C_CREATE(err);
+    CHECK_ERR_SI7021_I2C_CREATE(err, (*out_handle));
 
     // > Set Handle
     /* Name */
@@ -379,10 +721,34 @@ esp_err_t si7021_create(
     (*out_handle)->i2c = i2c;
     (*out_handle)->crc_config = create_args->crc_config;
     (*out_handle)->read_wait = create_args->read_wait;
+    (*out_handle)->resolution = SI7021_RESOLUTION_RH12_TEMP14; // Slowest
+
+    /* Register shadows (loaded at init) */
+    (*out_handle)->shadow.user_valid   = false;
+    (*out_handle)->shadow.heater_valid = false;
 
     // > Do at init
-    if ( (err = _si7021_at_init(*out_handle, create_args)) ) free(*out_handle);
-    
+    err = _si7021_at_init(*out_handle, create_args);
+    CHECK_ERR_SI7021_AT_INIT(err, (*out_handle));
+
+    // > Async Measurements
+    (*out_handle)->async.running = true;
+    (*out_handle)->async.busy    = false;
+    (*out_handle)->async.head    = 0;
+    (*out_handle)->async.count   = 0;
+    portMUX_INITIALIZE(&(*out_handle)->async.lock);
+
+    (*out_handle)->async.stopped = xSemaphoreCreateBinary();
+    CHECK_ERR_ASYNC_SEMAPHORE_CREATE((*out_handle)->async.stopped, (*out_handle));
+
+    esp_timer_create_args_t async_timer_args = {
+        .callback        = &_si7021_async_timer_cb ,
+        .arg             = *out_handle             ,
+        .dispatch_method = ESP_TIMER_TASK          ,
+        .name            = "si7021_async"         };
+    err = esp_timer_create(&async_timer_args, &(*out_handle)->async.timer);
+    CHECK_ERR_ASYNC_TIMER_CREATE(err, (*out_handle));
+
     return err;
 }
 
@@ -393,6 +759,21 @@ esp_err_t si7021_delete(
     CHECK_ERR_HANDLE(si7021);
     esp_err_t err = ESP_OK;
 
+    // > Stop Async Measurements (pending requests are dropped)
+    portENTER_CRITICAL(&si7021->async.lock);
+    si7021->async.running = false;
+    si7021->async.count   = 0;
+    bool busy = si7021->async.busy;
+    portEXIT_CRITICAL(&si7021->async.lock);
+
+    // > Request in flight: cancelled if its timer is still armed (nothing runs
+    //   on it then); otherwise its issuer or callback is running and gives
+    //   <stopped> when it goes idle
+    if (busy && esp_timer_stop(si7021->async.timer) != ESP_OK)
+        xSemaphoreTake(si7021->async.stopped, portMAX_DELAY);
+    esp_timer_delete(si7021->async.timer);
+    vSemaphoreDelete(si7021->async.stopped);
+
     // > Delete Si7021 I2C handle
     err = si7021_i2c_delete(si7021->i2c);
     CHECK_WARN_SI7021_I2C_DELETE(err);
@@ -404,6 +785,17 @@ esp_err_t si7021_delete(
     return err;
 }
 
+/* Get I2C Handle */
+esp_err_t si7021_get_i2c_handle(
+    si7021_handle_t     const  si7021     ,
+    si7021_i2c_handle_t       *out_handle )
+{
+    CHECK_ERR_HANDLE(si7021);
+    CHECK_ERR_OUT_PARAM(out_handle);
+    *out_handle = si7021->i2c;
+    return ESP_OK;
+}
+
 //// ---------------------------------------------------------------------------
 
 //// CRC Config ----------------------------------------------------------------
@@ -458,23 +850,37 @@ esp_err_t si7021_set_read_wait(
 
 //// ---------------------------------------------------------------------------
 
-//// Measurement ---------------------------------------------------------------
+//// Conversion Time -----------------------------------------------------------
 
-/* Measure Relative Humidity */
-esp_err_t si7021_measure_rh(
-    si7021_handle_t const  si7021         ,
-    float                 *out_rh_percent )
+/* Get Conversion Time (us) */
+esp_err_t si7021_get_conversion_time_us(
+    si7021_handle_t       const  si7021            ,
+    si7021_measure_kind_t        kind              ,
+    uint32_t                    *out_conversion_us )
 {
     CHECK_ERR_HANDLE(si7021);
-    CHECK_ERR_OUT_PARAM(out_rh_percent);
+    CHECK_ERR_MEASURE_KIND(kind);
+    CHECK_ERR_OUT_PARAM(out_conversion_us);
+    *out_conversion_us = _si7021_conversion_us(si7021, kind);
+    return ESP_OK;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Measurement ---------------------------------------------------------------
+
+/* Measure Relative Humidity (code) */
+static esp_err_t _si7021_measure_rh_code(
+    si7021_handle_t const  si7021      ,
+    uint16_t              *out_rh_code )
+{
     esp_err_t err = ESP_OK;
 
     // > Measure Relative Humidity
     uint16_t   rh_code   = 0;
     bool       crc_check = si7021->crc_config.global || si7021->crc_config.rh;
-    TickType_t read_wait = si7021->read_wait.global
-        ? si7021->read_wait.global
-        : si7021->read_wait.rh;
+    uint32_t   read_wait = _si7021_measure_wait_us(
+        si7021, SI7021_MEASURE_RH);
     err = _si7021_i2c_measure_rh(
         si7021->i2c ,
         &rh_code    ,
@@ -482,27 +888,22 @@ esp_err_t si7021_measure_rh(
         read_wait  );
     CHECK_ERR_SI7021_I2C_MEASURE_RH(err);
 
-    // > Convert
-    *out_rh_percent = si7021_convert_rh(rh_code);
-
+    *out_rh_code = rh_code;
     return err;
 }
 
-/* Measure Temperature */
-esp_err_t si7021_measure_temp(
-    si7021_handle_t const  si7021           ,
-    float                 *out_temp_celsius )
+/* Measure Temperature (code) */
+static esp_err_t _si7021_measure_temp_code(
+    si7021_handle_t const  si7021        ,
+    uint16_t              *out_temp_code )
 {
-    CHECK_ERR_HANDLE(si7021);
-    CHECK_ERR_OUT_PARAM(out_temp_celsius);
     esp_err_t err = ESP_OK;
 
     // > Measure Temperature
     uint16_t   temp_code = 0;
     bool       crc_check = si7021->crc_config.global || si7021->crc_config.temp;
-    TickType_t read_wait = si7021->read_wait.global
-        ? si7021->read_wait.global
-        : si7021->read_wait.temp;
+    uint32_t   read_wait = _si7021_measure_wait_us(
+        si7021, SI7021_MEASURE_TEMP);
     err = _si7021_i2c_measure_temp(
         si7021->i2c ,
         &temp_code  ,
@@ -510,37 +911,105 @@ esp_err_t si7021_measure_temp(
         read_wait  );
     CHECK_ERR_SI7021_I2C_MEASURE_TEMP(err);
 
-    // > Convert
+    *out_temp_code = temp_code;
+    return err;
+}
+
+/* Measure Relative Humidity */
+esp_err_t si7021_measure_rh(
+    si7021_handle_t const  si7021         ,
+    float                 *out_rh_percent )
+{
+    CHECK_ERR_HANDLE(si7021);
+    CHECK_ERR_OUT_PARAM(out_rh_percent);
+    esp_err_t err = ESP_OK;
+
+    // > Measure & Convert
+    uint16_t rh_code = 0;
+    if ( (err = _si7021_measure_rh_code(si7021, &rh_code)) ) return err;
+    *out_rh_percent = si7021_convert_rh(rh_code);
+
+    return err;
+}
+
+/* Measure Relative Humidity (centi-percent) */
+esp_err_t si7021_measure_rh_centi(
+    si7021_handle_t const  si7021       ,
+    int32_t               *out_rh_centi )
+{
+    CHECK_ERR_HANDLE(si7021);
+    CHECK_ERR_OUT_PARAM(out_rh_centi);
+    esp_err_t err = ESP_OK;
+
+    // > Measure & Convert
+    uint16_t rh_code = 0;
+    if ( (err = _si7021_measure_rh_code(si7021, &rh_code)) ) return err;
+    *out_rh_centi = si7021_convert_rh_centi(rh_code);
+
+    return err;
+}
+
+/* Measure Temperature */
+esp_err_t si7021_measure_temp(
+    si7021_handle_t const  si7021           ,
+    float                 *out_temp_celsius )
+{
+    CHECK_ERR_HANDLE(si7021);
+    CHECK_ERR_OUT_PARAM(out_temp_celsius);
+    esp_err_t err = ESP_OK;
+
+    // > Measure & Convert
+    uint16_t temp_code = 0;
+    if ( (err = _si7021_measure_temp_code(si7021, &temp_code)) ) return err;
     *out_temp_celsius = si7021_convert_temp(temp_code);
 
     return err;
 }
 
+/* Measure Temperature (centi-degrees) */
+esp_err_t si7021_measure_temp_centi(
+    si7021_handle_t const  si7021         ,
+    int32_t               *out_temp_centi )
+{
+    CHECK_ERR_HANDLE(si7021);
+    CHECK_ERR_OUT_PARAM(out_temp_centi);
+    esp_err_t err = ESP_OK;
+
+    // > Measure & Convert
+    uint16_t temp_code = 0;
+    if ( (err = _si7021_measure_temp_code(si7021, &temp_code)) ) return err;
+    *out_temp_centi = si7021_convert_temp_centi(temp_code);
+
+    return err;
+}
+
 /* Measure RH and Temp */
 esp_err_t si7021_measure_rh_and_temp(
     si7021_handle_t const  si7021           ,
     float                 *out_rh_percent   ,
     float                 *out_temp_celsius )
 {
+    CHECK_ERR_HANDLE(si7021);
+    CHECK_ERR_OUT_PARAM(out_rh_percent);
     CHECK_ERR_OUT_PARAM(out_temp_celsius);
     esp_err_t err = ESP_OK;
 
-    // > Call si7021_measure_rh
-    err = si7021_measure_rh(si7021, out_rh_percent);
-    if (err) return err;
-
-    // > Measure Temperature from previous RH measurement
+    // > Measure RH, then Temperature of the same conversion (no wait)
+    uint16_t   rh_code   = 0;
     uint16_t   temp_code = 0;
-    TickType_t read_wait = si7021->read_wait.global
-        ? si7021->read_wait.global
-        : si7021->read_wait.temp;
-    err = si7021_i2c_read_temp_from_prev_rh_measurement(
+    bool       crc_check = si7021->crc_config.global || si7021->crc_config.rh;
+    uint32_t   read_wait = _si7021_measure_wait_us(
+        si7021, SI7021_MEASURE_RH);
+    err = _si7021_i2c_measure_rh_and_temp(
         si7021->i2c ,
+        &rh_code    ,
         &temp_code  ,
+        crc_check   ,
         read_wait  );
-    CHECK_ERR_SI7021_I2C_MEASURE_TEMP_FROM_PREV_RH_MEASUREMENT(err);
+    CHECK_ERR_SI7021_I2C_MEASURE_RH(err);
 
     // > Convert
+    *out_rh_percent   = si7021_convert_rh(rh_code);
     *out_temp_celsius = si7021_convert_temp(temp_code);
 
     return err;
@@ -548,6 +1017,126 @@ esp_err_t si7021_measure_rh_and_temp(
 
 //// ---------------------------------------------------------------------------
 
+//// Measurement (Group) -------------------------------------------------------
+
+/* Measure Group */
+esp_err_t si7021_measure_group(
+    si7021_handle_t         const *si7021s     ,
+    size_t                         count       ,
+    si7021_measure_kind_t          kind        ,
+    si7021_measure_result_t       *out_results )
+{
+    CHECK_ERR_IN_PARAM(si7021s);
+    CHECK_ERR_OUT_PARAM(out_results);
+    CHECK_ERR_MEASURE_KIND(kind);
+    for (size_t i = 0; i < count; i++) CHECK_ERR_HANDLE(si7021s[i]);
+    esp_err_t err = ESP_OK;
+
+    // > Start all conversions back to back (no hold master; NACK: busy,
+    //   retry a tick later)
+    uint32_t        wait_us = 0;
+    si7021_handle_t slowest = NULL;
+    for (size_t i = 0; i < count; i++) {
+        si7021_handle_t          si7021 = si7021s[i];
+        si7021_measure_result_t *result = &out_results[i];
+        *result = (si7021_measure_result_t) { .kind = kind };
+        for (int retry = 0; ; retry++) {
+            result->err = kind == SI7021_MEASURE_TEMP
+                ? si7021_i2c_start_measure_temp(si7021->i2c)
+                : si7021_i2c_start_measure_rh(si7021->i2c);
+            if (result->err != ESP_FAIL || retry >= SI7021_ASYNC_READ_RETRIES)
+                break;
+            vTaskDelay(1);
+        }
+
+        uint32_t sensor_wait_us = _si7021_measure_wait_us(si7021, kind);
+        if (!slowest || sensor_wait_us > wait_us) {
+            wait_us = sensor_wait_us;
+            slowest = si7021;
+        }
+    }
+
+    // > Wait once, for the slowest (last started) conversion
+    if (slowest) si7021_i2c_wait_conversion(slowest->i2c, wait_us);
+
+    // > Read all results (NACK: not done yet, retry a bit later)
+    for (size_t i = 0; i < count; i++) {
+        si7021_handle_t          si7021 = si7021s[i];
+        si7021_measure_result_t *result = &out_results[i];
+        if (result->err) continue;
+
+        uint16_t code      = 0;
+        bool     crc_check = si7021->crc_config.global || (
+            kind == SI7021_MEASURE_TEMP
+                ? si7021->crc_config.temp
+                : si7021->crc_config.rh );
+        for (int retry = 0; ; retry++) {
+            result->err = si7021_i2c_read_measure_result(
+                si7021->i2c, &code, crc_check);
+            if (result->err != ESP_FAIL || retry >= SI7021_ASYNC_READ_RETRIES)
+                break;
+            vTaskDelay(1);
+        }
+        if (!result->err) _si7021_measure_finish(si7021, code, result);
+    }
+
+    // > First error, if any
+    for (size_t i = 0; i < count && !err; i++) err = out_results[i].err;
+
+    return err;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Measurement (Async) -------------------------------------------------------
+
+/* Measure Async */
+esp_err_t si7021_measure_async(
+    si7021_handle_t       const  si7021 ,
+    si7021_measure_kind_t        kind   ,
+    si7021_measure_cb_t          cb     ,
+    void                        *arg    )
+{
+    CHECK_ERR_HANDLE(si7021);
+    CHECK_ERR_MEASURE_KIND(kind);
+    esp_err_t err   = ESP_OK;
+    bool      start = false;
+
+    // > Push Request (and claim the engine if idle)
+    portENTER_CRITICAL(&si7021->async.lock);
+    if (si7021->async.count < SI7021_ASYNC_QUEUE_LENGTH) {
+        uint8_t tail = (si7021->async.head + si7021->async.count)
+                     % SI7021_ASYNC_QUEUE_LENGTH;
+        si7021->async.ring[tail] = (si7021_async_request_t) {
+            .kind = kind, .cb = cb, .arg = arg };
+        si7021->async.count++;
+
+        start = !si7021->async.busy;
+        si7021->async.busy = true;
+    } else {
+        err = ESP_ERR_NO_MEM;
+    }
+    portEXIT_CRITICAL(&si7021->async.lock);
+    CHECK_ERR_ASYNC_QUEUE_FULL(err);
+
+    // > Issue it now if nothing was in flight
+    if (start) _si7021_async_next(si7021);
+
+    return err;
+}
+
+/* Measure Async (result to queue) */
+esp_err_t si7021_measure_async_to_queue(
+    si7021_handle_t       const si7021 ,
+    si7021_measure_kind_t       kind   ,
+    QueueHandle_t               queue  )
+{
+    CHECK_ERR_IN_PARAM(queue);
+    return si7021_measure_async(si7021, kind, &_si7021_async_queue_cb, queue);
+}
+
+//// ---------------------------------------------------------------------------
+
 /* Reset */
 esp_err_t si7021_reset(
     si7021_handle_t const si7021 )
@@ -556,6 +1145,22 @@ esp_err_t si7021_reset(
     esp_err_t err = ESP_OK;
     err = si7021_i2c_reset(si7021->i2c);
     CHECK_ERR_SI7021_I2C_RESET(err);
+    si7021->resolution = SI7021_RESOLUTION_RH12_TEMP14; // Back to default
+    si7021->shadow.user_valid   = false; // Reloaded on next access
+    si7021->shadow.heater_valid = false;
+    return err;
+}
+
+/* Sync Registers */
+esp_err_t si7021_sync_registers(
+    si7021_handle_t const si7021 )
+{
+    CHECK_ERR_HANDLE(si7021);
+    esp_err_t err = ESP_OK;
+
+    if ( (err = _si7021_shadow_load_user_reg(si7021)) ) return err;
+    err = _si7021_shadow_load_heater_reg(si7021);
+
     return err;
 }
 
@@ -571,13 +1176,12 @@ esp_err_t si7021_get_user_register_info(
     CHECK_ERR_OUT_PARAM(out_user_register_info);
     esp_err_t err = ESP_OK;
 
-    // > Read User Register
-    uint8_t    user_register = 0;
-    TickType_t read_wait     = si7021->read_wait.global
-        ? si7021->read_wait.global
-        : si7021->read_wait.user_reg;
-    err = si7021_i2c_read_user_reg_1(si7021->i2c, &user_register, read_wait);
-    CHECK_ERR_SI7021_I2C_READ_USER_REG(err);
+    // > User Register (shadow, read only if invalid)
+    if (
+        !si7021->shadow.user_valid &&
+        (err = _si7021_shadow_load_user_reg(si7021))
+    ) return err;
+    uint8_t user_register = si7021->shadow.user_reg;
 
     // > User Register Info
     if (out_user_register) *out_user_register = user_register;
@@ -610,9 +1214,19 @@ esp_err_t si7021_set_user_register_info(
                 (uint8_t)(user_register_info->heater_state) &
                 SI7021_USER_REGISTER_MASK_HEATER_STATE      ;
     /* vdd_status is read only */
+    uint8_t vdd_status = si7021->shadow.user_valid
+        ? si7021->shadow.user_reg & SI7021_USER_REGISTER_MASK_VDD_STATUS
+        : 0;
+    si7021->shadow.user_valid = false; // Unknown if the write fails
     err = si7021_i2c_write_user_reg_1(si7021->i2c, user_register);
     CHECK_ERR_SI7021_I2C_WRITE_USER_REG(err);
 
+    // > Update Shadow
+    si7021->shadow.user_reg   = user_register | vdd_status;
+    si7021->shadow.user_valid = true;
+    si7021->resolution = (si7021_resolution_t)(
+        user_register & SI7021_USER_REGISTER_MASK_RESOLUTION);
+
     return err;
 }
 //// ---------------------------------------------------------------------------
@@ -652,8 +1266,11 @@ esp_err_t si7021_get_vdd_status(
     si7021_handle_t     const  si7021         ,
     si7021_vdd_status_t       *out_vdd_status )
 {
+    CHECK_ERR_HANDLE(si7021);
     CHECK_ERR_OUT_PARAM(out_vdd_status);
     esp_err_t err = ESP_OK;
+    // > Refresh Shadow (VDD status is live)
+    if ( (err = _si7021_shadow_load_user_reg(si7021)) ) return err;
     si7021_user_register_info_t user_register_info;
     err = si7021_get_user_register_info(si7021, NULL, &user_register_info);
     if (err) return err;
@@ -714,16 +1331,12 @@ esp_err_t si7021_get_heater_level(
     CHECK_ERR_OUT_PARAM(out_heater_level);
     esp_err_t err = ESP_OK;
 
-    // > Read Heater Register
-    uint8_t    heater_register = 0;
-    TickType_t read_wait       = si7021->read_wait.global
-        ? si7021->read_wait.global
-        : si7021->read_wait.heater_reg;
-    err = si7021_i2c_read_heater_control_reg(
-        si7021->i2c      ,
-        &heater_register ,
-        read_wait       );
-    CHECK_ERR_SI7021_I2C_READ_HEATER_CONTROL_REG(err);
+    // > Heater Register (shadow, read only if invalid)
+    if (
+        !si7021->shadow.heater_valid &&
+        (err = _si7021_shadow_load_heater_reg(si7021))
+    ) return err;
+    uint8_t heater_register = si7021->shadow.heater_reg;
 
     // > Heater Level
     *out_heater_level = (si7021_heater_level_t)(
@@ -745,9 +1358,14 @@ esp_err_t si7021_set_heater_level(
             heater_register |=
                 heater_level &
                 SI7021_HEATER_REGISTER_MASK_HEATER_LEVEL;
+    si7021->shadow.heater_valid = false; // Unknown if the write fails
     err = si7021_i2c_write_heater_control_reg(si7021->i2c, heater_register );
     CHECK_ERR_SI7021_I2C_WRITE_HEATER_CONTROL_REG(err);
 
+    // > Update Shadow
+    si7021->shadow.heater_reg   = heater_register;
+    si7021->shadow.heater_valid = true;
+
     return err;
 }
 
@@ -772,9 +1390,7 @@ esp_err_t si7021_get_serial_number_info(
 
     // > Read Electronic ID First Bytes
     crc_check = si7021->crc_config.global || si7021->crc_config.sna;
-    read_wait = si7021->read_wait.global
-        ? si7021->read_wait.global
-        : si7021->read_wait.sna;
+    read_wait = _si7021_read_wait_ticks(si7021, si7021->read_wait.sna);
     err = si7021_i2c_read_electronic_id_first_bytes(
         si7021->i2c ,
         &sna        ,
@@ -784,9 +1400,7 @@ esp_err_t si7021_get_serial_number_info(
 
     // > Read Electronic ID Last Bytes
     crc_check = si7021->crc_config.global || si7021->crc_config.snb;
-    read_wait = si7021->read_wait.global
-        ? si7021->read_wait.global
-        : si7021->read_wait.snb;
+    read_wait = _si7021_read_wait_ticks(si7021, si7021->read_wait.snb);
     err = si7021_i2c_read_electronic_id_last_bytes(
         si7021->i2c ,
         &snb        ,
@@ -814,9 +1428,8 @@ esp_err_t si7021_get_firmware_revision_info(
 
     // > Read Firmware Revision
     uint8_t    fw_version = 0;
-    TickType_t read_wait  = si7021->read_wait.global
-        ? si7021->read_wait.global
-        : si7021->read_wait.fw;
+    TickType_t read_wait  = _si7021_read_wait_ticks(
+        si7021, si7021->read_wait.fw);
     err = si7021_i2c_read_firmware_revision(
         si7021->i2c    ,
         &fw_version    ,
@@ -909,23 +1522,23 @@ esp_err_t si7021_dump_read_wait(
 {
     CHECK_ERR_HANDLE(si7021);
     ESP_LOGI(TAG, "Si7021 Read Wait:\n"
-                  " - Global:            %d ms\n"
+                  " - Global:            %u us\n"
                   "\n"
-                  " - RH:                %d ms\n"
-                  " - Temp:              %d ms\n"
-                  " - User Register:     %d ms\n"
-                  " - Heater Register:   %d ms\n"
-                  " - SNA:               %d ms\n"
-                  " - SNB:               %d ms\n"
-                  " - Firmware Revision: %d ms\n"                            ,
-                  (int) (si7021->read_wait.global     * portTICK_PERIOD_MS)  ,
-                  (int) (si7021->read_wait.rh         * portTICK_PERIOD_MS)  ,
-                  (int) (si7021->read_wait.temp       * portTICK_PERIOD_MS)  ,
-                  (int) (si7021->read_wait.user_reg   * portTICK_PERIOD_MS)  ,
-                  (int) (si7021->read_wait.heater_reg * portTICK_PERIOD_MS)  ,
-                  (int) (si7021->read_wait.sna        * portTICK_PERIOD_MS)  ,
-                  (int) (si7021->read_wait.snb        * portTICK_PERIOD_MS)  ,
-                  (int) (si7021->read_wait.fw         * portTICK_PERIOD_MS) );
+                  " - RH:                %u us\n"
+                  " - Temp:              %u us\n"
+                  " - User Register:     %u us\n"
+                  " - Heater Register:   %u us\n"
+                  " - SNA:               %u us\n"
+                  " - SNB:               %u us\n"
+                  " - Firmware Revision: %u us\n"         ,
+                  (unsigned) si7021->read_wait.global     ,
+                  (unsigned) si7021->read_wait.rh         ,
+                  (unsigned) si7021->read_wait.temp       ,
+                  (unsigned) si7021->read_wait.user_reg   ,
+                  (unsigned) si7021->read_wait.heater_reg ,
+                  (unsigned) si7021->read_wait.sna        ,
+                  (unsigned) si7021->read_wait.snb        ,
+                  (unsigned) si7021->read_wait.fw        );
 
     // Return
     return ESP_OK;
@@ -0,0 +1,501 @@
+#include "si7021_heater.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdlib.h>              // for calloc, free
+#include <stdbool.h>             // for bool
+#include <math.h>                // for expf
+#include "esp_err.h"             // for ESP errors
+#include "esp_timer.h"           // for esp_timer_get_time
+#include "freertos/FreeRTOS.h"   // for FreeRTOS
+#include "freertos/task.h"       // for controller task & notifications
+#include "freertos/semphr.h"     // for sensor & state lock, stop handshake
+
+/* Logging */
+#include "esp_log.h"
+static const char *TAG = "Si7021 Heater";
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Si7021 Heater Controller */
+struct si7021_heater_ctrl {
+    si7021_handle_t si7021;
+
+    /* Config */
+    int64_t check_period_us;
+    float   rh_trigger;
+    uint8_t level;
+    int64_t pulse_us;
+    int64_t cooldown_us;
+    float   tau_us;
+    int64_t holdoff_us;
+
+    TaskHandle_t      task;    // Runs the state machine
+    SemaphoreHandle_t lock;    // Sensor commands & state below
+    SemaphoreHandle_t stopped; // Given by exiting task
+    volatile bool     running; // Cleared at delete
+
+    /* State */
+    si7021_heater_ctrl_state_t state;
+    int64_t                    state_us;      // State entry time
+    int64_t                    next_pulse_us; // End of the holdoff
+    float                      offset0;       // Self-heating after the pulse
+    uint32_t                   pulses;
+
+    /* Last readings (compensated) */
+    bool  rh_valid;
+    bool  temp_valid;
+    float rh_percent;
+    float temp_celsius;
+};
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define SI7021_HEATER_RETRY_US 100000 // Heater off failed: try again
+
+/* Magnus coefficients over water (for the RH correction) */
+#define MAGNUS_B 17.62f
+#define MAGNUS_C 243.12f
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+//// CREATE & DELETE -----------------------------------------------------------
+
+#define CHECK_ERR_CREATE_ARGS(create_args)                                     \
+    if (!create_args) {                                                        \
+        ESP_LOGE(TAG, "Pointer to si7021_heater_ctrl_create_args_t is NULL."); \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_CREATE_ARGS_VALUES(create_args)                              \
+    if (!create_args->si7021          ||                                       \
+        !create_args->check_period_ms ||                                       \
+        !create_args->pulse_ms        ||                                       \
+        !create_args->tau_ms          ||                                       \
+        create_args->level > SI7021_HEATER_LEVEL_94_20_MA ||                   \
+        !(create_args->rh_trigger > 0.0f && create_args->rh_trigger <= 100)) { \
+        ESP_LOGE(TAG, "Heater controller create args are not valid.");         \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_HANDLE(out_handle)                                       \
+    if (!out_handle) {                                                         \
+        ESP_LOGE(TAG, "Pointer to out handle is NULL.");                       \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_MALLOC(ptr, ctrl)                                            \
+    if (!ptr) {                                                                \
+        ESP_LOGE(TAG, "Could not allocate memory.");                           \
+        _si7021_heater_ctrl_free(ctrl);                                        \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+#define CHECK_ERR_HEATER_OFF(err, ctrl)                                        \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not turn the heater off: %s",                     \
+            esp_err_to_name(err));                                             \
+        _si7021_heater_ctrl_free(ctrl);                                        \
+        return err;                                                            \
+    }
+
+#define CHECK_ERR_TASK_CREATE(ok, ctrl)                                        \
+    if (ok != pdPASS) {                                                        \
+        ESP_LOGE(TAG, "Could not create controller task.");                    \
+        _si7021_heater_ctrl_free(ctrl);                                        \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+//// OTHER ---------------------------------------------------------------------
+
+#define CHECK_ERR_HANDLE(ctrl)                                                 \
+    if (!ctrl) {                                                               \
+        ESP_LOGE(TAG, "Si7021 heater controller handle is NULL.");             \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT(ptr, what)                                               \
+    if (!ptr) {                                                                \
+        ESP_LOGE(TAG, "Pointer to out %s is NULL.", what);                     \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+//// Create & Delete -----------------------------------------------------------
+
+/* Free Controller (and whatever was created) */
+static void _si7021_heater_ctrl_free(
+    si7021_heater_ctrl_handle_t ctrl )
+{
+    if (!ctrl) return;
+    if (ctrl->lock)    vSemaphoreDelete(ctrl->lock);
+    if (ctrl->stopped) vSemaphoreDelete(ctrl->stopped);
+    free(ctrl);
+}
+
+//// Compensation --------------------------------------------------------------
+
+/* Self-heating offset at <now_us> (lock held) */
+static float _si7021_heater_ctrl_offset(
+    si7021_heater_ctrl_handle_t const ctrl   ,
+    int64_t                           now_us )
+{
+    if (ctrl->state != SI7021_HEATER_CTRL_COOLING) return 0.0f;
+    float elapsed_us = (float) (now_us - ctrl->state_us);
+    return ctrl->offset0 * expf(-elapsed_us / ctrl->tau_us);
+}
+
+/* Compensate live readings (lock held, <rh_percent> may be NULL) */
+/* The vapour pressure near the die does not change with its temperature, so
+ * RH scales with the ratio of saturation pressures (Magnus) at the measured
+ * and the compensated temperatures.
+ */
+static void _si7021_heater_ctrl_compensate(
+    si7021_heater_ctrl_handle_t const  ctrl         ,
+    float                             *rh_percent   ,
+    float                             *temp_celsius )
+{
+    float offset = _si7021_heater_ctrl_offset(ctrl, esp_timer_get_time());
+    if (offset <= 0.0f) return;
+
+    float measured = *temp_celsius;
+    *temp_celsius  = measured - offset;
+    if (!rh_percent) return;
+
+    float ratio = expf(
+        MAGNUS_B * measured      / (MAGNUS_C + measured) -
+        MAGNUS_B * *temp_celsius / (MAGNUS_C + *temp_celsius));
+    *rh_percent *= ratio;
+    if (*rh_percent > 100.0f) *rh_percent = 100.0f;
+}
+
+//// Measurement ---------------------------------------------------------------
+
+/* Measure RH & Temp (lock held, paused while heating) */
+static esp_err_t _si7021_heater_ctrl_measure_rh_and_temp(
+    si7021_heater_ctrl_handle_t const  ctrl         ,
+    float                             *rh_percent   ,
+    float                             *temp_celsius )
+{
+    // > Paused: readings from before the pulse
+    if (ctrl->state == SI7021_HEATER_CTRL_HEATING) {
+        if (!ctrl->rh_valid || !ctrl->temp_valid) return ESP_ERR_INVALID_STATE;
+        *rh_percent   = ctrl->rh_percent;
+        *temp_celsius = ctrl->temp_celsius;
+        return ESP_OK;
+    }
+
+    // > Live (compensated while cooling)
+    esp_err_t err = si7021_measure_rh_and_temp(
+        ctrl->si7021, rh_percent, temp_celsius);
+    if (err) return err;
+    _si7021_heater_ctrl_compensate(ctrl, rh_percent, temp_celsius);
+
+    ctrl->rh_percent   = *rh_percent;
+    ctrl->temp_celsius = *temp_celsius;
+    ctrl->rh_valid     = true;
+    ctrl->temp_valid   = true;
+    return ESP_OK;
+}
+
+/* Measure Temp (lock held, paused while heating) */
+static esp_err_t _si7021_heater_ctrl_measure_temp(
+    si7021_heater_ctrl_handle_t const  ctrl         ,
+    float                             *temp_celsius )
+{
+    // > Paused: reading from before the pulse
+    if (ctrl->state == SI7021_HEATER_CTRL_HEATING) {
+        if (!ctrl->temp_valid) return ESP_ERR_INVALID_STATE;
+        *temp_celsius = ctrl->temp_celsius;
+        return ESP_OK;
+    }
+
+    // > Live (compensated while cooling)
+    esp_err_t err = si7021_measure_temp(ctrl->si7021, temp_celsius);
+    if (err) return err;
+    _si7021_heater_ctrl_compensate(ctrl, NULL, temp_celsius);
+
+    ctrl->temp_celsius = *temp_celsius;
+    ctrl->temp_valid   = true;
+    return ESP_OK;
+}
+
+//// State Machine -------------------------------------------------------------
+
+/* Enter <state> (lock held) */
+static void _si7021_heater_ctrl_enter(
+    si7021_heater_ctrl_handle_t const ctrl  ,
+    si7021_heater_ctrl_state_t        state )
+{
+    ctrl->state    = state;
+    ctrl->state_us = esp_timer_get_time();
+    ESP_LOGI(TAG, "%s.", SI7021_HEATER_CTRL_STATE_TO_STRING(state));
+}
+
+/* Idle: check RH, start a pulse near saturation (returns next timeout) */
+static int64_t _si7021_heater_ctrl_idle(
+    si7021_heater_ctrl_handle_t const ctrl )
+{
+    float rh, temp;
+    esp_err_t err = _si7021_heater_ctrl_measure_rh_and_temp(ctrl, &rh, &temp);
+    if (err) {
+        ESP_LOGW(TAG, "RH check failed: %s", esp_err_to_name(err));
+        return ctrl->check_period_us;
+    }
+    if (rh < ctrl->rh_trigger || esp_timer_get_time() < ctrl->next_pulse_us)
+        return ctrl->check_period_us;
+
+    // > Pulse (level first, so the heater never starts at an old level)
+    err = si7021_set_heater_level(ctrl->si7021, ctrl->level);
+    if (!err) err = si7021_set_heater_state(
+        ctrl->si7021, SI7021_HEATER_STATE_ENABLE);
+    if (err) {
+        ESP_LOGW(TAG, "Could not start pulse: %s", esp_err_to_name(err));
+        si7021_set_heater_state(ctrl->si7021, SI7021_HEATER_STATE_DISABLE);
+        return ctrl->check_period_us;
+    }
+
+    ESP_LOGI(TAG, "RH %.1f%% >= %.1f%%: heater pulse %s.", rh,
+        ctrl->rh_trigger, SI7021_HEATER_LEVEL_TO_STRING(ctrl->level));
+    ctrl->pulses++;
+    _si7021_heater_ctrl_enter(ctrl, SI7021_HEATER_CTRL_HEATING);
+    return ctrl->pulse_us;
+}
+
+/* Heating: end the pulse, take the self-heating offset (next timeout) */
+static int64_t _si7021_heater_ctrl_heating(
+    si7021_heater_ctrl_handle_t const ctrl )
+{
+    // > Heater off (retried until it is: the pulse is bounded)
+    esp_err_t err = si7021_set_heater_state(
+        ctrl->si7021, SI7021_HEATER_STATE_DISABLE);
+    if (err) {
+        ESP_LOGE(TAG, "Could not end pulse: %s", esp_err_to_name(err));
+        return SI7021_HEATER_RETRY_US;
+    }
+
+    // > Offset: hot die vs. last reading before the pulse
+    float hot;
+    ctrl->offset0 = 0.0f;
+    if (ctrl->temp_valid &&
+        si7021_measure_temp(ctrl->si7021, &hot) == ESP_OK &&
+        hot > ctrl->temp_celsius)
+        ctrl->offset0 = hot - ctrl->temp_celsius;
+    ESP_LOGI(TAG, "Self-heating offset: %.2f ºC.", ctrl->offset0);
+
+    if (!ctrl->cooldown_us) {
+        ctrl->next_pulse_us = esp_timer_get_time() + ctrl->holdoff_us;
+        _si7021_heater_ctrl_enter(ctrl, SI7021_HEATER_CTRL_IDLE);
+        return ctrl->check_period_us;
+    }
+    _si7021_heater_ctrl_enter(ctrl, SI7021_HEATER_CTRL_COOLING);
+    return ctrl->cooldown_us;
+}
+
+/* Cooling: done, back to idle after the holdoff (next timeout) */
+static int64_t _si7021_heater_ctrl_cooling(
+    si7021_heater_ctrl_handle_t const ctrl )
+{
+    ctrl->next_pulse_us = esp_timer_get_time() + ctrl->holdoff_us;
+    _si7021_heater_ctrl_enter(ctrl, SI7021_HEATER_CTRL_IDLE);
+    return ctrl->check_period_us;
+}
+
+/* Ticks until <deadline_us> (rounded up) */
+static TickType_t _si7021_heater_ctrl_wait(
+    int64_t deadline_us )
+{
+    int64_t wait_us = deadline_us - esp_timer_get_time();
+    int64_t tick_us = portTICK_PERIOD_MS * 1000;
+    return wait_us <= 0 ? 0 : (TickType_t) ((wait_us + tick_us - 1) / tick_us);
+}
+
+/* Controller Task */
+/* Steps block on the sensor and on the lock (held by measuring callers), so
+ * they run here instead of in the shared esp_timer task.
+ */
+static void _si7021_heater_ctrl_task(
+    void *arg )
+{
+    si7021_heater_ctrl_handle_t ctrl     = (si7021_heater_ctrl_handle_t) arg;
+    int64_t                     deadline = esp_timer_get_time() +
+                                           ctrl->check_period_us;
+
+    while (1) {
+        // > Wait for the next step (or delete)
+        ulTaskNotifyTake(pdTRUE, _si7021_heater_ctrl_wait(deadline));
+        if (!ctrl->running) break;
+        if (esp_timer_get_time() < deadline) continue;
+
+        // > Step
+        int64_t timeout_us;
+        xSemaphoreTake(ctrl->lock, portMAX_DELAY);
+        switch (ctrl->state) {
+            case SI7021_HEATER_CTRL_HEATING:
+                timeout_us = _si7021_heater_ctrl_heating(ctrl);
+                break;
+            case SI7021_HEATER_CTRL_COOLING:
+                timeout_us = _si7021_heater_ctrl_cooling(ctrl);
+                break;
+            default:
+                timeout_us = _si7021_heater_ctrl_idle(ctrl);
+                break;
+        }
+        xSemaphoreGive(ctrl->lock);
+
+        deadline = esp_timer_get_time() + timeout_us;
+    }
+
+    xSemaphoreGive(ctrl->stopped);
+    vTaskDelete(NULL);
+}
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+//// Create & Delete -----------------------------------------------------------
+
+/* Create Si7021 Heater Controller */
+esp_err_t si7021_heater_ctrl_create(
+    si7021_heater_ctrl_create_args_t const *create_args ,
+    si7021_heater_ctrl_handle_t            *out_handle  )
+{
+    CHECK_ERR_CREATE_ARGS(create_args);
+    CHECK_ERR_CREATE_ARGS_VALUES(create_args);
+    CHECK_ERR_OUT_HANDLE(out_handle);
+    esp_err_t err = ESP_OK;
+
+    // > Allocate Handle & Lock
+    si7021_heater_ctrl_handle_t ctrl = calloc(
+        1, sizeof(struct si7021_heater_ctrl));
+    CHECK_ERR_MALLOC(ctrl, ctrl);
+    ctrl->lock = xSemaphoreCreateMutex();
+    CHECK_ERR_MALLOC(ctrl->lock, ctrl);
+    ctrl->stopped = xSemaphoreCreateBinary();
+    CHECK_ERR_MALLOC(ctrl->stopped, ctrl);
+
+    ctrl->si7021          = create_args->si7021;
+    ctrl->check_period_us = (int64_t) create_args->check_period_ms * 1000;
+    ctrl->rh_trigger      = create_args->rh_trigger;
+    ctrl->level           = create_args->level;
+    ctrl->pulse_us        = (int64_t) create_args->pulse_ms * 1000;
+    ctrl->cooldown_us     = (int64_t) create_args->cooldown_ms * 1000;
+    ctrl->tau_us          = (float) create_args->tau_ms * 1000;
+    ctrl->holdoff_us      = (int64_t) create_args->holdoff_ms * 1000;
+    ctrl->state           = SI7021_HEATER_CTRL_IDLE;
+
+    // > Heater Off (the controller owns it from now on)
+    err = si7021_set_heater_state(ctrl->si7021, SI7021_HEATER_STATE_DISABLE);
+    CHECK_ERR_HEATER_OFF(err, ctrl);
+
+    // > Controller Task (first check after one period)
+    ctrl->running = true;
+    BaseType_t ok = xTaskCreate(
+        &_si7021_heater_ctrl_task       ,
+        "si7021_heater"                 ,
+        create_args->task_stack_size    ,
+        ctrl                            ,
+        create_args->task_priority      ,
+        &ctrl->task                    );
+    CHECK_ERR_TASK_CREATE(ok, ctrl);
+
+    *out_handle = ctrl;
+    return ESP_OK;
+}
+
+/* Delete Si7021 Heater Controller */
+esp_err_t si7021_heater_ctrl_delete(
+    si7021_heater_ctrl_handle_t ctrl )
+{
+    CHECK_ERR_HANDLE(ctrl);
+    esp_err_t err = ESP_OK;
+
+    // > Stop Controller Task (after a step in progress)
+    ctrl->running = false;
+    xTaskNotifyGive(ctrl->task);
+    xSemaphoreTake(ctrl->stopped, portMAX_DELAY);
+
+    // > Heater Off (measuring callers may still hold the lock)
+    xSemaphoreTake(ctrl->lock, portMAX_DELAY);
+    if (ctrl->state == SI7021_HEATER_CTRL_HEATING) {
+        err = si7021_set_heater_state(
+            ctrl->si7021, SI7021_HEATER_STATE_DISABLE);
+        if (err) ESP_LOGE(TAG, "Could not turn the heater off: %s",
+            esp_err_to_name(err));
+    }
+    xSemaphoreGive(ctrl->lock);
+
+    _si7021_heater_ctrl_free(ctrl);
+    return err;
+}
+
+//// Measurement ---------------------------------------------------------------
+
+/* Measure Temp (through the controller) */
+esp_err_t si7021_heater_ctrl_measure_temp(
+    si7021_heater_ctrl_handle_t const  ctrl             ,
+    float                             *out_temp_celsius )
+{
+    CHECK_ERR_HANDLE(ctrl);
+    CHECK_ERR_OUT(out_temp_celsius, "temperature");
+
+    xSemaphoreTake(ctrl->lock, portMAX_DELAY);
+    esp_err_t err = _si7021_heater_ctrl_measure_temp(ctrl, out_temp_celsius);
+    xSemaphoreGive(ctrl->lock);
+
+    return err;
+}
+
+/* Measure RH & Temp (through the controller) */
+esp_err_t si7021_heater_ctrl_measure_rh_and_temp(
+    si7021_heater_ctrl_handle_t const  ctrl             ,
+    float                             *out_rh_percent   ,
+    float                             *out_temp_celsius )
+{
+    CHECK_ERR_HANDLE(ctrl);
+    CHECK_ERR_OUT(out_rh_percent, "RH");
+    CHECK_ERR_OUT(out_temp_celsius, "temperature");
+
+    xSemaphoreTake(ctrl->lock, portMAX_DELAY);
+    esp_err_t err = _si7021_heater_ctrl_measure_rh_and_temp(
+        ctrl, out_rh_percent, out_temp_celsius);
+    xSemaphoreGive(ctrl->lock);
+
+    return err;
+}
+
+//// Status --------------------------------------------------------------------
+
+/* Get Status */
+esp_err_t si7021_heater_ctrl_get_status(
+    si7021_heater_ctrl_handle_t const  ctrl       ,
+    si7021_heater_ctrl_status_t       *out_status )
+{
+    CHECK_ERR_HANDLE(ctrl);
+    CHECK_ERR_OUT(out_status, "status");
+
+    xSemaphoreTake(ctrl->lock, portMAX_DELAY);
+    out_status->state          = ctrl->state;
+    out_status->pulses         = ctrl->pulses;
+    out_status->offset_celsius = _si7021_heater_ctrl_offset(
+        ctrl, esp_timer_get_time());
+    xSemaphoreGive(ctrl->lock);
+
+    return ESP_OK;
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,307 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include <math.h>
+#include <stdio.h>
+
+#include "unity.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+
+#include "i2c_bus.h"
+#include "si7021.h"
+#include "si7021_heater.h"
+#include "si7021_sim.h"
+
+// STRUCTURES ------------------------------------------------------------------
+
+typedef struct {
+    si7021_sim_handle_t sim;
+    si7021_handle_t     si7021;
+} fixture_t;
+
+/* Slow async callback: entered, then done after a while */
+typedef struct {
+    SemaphoreHandle_t entered;
+    volatile bool     done;
+    volatile int      calls;
+} slow_cb_t;
+
+/* Heater controller measured from another task (holds its lock meanwhile) */
+typedef struct {
+    si7021_heater_ctrl_handle_t ctrl;
+    SemaphoreHandle_t           done;
+} heater_reader_t;
+
+/* Periodic esp_timer recording how late its callbacks run */
+typedef struct {
+    int64_t          period_us;
+    int64_t          due_us;
+    volatile int64_t late_max_us;
+    volatile uint32_t calls;
+} timer_probe_t;
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+/* Sensor model on the simulated bus and a si7021 handle creating the bus */
+static void _fixture_setup(fixture_t *f)
+{
+    si7021_sim_create_args_t sim_args = SI7021_SIM_DEFAULT_CREATE_ARGS();
+    si7021_create_args_t     args     = SI7021_DEFAULT_CREATE_ARGS();
+    args.i2c.i2c_driver.uninstall_at_delete = true;
+    args.at_init.dump.device_info           = false;
+
+    f->sim    = NULL;
+    f->si7021 = NULL;
+    TEST_ESP_OK(si7021_sim_create(&sim_args, &f->sim));
+    TEST_ESP_OK(si7021_create(&args, &f->si7021));
+}
+
+static void _fixture_teardown(fixture_t *f)
+{
+    if (f->si7021) TEST_ESP_OK(si7021_delete(f->si7021));
+    TEST_ESP_OK(si7021_sim_delete(f->sim));
+}
+
+static void _slow_cb(
+    si7021_handle_t                si7021 ,
+    si7021_measure_result_t const *result ,
+    void                          *arg    )
+{
+    slow_cb_t *slow = (slow_cb_t *) arg;
+    slow->calls++;
+    xSemaphoreGive(slow->entered);
+    vTaskDelay(pdMS_TO_TICKS(30));
+    slow->done = true;
+}
+
+static void _heater_reader_task(void *arg)
+{
+    heater_reader_t *reader = (heater_reader_t *) arg;
+    float rh, temp;
+    si7021_heater_ctrl_measure_rh_and_temp(reader->ctrl, &rh, &temp);
+    xSemaphoreGive(reader->done);
+    vTaskDelete(NULL);
+}
+
+static void _timer_probe_cb(void *arg)
+{
+    timer_probe_t *probe = (timer_probe_t *) arg;
+    int64_t late_us = esp_timer_get_time() - probe->due_us;
+    if (late_us > probe->late_max_us) probe->late_max_us = late_us;
+    probe->due_us += probe->period_us;
+    probe->calls++;
+}
+
+// TESTS -----------------------------------------------------------------------
+
+TEST_CASE("fixed point conversions match the datasheet formulas on every code", "[si7021]")
+{
+    for (uint32_t code = 0; code <= 0xFFFF; code++) {
+        // > Exact hundredths (double), rounded half up like the fixed point
+        double rh   = floor(12500.0 * code / 65536.0 - 600.0 + 0.5);
+        double temp = floor(17572.0 * code / 65536.0 - 4685.0 + 0.5);
+        rh = rh < 0.0 ? 0.0 : rh > 10000.0 ? 10000.0 : rh;
+        TEST_ASSERT_EQUAL_INT32((int32_t) rh, si7021_convert_rh_centi(code));
+        TEST_ASSERT_EQUAL_INT32((int32_t) temp, si7021_convert_temp_centi(code));
+
+        // > Within half a hundredth (plus float error) of the float conversions
+        TEST_ASSERT_FLOAT_WITHIN(0.0051f, si7021_convert_rh(code),
+            si7021_convert_rh_centi(code) / 100.0f);
+        TEST_ASSERT_FLOAT_WITHIN(0.0051f, si7021_convert_temp(code),
+            si7021_convert_temp_centi(code) / 100.0f);
+    }
+}
+
+TEST_CASE("async measurements are delivered in order", "[si7021]")
+{
+    fixture_t f;
+    _fixture_setup(&f);
+    TEST_ESP_OK(si7021_sim_set_environment(f.sim, 55.0f, 18.0f));
+
+    QueueHandle_t queue = xQueueCreate(4, sizeof(si7021_measure_result_t));
+    TEST_ESP_OK(si7021_measure_async_to_queue(f.si7021, SI7021_MEASURE_RH, queue));
+    TEST_ESP_OK(si7021_measure_async_to_queue(f.si7021, SI7021_MEASURE_TEMP, queue));
+    TEST_ESP_OK(si7021_measure_async_to_queue(
+        f.si7021, SI7021_MEASURE_RH_AND_TEMP, queue));
+
+    si7021_measure_result_t result;
+    TEST_ASSERT_TRUE(xQueueReceive(queue, &result, pdMS_TO_TICKS(500)));
+    TEST_ASSERT_EQUAL(SI7021_MEASURE_RH, result.kind);
+    TEST_ESP_OK(result.err);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 55.0f, result.rh_percent);
+
+    TEST_ASSERT_TRUE(xQueueReceive(queue, &result, pdMS_TO_TICKS(500)));
+    TEST_ASSERT_EQUAL(SI7021_MEASURE_TEMP, result.kind);
+    TEST_ESP_OK(result.err);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 18.0f, result.temp_celsius);
+
+    TEST_ASSERT_TRUE(xQueueReceive(queue, &result, pdMS_TO_TICKS(500)));
+    TEST_ASSERT_EQUAL(SI7021_MEASURE_RH_AND_TEMP, result.kind);
+    TEST_ESP_OK(result.err);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 55.0f, result.rh_percent);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 18.0f, result.temp_celsius);
+
+    _fixture_teardown(&f);
+    vQueueDelete(queue);
+}
+
+TEST_CASE("delete cancels an async request whose read is not due", "[si7021]")
+{
+    fixture_t f;
+    slow_cb_t slow = { .entered = xSemaphoreCreateBinary() };
+    _fixture_setup(&f);
+
+    // > Conversion timer armed, nothing running on the handle
+    TEST_ESP_OK(si7021_measure_async(f.si7021, SI7021_MEASURE_RH, &_slow_cb, &slow));
+    TEST_ESP_OK(si7021_measure_async(f.si7021, SI7021_MEASURE_TEMP, &_slow_cb, &slow));
+    TEST_ESP_OK(si7021_delete(f.si7021));
+    f.si7021 = NULL;
+
+    // > Neither the request in flight nor the pending one calls back
+    vTaskDelay(pdMS_TO_TICKS(50));
+    TEST_ASSERT_EQUAL(0, slow.calls);
+
+    _fixture_teardown(&f);
+    vSemaphoreDelete(slow.entered);
+}
+
+TEST_CASE("delete waits for an async callback in progress", "[si7021]")
+{
+    fixture_t f;
+    slow_cb_t slow = { .entered = xSemaphoreCreateBinary() };
+    _fixture_setup(&f);
+
+    TEST_ESP_OK(si7021_measure_async(f.si7021, SI7021_MEASURE_RH, &_slow_cb, &slow));
+    TEST_ESP_OK(si7021_measure_async(f.si7021, SI7021_MEASURE_TEMP, &_slow_cb, &slow));
+
+    // > Delete while the first callback sleeps: it must not free under it,
+    //   and the second (pending) request is dropped
+    TEST_ASSERT_TRUE(xSemaphoreTake(slow.entered, pdMS_TO_TICKS(500)));
+    TEST_ESP_OK(si7021_delete(f.si7021));
+    f.si7021 = NULL;
+    TEST_ASSERT_TRUE(slow.done);
+
+    vTaskDelay(pdMS_TO_TICKS(50));
+    TEST_ASSERT_EQUAL(1, slow.calls);
+
+    _fixture_teardown(&f);
+    vSemaphoreDelete(slow.entered);
+}
+
+TEST_CASE("create releases the bus when the init fails", "[si7021]")
+{
+    si7021_sim_create_args_t sim_args = SI7021_SIM_DEFAULT_CREATE_ARGS();
+    si7021_create_args_t     args     = SI7021_DEFAULT_CREATE_ARGS();
+    args.i2c.i2c_driver.uninstall_at_delete = true;
+    args.at_init.dump.device_info           = false;
+
+    si7021_sim_handle_t sim;
+    si7021_handle_t     si7021 = NULL;
+    i2c_bus_handle_t    bus    = NULL;
+    TEST_ESP_OK(si7021_sim_create(&sim_args, &sim));
+
+    // > Every at init transfer times out
+    si7021_sim_faults_t faults = { .stuck_bus = true };
+    TEST_ESP_OK(si7021_sim_set_faults(sim, &faults));
+    TEST_ASSERT_NOT_EQUAL(ESP_OK, si7021_create(&args, &si7021));
+
+    // > The device is removed and the bus it created is deleted
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, i2c_bus_get(sim_args.i2c_port, &bus));
+
+    // > So a create on the recovered bus can take the port again
+    faults.stuck_bus = false;
+    TEST_ESP_OK(si7021_sim_set_faults(sim, &faults));
+    TEST_ESP_OK(si7021_create(&args, &si7021));
+    TEST_ESP_OK(si7021_delete(si7021));
+    TEST_ESP_OK(si7021_sim_delete(sim));
+}
+
+TEST_CASE("heater controller delete waits for a check blocked on its lock", "[si7021]")
+{
+    fixture_t f;
+    _fixture_setup(&f);
+
+    si7021_heater_ctrl_create_args_t args = SI7021_HEATER_CTRL_DEFAULT_CREATE_ARGS();
+    args.si7021          = f.si7021;
+    args.check_period_ms = 5;
+    heater_reader_t reader = { .done = xSemaphoreCreateBinary() };
+
+    // > The check is due while a reader holds the lock: the controller task
+    //   is queued on the lock together with delete, in either order
+    for (int i = 0; i < 50; i++) {
+        TEST_ESP_OK(si7021_heater_ctrl_create(&args, &reader.ctrl));
+        vTaskDelay(pdMS_TO_TICKS(4));
+        TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(&_heater_reader_task,
+            "heater_reader", 4096, &reader, 5, NULL));
+        vTaskDelay(pdMS_TO_TICKS(3));
+        TEST_ESP_OK(si7021_heater_ctrl_delete(reader.ctrl));
+        TEST_ASSERT_TRUE(xSemaphoreTake(reader.done, pdMS_TO_TICKS(500)));
+    }
+
+    // > No task was left behind on a freed lock: a new controller still runs
+    //   (its first check starts a pulse)
+    si7021_heater_ctrl_status_t status = { 0 };
+    args.rh_trigger = 1.0f;
+    TEST_ESP_OK(si7021_heater_ctrl_create(&args, &reader.ctrl));
+    for (int i = 0; i < 50 && !status.pulses; i++) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+        TEST_ESP_OK(si7021_heater_ctrl_get_status(reader.ctrl, &status));
+    }
+    TEST_ESP_OK(si7021_heater_ctrl_delete(reader.ctrl));
+    TEST_ASSERT_EQUAL(1, status.pulses);
+
+    _fixture_teardown(&f);
+    vSemaphoreDelete(reader.done);
+}
+
+TEST_CASE("heater controller never blocks the esp_timer task", "[si7021]")
+{
+    fixture_t f;
+    _fixture_setup(&f);
+
+    si7021_heater_ctrl_create_args_t args = SI7021_HEATER_CTRL_DEFAULT_CREATE_ARGS();
+    args.si7021          = f.si7021;
+    args.check_period_ms = 5;
+    heater_reader_t reader = { .done = xSemaphoreCreateBinary() };
+    TEST_ESP_OK(si7021_heater_ctrl_create(&args, &reader.ctrl));
+
+    // > 1 ms probe on the esp_timer task
+    timer_probe_t probe = { .period_us = 1000 };
+    esp_timer_handle_t timer;
+    esp_timer_create_args_t timer_args = {
+        .callback = &_timer_probe_cb,
+        .arg      = &probe,
+        .name     = "probe"
+    };
+    TEST_ESP_OK(esp_timer_create(&timer_args, &timer));
+    probe.due_us = esp_timer_get_time() + probe.period_us;
+    TEST_ESP_OK(esp_timer_start_periodic(timer, probe.period_us));
+
+    // > Stuck bus: the reader holds the lock until its retry timeout, and the
+    //   controller checks due meanwhile wait for it
+    si7021_sim_faults_t faults = { .stuck_bus = true };
+    TEST_ESP_OK(si7021_sim_set_faults(f.sim, &faults));
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(&_heater_reader_task,
+        "heater_reader", 4096, &reader, 5, NULL));
+    TEST_ASSERT_TRUE(xSemaphoreTake(reader.done, pdMS_TO_TICKS(5000)));
+    faults.stuck_bus = false;
+    TEST_ESP_OK(si7021_sim_set_faults(f.sim, &faults));
+
+    // > Probe callbacks after the reader (a blocked timer task catches up)
+    uint32_t calls = probe.calls;
+    for (int i = 0; i < 500 && probe.calls < calls + 10; i++)
+        vTaskDelay(pdMS_TO_TICKS(10));
+    TEST_ESP_OK(esp_timer_stop(timer));
+    TEST_ESP_OK(esp_timer_delete(timer));
+    printf("esp_timer lateness: max %d us\n", (int) probe.late_max_us);
+    TEST_ASSERT_LESS_THAN(100000, probe.late_max_us);
+
+    TEST_ESP_OK(si7021_heater_ctrl_delete(reader.ctrl));
+
+    _fixture_teardown(&f);
+    vSemaphoreDelete(reader.done);
+}
@@ -0,0 +1,126 @@
+#ifndef __SI7021_DERIVED_H__
+#define __SI7021_DERIVED_H__
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdbool.h>    // bool
+#include <stdint.h>     // uint32_t
+#include "esp_err.h"    // esp_err_t
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+/* Input domain (inputs are clamped to it) */
+#define SI7021_DERIVED_RH_MIN     0.1f   // %RH (dew point diverges at 0)
+#define SI7021_DERIVED_RH_MAX   100.0f   // %RH
+#define SI7021_DERIVED_TEMP_MIN -40.0f   // ºC (sensor range)
+#define SI7021_DERIVED_TEMP_MAX 125.0f   // ºC (sensor range)
+
+//// KCONFIG -------------------------------------------------------------------
+
+#define SI7021_DERIVED_DEFAULT_RH_THRESHOLD                         /* 0.10 */ \
+        (CONFIG_SI7021_DERIVED_DEFAULT_RH_THRESHOLD_CENTI / 100.0f)
+#define SI7021_DERIVED_DEFAULT_TEMP_THRESHOLD                       /* 0.05 */ \
+        (CONFIG_SI7021_DERIVED_DEFAULT_TEMP_THRESHOLD_CENTI / 100.0f)
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Si7021 Derived Handle */
+typedef struct si7021_derived *si7021_derived_handle_t;
+
+/* Si7021 Derived Create Args */
+typedef struct {
+    float rh_threshold;   // %RH change that triggers a recomputation
+    float temp_threshold; // ºC change that triggers a recomputation
+} si7021_derived_create_args_t;
+
+/* Si7021 Derived Values */
+typedef struct {
+    float dew_point_celsius;  // Magnus formula (over water)
+    float abs_humidity_g_m3;  // Water vapour density
+    float heat_index_celsius; // NWS (Rothfusz regression & adjustments)
+} si7021_derived_values_t;
+
+/* Si7021 Derived Stats */
+typedef struct {
+    uint32_t updates;    // Calls to si7021_derived_update
+    uint32_t recomputes; // Updates past a threshold (or the first one)
+} si7021_derived_stats_t;
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+/* Si7021 Derived Default Create Args */
+#define SI7021_DERIVED_DEFAULT_CREATE_ARGS() {                                 \
+    .rh_threshold   = SI7021_DERIVED_DEFAULT_RH_THRESHOLD,                     \
+    .temp_threshold = SI7021_DERIVED_DEFAULT_TEMP_THRESHOLD                    \
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS -------------------------------------------------------------------
+
+/* Calculation */
+/* No libm transcendentals: ln and exp are range reduced to a power of two
+ * (exponent bits) and a short polynomial, sharing the Magnus exponential
+ * between dew point and absolute humidity. Against double precision libm over
+ * the whole input domain (0.05 steps), the maximum errors are:
+ *  - Dew point:         0.00004 ºC (as libm logf in single precision).
+ *  - Absolute humidity: 1.3e-6 relative (0.0015 g/m³ at 125 ºC).
+ *  - Heat index:        0.0015 ºC (the NWS formula itself, in single
+ *                       precision: rounding in the regression terms).
+ * That is far below the sensor accuracy (±0.4 ºC, ±3 %RH). Speed depends on
+ * the libm at hand: against x86-64 glibc (table driven logf & expf) all values
+ * take ~25 ns vs ~22 ns, so the saving there is only the update threshold
+ * (see test/bench_si7021_derived.c).
+ */
+float si7021_derived_dew_point(
+    float rh_percent   ,
+    float temp_celsius );
+
+float si7021_derived_abs_humidity(
+    float rh_percent   ,
+    float temp_celsius );
+
+float si7021_derived_heat_index(
+    float rh_percent   ,
+    float temp_celsius );
+
+esp_err_t si7021_derived_calc(
+    float                    rh_percent   ,
+    float                    temp_celsius ,
+    si7021_derived_values_t *out_values   );
+
+/* Create & Delete */
+esp_err_t si7021_derived_create(
+    si7021_derived_create_args_t const *create_args ,
+    si7021_derived_handle_t            *out_handle  );
+
+esp_err_t si7021_derived_delete(
+    si7021_derived_handle_t derived );
+
+/* Update (incremental) */
+/* Recomputes only if RH or temperature moved past its threshold since the
+ * inputs of the last recomputation (so slow drifts still add up); otherwise
+ * the cached values are returned. <out_recomputed> may be NULL.
+ */
+esp_err_t si7021_derived_update(
+    si7021_derived_handle_t  const  derived        ,
+    float                           rh_percent     ,
+    float                           temp_celsius   ,
+    si7021_derived_values_t        *out_values     ,
+    bool                           *out_recomputed );
+
+esp_err_t si7021_derived_get_stats(
+    si7021_derived_handle_t const  derived   ,
+    si7021_derived_stats_t        *out_stats );
+
+// -----------------------------------------------------------------------------
+
+#endif // __SI7021_DERIVED_H__
@@ -0,0 +1,353 @@
+#include "si7021_derived.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdlib.h>              // for calloc, free
+#include <stdint.h>              // for uint32_t, int32_t
+#include <math.h>                // for fabsf, sqrtf
+#include "esp_err.h"             // for ESP errors
+
+/* Logging */
+#include "esp_log.h"
+static const char *TAG = "Si7021 Derived";
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Si7021 Derived */
+struct si7021_derived {
+    float rh_threshold;   // %RH
+    float temp_threshold; // ºC
+
+    /* Cache (inputs of the last recomputation & its values) */
+    bool                    valid;
+    float                   rh_percent;
+    float                   temp_celsius;
+    si7021_derived_values_t values;
+
+    si7021_derived_stats_t stats;
+};
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+/* Magnus coefficients over water (Sonntag 1990, -45 to 60 ºC) */
+#define MAGNUS_B 17.62f  // Dimensionless
+#define MAGNUS_C 243.12f // ºC
+#define MAGNUS_E 6.112f  // hPa (saturation vapour pressure at 0 ºC)
+
+/* Water vapour: 100 Pa/hPa / 461.5 J/(kg K) * 1000 g/kg */
+#define VAPOUR_G_M3_K_HPA 216.7f
+#define KELVIN            273.15f
+
+#define LN2   0.69314718f
+#define LOG2E 1.44269504f
+#define SQRT2 1.41421356f
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+#define CHECK_ERR_CREATE_ARGS(create_args)                                     \
+    if (!create_args) {                                                        \
+        ESP_LOGE(TAG, "Pointer to si7021_derived_create_args_t is NULL.");     \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_THRESHOLDS(create_args)                                      \
+    if (!(create_args->rh_threshold >= 0.0f) ||                                \
+        !(create_args->temp_threshold >= 0.0f)) {                              \
+        ESP_LOGE(TAG, "Thresholds must be 0 or positive.");                    \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_HANDLE(out_handle)                                       \
+    if (!out_handle) {                                                         \
+        ESP_LOGE(TAG, "Pointer to out handle is NULL.");                       \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_MALLOC(ptr)                                                  \
+    if (!ptr) {                                                                \
+        ESP_LOGE(TAG, "Could not allocate memory.");                           \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+#define CHECK_ERR_HANDLE(derived)                                              \
+    if (!derived) {                                                            \
+        ESP_LOGE(TAG, "Si7021 derived handle is NULL.");                       \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT(ptr, what)                                               \
+    if (!ptr) {                                                                \
+        ESP_LOGE(TAG, "Pointer to out %s is NULL.", what);                     \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+// -----------------------------------------------------------------------------
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+//// Fast ln & exp -------------------------------------------------------------
+
+/* Float bits */
+typedef union {
+    float    f;
+    uint32_t u;
+} _si7021_derived_bits_t;
+
+/* Natural Logarithm (x normal & positive) */
+/* x = m * 2^e with m in [√½, √2), and ln(m) = 2 atanh(t) with t = (m-1)/(m+1),
+ * |t| <= 0.172: four odd terms leave a truncation error below 3e-8.
+ */
+static inline float _si7021_derived_ln(
+    float x )
+{
+    _si7021_derived_bits_t bits = { .f = x };
+    int32_t e = (int32_t) ((bits.u >> 23) & 0xFF) - 127;
+    bits.u = (bits.u & 0x007FFFFF) | 0x3F800000; // m in [1, 2)
+
+    float m = bits.f;
+    if (m > SQRT2) { m *= 0.5f; e++; }
+
+    float t  = (m - 1.0f) / (m + 1.0f);
+    float t2 = t * t;
+    float p  = 1.0f + t2 * (1.0f/3 + t2 * (1.0f/5 + t2 * (1.0f/7)));
+    return (float) e * LN2 + 2.0f * t * p;
+}
+
+/* Exponential (|y| < 80) */
+/* y = k ln2 + r with |r| <= ln2 / 2: exp(r) by a degree 6 Taylor polynomial
+ * (truncation error below 2e-7 relative) and 2^k from the exponent bits.
+ */
+static inline float _si7021_derived_exp(
+    float y )
+{
+    float   kf = y * LOG2E;
+    int32_t k  = (int32_t) (kf + (kf < 0.0f ? -0.5f : 0.5f));
+    float   r  = y - (float) k * LN2;
+
+    float p = 1.0f + r * (1.0f + r * (1.0f/2 + r * (1.0f/6 + r * (1.0f/24
+            + r * (1.0f/120 + r * (1.0f/720))))));
+
+    _si7021_derived_bits_t scale = { .u = (uint32_t) (k + 127) << 23 };
+    return p * scale.f;
+}
+
+//// Formulas ------------------------------------------------------------------
+
+/* Clamp inputs to the documented domain (NaN goes to the minimum) */
+static inline void _si7021_derived_clamp(
+    float *rh_percent   ,
+    float *temp_celsius )
+{
+    if (!(*rh_percent >= SI7021_DERIVED_RH_MIN))
+        *rh_percent = SI7021_DERIVED_RH_MIN;
+    if (*rh_percent > SI7021_DERIVED_RH_MAX)
+        *rh_percent = SI7021_DERIVED_RH_MAX;
+    if (!(*temp_celsius >= SI7021_DERIVED_TEMP_MIN))
+        *temp_celsius = SI7021_DERIVED_TEMP_MIN;
+    if (*temp_celsius > SI7021_DERIVED_TEMP_MAX)
+        *temp_celsius = SI7021_DERIVED_TEMP_MAX;
+}
+
+/* Magnus exponent: b T / (c + T) */
+static inline float _si7021_derived_magnus(
+    float temp_celsius )
+{
+    return MAGNUS_B * temp_celsius / (MAGNUS_C + temp_celsius);
+}
+
+/* Dew Point from the Magnus exponent */
+static inline float _si7021_derived_calc_dew_point(
+    float rh_percent ,
+    float magnus     )
+{
+    float gamma = _si7021_derived_ln(rh_percent * 0.01f) + magnus;
+    return MAGNUS_C * gamma / (MAGNUS_B - gamma);
+}
+
+/* Absolute Humidity from the saturation factor exp(Magnus exponent) */
+static inline float _si7021_derived_calc_abs_humidity(
+    float rh_percent   ,
+    float temp_celsius ,
+    float saturation   )
+{
+    float vapour_hpa = MAGNUS_E * saturation * rh_percent * 0.01f;
+    return VAPOUR_G_M3_K_HPA * vapour_hpa / (KELVIN + temp_celsius);
+}
+
+/* Heat Index (NWS algorithm, in ºF internally) */
+static inline float _si7021_derived_calc_heat_index(
+    float rh_percent   ,
+    float temp_celsius )
+{
+    float t  = temp_celsius * 1.8f + 32.0f;
+    float rh = rh_percent;
+
+    // > Steadman's simple formula (mild conditions)
+    float hi = 0.5f * (t + 61.0f + (t - 68.0f) * 1.2f + rh * 0.094f);
+
+    // > Rothfusz regression & adjustments
+    if ((hi + t) * 0.5f >= 80.0f) {
+        hi = -42.379f + 2.04901523f * t + 10.14333127f * rh
+           - 0.22475541f * t * rh - 6.83783e-3f * t * t - 5.481717e-2f * rh * rh
+           + 1.22874e-3f * t * t * rh + 8.5282e-4f * t * rh * rh
+           - 1.99e-6f * t * t * rh * rh;
+
+        if (rh < 13.0f && t >= 80.0f && t <= 112.0f)
+            hi -= (13.0f - rh) * 0.25f * sqrtf((17.0f - fabsf(t - 95.0f)) / 17);
+        else if (rh > 85.0f && t >= 80.0f && t <= 87.0f)
+            hi += (rh - 85.0f) * 0.1f * (87.0f - t) * 0.2f;
+    }
+
+    return (hi - 32.0f) / 1.8f;
+}
+
+/* All Values (one ln, one exp) */
+static void _si7021_derived_calc_values(
+    float                    rh_percent   ,
+    float                    temp_celsius ,
+    si7021_derived_values_t *values       )
+{
+    _si7021_derived_clamp(&rh_percent, &temp_celsius);
+    float magnus = _si7021_derived_magnus(temp_celsius);
+
+    values->dew_point_celsius = _si7021_derived_calc_dew_point(
+        rh_percent, magnus);
+    values->abs_humidity_g_m3 = _si7021_derived_calc_abs_humidity(
+        rh_percent, temp_celsius, _si7021_derived_exp(magnus));
+    values->heat_index_celsius = _si7021_derived_calc_heat_index(
+        rh_percent, temp_celsius);
+}
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+//// Calculation ---------------------------------------------------------------
+
+/* Dew Point */
+float si7021_derived_dew_point(
+    float rh_percent   ,
+    float temp_celsius )
+{
+    _si7021_derived_clamp(&rh_percent, &temp_celsius);
+    return _si7021_derived_calc_dew_point(
+        rh_percent, _si7021_derived_magnus(temp_celsius));
+}
+
+/* Absolute Humidity */
+float si7021_derived_abs_humidity(
+    float rh_percent   ,
+    float temp_celsius )
+{
+    _si7021_derived_clamp(&rh_percent, &temp_celsius);
+    float saturation = _si7021_derived_exp(
+        _si7021_derived_magnus(temp_celsius));
+    return _si7021_derived_calc_abs_humidity(
+        rh_percent, temp_celsius, saturation);
+}
+
+/* Heat Index */
+float si7021_derived_heat_index(
+    float rh_percent   ,
+    float temp_celsius )
+{
+    _si7021_derived_clamp(&rh_percent, &temp_celsius);
+    return _si7021_derived_calc_heat_index(rh_percent, temp_celsius);
+}
+
+/* All Values */
+esp_err_t si7021_derived_calc(
+    float                    rh_percent   ,
+    float                    temp_celsius ,
+    si7021_derived_values_t *out_values   )
+{
+    CHECK_ERR_OUT(out_values, "values");
+    _si7021_derived_calc_values(rh_percent, temp_celsius, out_values);
+    return ESP_OK;
+}
+
+//// Create & Delete -----------------------------------------------------------
+
+/* Create Si7021 Derived */
+esp_err_t si7021_derived_create(
+    si7021_derived_create_args_t const *create_args ,
+    si7021_derived_handle_t            *out_handle  )
+{
+    CHECK_ERR_CREATE_ARGS(create_args);
+    CHECK_ERR_THRESHOLDS(create_args);
+    CHECK_ERR_OUT_HANDLE(out_handle);
+
+    si7021_derived_handle_t derived = calloc(1, sizeof(struct si7021_derived));
+    CHECK_ERR_MALLOC(derived);
+
+    derived->rh_threshold   = create_args->rh_threshold;
+    derived->temp_threshold = create_args->temp_threshold;
+
+    *out_handle = derived;
+    return ESP_OK;
+}
+
+/* Delete Si7021 Derived */
+esp_err_t si7021_derived_delete(
+    si7021_derived_handle_t derived )
+{
+    CHECK_ERR_HANDLE(derived);
+    free(derived);
+    return ESP_OK;
+}
+
+//// Update --------------------------------------------------------------------
+
+/* Update Si7021 Derived */
+esp_err_t si7021_derived_update(
+    si7021_derived_handle_t  const  derived        ,
+    float                           rh_percent     ,
+    float                           temp_celsius   ,
+    si7021_derived_values_t        *out_values     ,
+    bool                           *out_recomputed )
+{
+    CHECK_ERR_HANDLE(derived);
+    CHECK_ERR_OUT(out_values, "values");
+    derived->stats.updates++;
+
+    // > Past a threshold since the last recomputation?
+    float rh_delta   = fabsf(rh_percent   - derived->rh_percent);
+    float temp_delta = fabsf(temp_celsius - derived->temp_celsius);
+    bool  recompute  = !derived->valid
+        || rh_delta   > derived->rh_threshold
+        || temp_delta > derived->temp_threshold;
+
+    if (recompute) {
+        _si7021_derived_calc_values(
+            rh_percent, temp_celsius, &derived->values);
+        derived->rh_percent   = rh_percent;
+        derived->temp_celsius = temp_celsius;
+        derived->valid        = true;
+        derived->stats.recomputes++;
+    }
+
+    *out_values = derived->values;
+    if (out_recomputed) *out_recomputed = recompute;
+    return ESP_OK;
+}
+
+/* Get Stats */
+esp_err_t si7021_derived_get_stats(
+    si7021_derived_handle_t const  derived   ,
+    si7021_derived_stats_t        *out_stats )
+{
+    CHECK_ERR_HANDLE(derived);
+    CHECK_ERR_OUT(out_stats, "stats");
+    *out_stats = derived->stats;
+    return ESP_OK;
+}
+
+// -----------------------------------------------------------------------------
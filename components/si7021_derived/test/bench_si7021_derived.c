@@ -0,0 +1,72 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include <math.h>
+
+#include "unity.h"
+
+#include "bench_utils.h"
+
+#include "si7021_derived.h"
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define BENCH_DERIVED_ITERATIONS 100000
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+/* The same formulas on libm logf & expf (what the component avoids) */
+static float _libm_dew_point(float rh, float t)
+{
+    float gamma = logf(rh * 0.01f) + 17.62f * t / (243.12f + t);
+    return 243.12f * gamma / (17.62f - gamma);
+}
+
+static float _libm_abs_humidity(float rh, float t)
+{
+    float vapour_hpa = 6.112f * expf(17.62f * t / (243.12f + t)) * rh * 0.01f;
+    return 216.7f * vapour_hpa / (273.15f + t);
+}
+
+// BENCHMARKS ------------------------------------------------------------------
+
+/* Inputs sweep 10-99 %RH and -10-50 ºC so no branch or range is favoured */
+TEST_CASE("derived values vs libm logf & expf", "[si7021_derived]" BENCH_TAG)
+{
+    si7021_derived_values_t values;
+
+#define BENCH_RH (10.0f + (_bench_i % 900) * 0.1f)
+#define BENCH_T  (-10.0f + (_bench_i % 600) * 0.1f)
+
+    BENCH_RUN("dew point (si7021_derived)", BENCH_DERIVED_ITERATIONS, {
+        bench_sink((uint32_t) (1000 * si7021_derived_dew_point(BENCH_RH, BENCH_T)));
+    });
+    BENCH_RUN("dew point (libm logf)", BENCH_DERIVED_ITERATIONS, {
+        bench_sink((uint32_t) (1000 * _libm_dew_point(BENCH_RH, BENCH_T)));
+    });
+    BENCH_RUN("abs humidity (si7021_derived)", BENCH_DERIVED_ITERATIONS, {
+        bench_sink((uint32_t) (1000 * si7021_derived_abs_humidity(BENCH_RH, BENCH_T)));
+    });
+    BENCH_RUN("abs humidity (libm expf)", BENCH_DERIVED_ITERATIONS, {
+        bench_sink((uint32_t) (1000 * _libm_abs_humidity(BENCH_RH, BENCH_T)));
+    });
+    BENCH_RUN("all values (si7021_derived_calc)", BENCH_DERIVED_ITERATIONS, {
+        si7021_derived_calc(BENCH_RH, BENCH_T, &values);
+        bench_sink((uint32_t) (1000 * (values.dew_point_celsius
+                                     + values.abs_humidity_g_m3
+                                     + values.heat_index_celsius)));
+    });
+    BENCH_RUN("all values (libm logf & expf)", BENCH_DERIVED_ITERATIONS, {
+        values.dew_point_celsius  = _libm_dew_point(BENCH_RH, BENCH_T);
+        values.abs_humidity_g_m3  = _libm_abs_humidity(BENCH_RH, BENCH_T);
+        values.heat_index_celsius = si7021_derived_heat_index(BENCH_RH, BENCH_T);
+        bench_sink((uint32_t) (1000 * (values.dew_point_celsius
+                                     + values.abs_humidity_g_m3
+                                     + values.heat_index_celsius)));
+    });
+    BENCH_RUN("heat index", BENCH_DERIVED_ITERATIONS, {
+        bench_sink((uint32_t) (1000 * si7021_derived_heat_index(BENCH_RH, BENCH_T)));
+    });
+
+#undef BENCH_RH
+#undef BENCH_T
+}
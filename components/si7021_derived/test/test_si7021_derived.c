@@ -0,0 +1,119 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include <math.h>
+#include <stdio.h>
+
+#include "unity.h"
+
+#include "si7021_derived.h"
+
+// DEFINITIONS -----------------------------------------------------------------
+
+/* Grid over the whole input domain, as in the si7021_derived.h bounds */
+#define GRID_STEP   0.05
+#define GRID_RH_N   ((int) ((SI7021_DERIVED_RH_MAX - SI7021_DERIVED_RH_MIN) / GRID_STEP + 0.5))
+#define GRID_TEMP_N ((int) ((SI7021_DERIVED_TEMP_MAX - SI7021_DERIVED_TEMP_MIN) / GRID_STEP + 0.5))
+
+/* Bounds documented in si7021_derived.h */
+#define DEW_POINT_MAX_ERR     0.00004 // ºC
+#define ABS_HUMIDITY_MAX_RERR 1.3e-6  // Relative
+#define HEAT_INDEX_MAX_ERR    0.0015  // ºC (same formula, single precision)
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+/* References in double precision libm, with the component's coefficients */
+static double _ref_dew_point(double rh, double t)
+{
+    double gamma = log(rh / 100.0) + 17.62 * t / (243.12 + t);
+    return 243.12 * gamma / (17.62 - gamma);
+}
+
+static double _ref_abs_humidity(double rh, double t)
+{
+    double vapour_hpa = 6.112 * exp(17.62 * t / (243.12 + t)) * rh / 100.0;
+    return 216.7 * vapour_hpa / (273.15 + t);
+}
+
+static double _ref_heat_index(double rh, double t_celsius)
+{
+    double t  = t_celsius * 1.8 + 32.0;
+    double hi = 0.5 * (t + 61.0 + (t - 68.0) * 1.2 + rh * 0.094);
+    if ((hi + t) * 0.5 >= 80.0) {
+        hi = -42.379 + 2.04901523 * t + 10.14333127 * rh
+           - 0.22475541 * t * rh - 6.83783e-3 * t * t - 5.481717e-2 * rh * rh
+           + 1.22874e-3 * t * t * rh + 8.5282e-4 * t * rh * rh
+           - 1.99e-6 * t * t * rh * rh;
+        if (rh < 13.0 && t >= 80.0 && t <= 112.0)
+            hi -= (13.0 - rh) * 0.25 * sqrt((17.0 - fabs(t - 95.0)) / 17.0);
+        else if (rh > 85.0 && t >= 80.0 && t <= 87.0)
+            hi += (rh - 85.0) * 0.1 * (87.0 - t) * 0.2;
+    }
+    return (hi - 32.0) / 1.8;
+}
+
+// TESTS -----------------------------------------------------------------------
+
+TEST_CASE("derived values stay within the documented error bounds", "[si7021_derived]")
+{
+    double dew_max = 0.0, abs_max = 0.0, hi_max = 0.0;
+
+    for (int i = 0; i <= GRID_RH_N; i++) {
+        float rh = SI7021_DERIVED_RH_MIN + (float) (i * GRID_STEP);
+        for (int j = 0; j <= GRID_TEMP_N; j++) {
+            float t = SI7021_DERIVED_TEMP_MIN + (float) (j * GRID_STEP);
+
+            double dew = fabs(si7021_derived_dew_point(rh, t)
+                       - _ref_dew_point(rh, t));
+            double ref = _ref_abs_humidity(rh, t);
+            double abs = fabs(si7021_derived_abs_humidity(rh, t) - ref) / ref;
+            double hi  = fabs(si7021_derived_heat_index(rh, t)
+                       - _ref_heat_index(rh, t));
+
+            if (dew > dew_max) dew_max = dew;
+            if (abs > abs_max) abs_max = abs;
+            if (hi  > hi_max)  hi_max  = hi;
+        }
+    }
+
+    printf("Max errors: dew point %.2e C, abs humidity %.2e rel, "
+           "heat index %.2e C\n", dew_max, abs_max, hi_max);
+    TEST_ASSERT_TRUE(dew_max <= DEW_POINT_MAX_ERR);
+    TEST_ASSERT_TRUE(abs_max <= ABS_HUMIDITY_MAX_RERR);
+    TEST_ASSERT_TRUE(hi_max  <= HEAT_INDEX_MAX_ERR);
+}
+
+TEST_CASE("calc matches the single value functions", "[si7021_derived]")
+{
+    si7021_derived_values_t values;
+    TEST_ESP_OK(si7021_derived_calc(55.0f, 31.0f, &values));
+    TEST_ASSERT_EQUAL_FLOAT(si7021_derived_dew_point(55.0f, 31.0f),
+        values.dew_point_celsius);
+    TEST_ASSERT_EQUAL_FLOAT(si7021_derived_abs_humidity(55.0f, 31.0f),
+        values.abs_humidity_g_m3);
+    TEST_ASSERT_EQUAL_FLOAT(si7021_derived_heat_index(55.0f, 31.0f),
+        values.heat_index_celsius);
+}
+
+TEST_CASE("update recomputes only past a threshold", "[si7021_derived]")
+{
+    si7021_derived_create_args_t args = SI7021_DERIVED_DEFAULT_CREATE_ARGS();
+    si7021_derived_handle_t derived = NULL;
+    si7021_derived_values_t values;
+    bool recomputed;
+    args.rh_threshold   = 0.5f;
+    args.temp_threshold = 0.1f;
+    TEST_ESP_OK(si7021_derived_create(&args, &derived));
+
+    TEST_ESP_OK(si7021_derived_update(derived, 50.0f, 20.0f, &values, &recomputed));
+    TEST_ASSERT_TRUE(recomputed);
+    TEST_ESP_OK(si7021_derived_update(derived, 50.4f, 20.05f, &values, &recomputed));
+    TEST_ASSERT_FALSE(recomputed);
+    TEST_ESP_OK(si7021_derived_update(derived, 50.4f, 20.15f, &values, &recomputed));
+    TEST_ASSERT_TRUE(recomputed);
+
+    si7021_derived_stats_t stats;
+    TEST_ESP_OK(si7021_derived_get_stats(derived, &stats));
+    TEST_ASSERT_EQUAL(3, stats.updates);
+    TEST_ASSERT_EQUAL(2, stats.recomputes);
+    TEST_ESP_OK(si7021_derived_delete(derived));
+}
@@ -6,7 +6,7 @@
 #include <stdbool.h>    // bool
 #include <stdint.h>     // uint8_t, uint16_t, uint32_t
 #include "esp_err.h"    // esp_err_t
-#include "driver/i2c.h" // i2c_port_t, i2c_config_t, I2C_MODE_MASTER
+#include "i2c_bus.h"    // i2c_bus_handle_t, i2c_port_t, i2c_config_t
 
 // -----------------------------------------------------------------------------
 
@@ -15,17 +15,78 @@
 /* Si7021 I2C Handle */
 typedef struct si7021_i2c_handle *si7021_i2c_handle_t;
 
+/* Si7021 I2C Retry Policy */
+/* A failed transfer is retried until i2c_retry_timeout expires, yielding the
+ * CPU between attempts. The delay starts at backoff_initial and is multiplied
+ * by backoff_multiplier after every retry, up to backoff_max (1 tick minimum).
+ */
+typedef struct {
+    TickType_t backoff_initial;    // First delay between attempts
+    TickType_t backoff_max;        // Upper bound of the delay
+    uint8_t    backoff_multiplier; // Delay growth per retry (1: constant)
+} si7021_i2c_retry_policy_t;
+
+/* Si7021 I2C Retry Counters */
+typedef struct {
+    uint32_t transfers;    // Writes & reads issued
+    uint32_t retries;      // Extra attempts after a failed one
+    uint32_t nacks;        // Attempts NACKed by the sensor (busy)
+    uint32_t timeouts;     // Attempts that used up the remaining time
+    uint32_t arbitrations; // Attempts aborted early by the bus (lost arb.)
+    uint32_t failures;     // Transfers that failed for good
+} si7021_i2c_retry_counters_t;
+
+/* Si7021 I2C Latency Histogram */
+/* Bucket i counts latencies in [2^i, 2^(i+1)) us (bucket 0 also counts 0 us);
+ * the last bucket is open-ended (>= 2^19 us, about 0.5 s).
+ */
+#define SI7021_I2C_STATS_BUCKETS 20
+
+typedef struct {
+    uint32_t count;                             // Samples
+    uint32_t max_us;                            // Slowest sample
+    uint64_t total_us;                          // For the mean
+    uint32_t buckets[SI7021_I2C_STATS_BUCKETS]; // Log2 (us) buckets
+} si7021_i2c_histogram_t;
+
+/* Si7021 I2C Stats */
+/* Latencies include retries and backoff. Retry buckets count transfers by the
+ * retries they needed: 0, 1, 2-3, 4-7, ... (last one open-ended).
+ */
+#define SI7021_I2C_STATS_RETRY_BUCKETS 8
+
+typedef struct {
+    si7021_i2c_histogram_t write;      // Write-only transfers (commands)
+    si7021_i2c_histogram_t read;       // Read-only transfers (results)
+    si7021_i2c_histogram_t write_read; // Repeated start transfers (registers)
+    si7021_i2c_histogram_t wait;       // Conversion waits before a read
+
+    uint32_t retries[SI7021_I2C_STATS_RETRY_BUCKETS]; // Transfers by retries
+    uint32_t crc_checks;                              // CRC bytes checked
+    uint32_t crc_failures;                            // CRC mismatches
+} si7021_i2c_stats_t;
+
 /* Si7021 I2C Create Args */
 typedef struct {
     const char *name; // Handle name
 
-    i2c_port_t i2c_port;          // I2C port
-    TickType_t i2c_retry_timeout; // I2C retry timeout
+    i2c_port_t                i2c_port;          // I2C port
+    TickType_t                i2c_retry_timeout; // I2C retry timeout
+    si7021_i2c_retry_policy_t retry_policy;      // Backoff between retries
+
+    /* Shared bus. If NULL, the bus owning i2c_port is used; if there is none
+     * yet, one is created with the i2c_driver options below. */
+    i2c_bus_handle_t i2c_bus;
+
+    /* Several sensors share a bus behind mux channels (all answer at the same
+     * address), or on different ports. */
+    uint8_t               address; // Sensor address (SI7021_I2C_ADDRESS)
+    i2c_bus_mux_channel_t mux;     // Mux channel (mux.enable: behind a mux)
 
     struct {
-        bool install;             // Install driver?
-        bool set_config;          // Set I2C configuration?
-        bool uninstall_at_delete; // Uninstall driver at handle delete?
+        bool install;             // Install driver? (new bus only)
+        bool set_config;          // Set I2C configuration? (new bus only)
+        bool uninstall_at_delete; // Delete the new bus at handle delete?
 
         i2c_config_t config; // I2C configuration
     } i2c_driver;
@@ -45,6 +106,18 @@ typedef struct {
 #define SI7021_I2C_ADDRESS                                          /* 0x40 */ \
         CONFIG_SI7021_I2C_ADDRESS
 
+/* CRC-8 Implementation: 256-entry table, 16-entry table or bitwise */
+#define SI7021_I2C_CRC_IMPL_TABLE                                      /* 1 */ \
+        CONFIG_SI7021_I2C_CRC_IMPL_TABLE
+#define SI7021_I2C_CRC_IMPL_NIBBLE                                     /* 0 */ \
+        CONFIG_SI7021_I2C_CRC_IMPL_NIBBLE
+#define SI7021_I2C_CRC_TABLE_IN_DRAM                                   /* 0 */ \
+        CONFIG_SI7021_I2C_CRC_TABLE_IN_DRAM
+
+/* Transfer Stats (0: compiled out) */
+#define SI7021_I2C_STATS                                               /* 1 */ \
+        CONFIG_SI7021_I2C_STATS
+
 ////// Si7021 I2C Command Values -----------------------------------------------
 
 /* Measurements Commands */
@@ -112,6 +185,14 @@ typedef struct {
 #define SI7021_I2C_DEFAULT_I2C_DRIVER_RETRY_TIMEOUT_MS              /* 2000 */ \
         CONFIG_SI7021_I2C_DEFAULT_I2C_DRIVER_RETRY_TIMEOUT_MS
 
+/* Retry Policy */
+#define SI7021_I2C_DEFAULT_RETRY_BACKOFF_INITIAL_MS                    /* 5 */ \
+        CONFIG_SI7021_I2C_DEFAULT_RETRY_BACKOFF_INITIAL_MS
+#define SI7021_I2C_DEFAULT_RETRY_BACKOFF_MAX_MS                      /* 100 */ \
+        CONFIG_SI7021_I2C_DEFAULT_RETRY_BACKOFF_MAX_MS
+#define SI7021_I2C_DEFAULT_RETRY_BACKOFF_MULTIPLIER                    /* 2 */ \
+        CONFIG_SI7021_I2C_DEFAULT_RETRY_BACKOFF_MULTIPLIER
+
 /* I2C Driver Flags: install, set config & uninstall at delete */
 #define SI7021_I2C_DEFAULT_I2C_DRIVER_INSTALL                   /* (true) 1 */ \
         (bool)CONFIG_SI7021_I2C_DEFAULT_I2C_DRIVER_INSTALL
@@ -147,6 +228,16 @@ typedef struct {
     .i2c_port          = SI7021_I2C_DEFAULT_I2C_PORT,                          \
     .i2c_retry_timeout = SI7021_I2C_DEFAULT_I2C_DRIVER_RETRY_TIMEOUT_MS        \
                              / portTICK_PERIOD_MS,                             \
+    .retry_policy = {                                                          \
+        .backoff_initial    = SI7021_I2C_DEFAULT_RETRY_BACKOFF_INITIAL_MS      \
+                                  / portTICK_PERIOD_MS,                        \
+        .backoff_max        = SI7021_I2C_DEFAULT_RETRY_BACKOFF_MAX_MS          \
+                                  / portTICK_PERIOD_MS,                        \
+        .backoff_multiplier = SI7021_I2C_DEFAULT_RETRY_BACKOFF_MULTIPLIER,     \
+    },                                                                         \
+    .i2c_bus    = NULL,                                                        \
+    .address    = SI7021_I2C_ADDRESS,                                          \
+    .mux        = { .enable = false },                                         \
     .i2c_driver = {                                                            \
         .install             = SI7021_I2C_DEFAULT_I2C_DRIVER_INSTALL,          \
         .set_config          = SI7021_I2C_DEFAULT_I2C_DRIVER_SET_CONFIG,       \
@@ -180,36 +271,112 @@ esp_err_t si7021_i2c_create(
 esp_err_t si7021_i2c_delete(
     si7021_i2c_handle_t si7021_i2c );
 
+/* Retry Counters */
+esp_err_t si7021_i2c_get_retry_counters(
+    si7021_i2c_handle_t         const  si7021_i2c   ,
+    si7021_i2c_retry_counters_t       *out_counters );
+
+esp_err_t si7021_i2c_reset_retry_counters(
+    si7021_i2c_handle_t const si7021_i2c );
+
+/* Stats */
+/* ESP_ERR_NOT_SUPPORTED if built without SI7021_I2C_STATS. Like the retry
+ * counters, they are updated and copied under the handle lock, so they can be
+ * read while transfers are in progress on other tasks (or the esp_timer task).
+ */
+esp_err_t si7021_i2c_get_stats(
+    si7021_i2c_handle_t const  si7021_i2c ,
+    si7021_i2c_stats_t        *out_stats  );
+
+esp_err_t si7021_i2c_reset_stats(
+    si7021_i2c_handle_t const si7021_i2c );
+
+esp_err_t si7021_i2c_dump_stats(
+    si7021_i2c_handle_t const si7021_i2c );
+
 /* Measure */
+/* <wait_before_read_us> is slept in whole ticks, never past it. No hold master
+ * reads busy wait the sub-tick rest; hold master ones leave it to the sensor,
+ * which stretches SCL until the conversion is done. */
 esp_err_t si7021_i2c_measure_rh_hold_master(
-    si7021_i2c_handle_t const  si7021_i2c        ,
-    uint16_t                  *out_rh            ,
-    bool                       crc_check         ,
-    TickType_t                 wait_before_read );
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint16_t                  *out_rh              ,
+    bool                       crc_check           ,
+    uint32_t                   wait_before_read_us );
 
 esp_err_t si7021_i2c_measure_rh_nohold_master(
-    si7021_i2c_handle_t const  si7021_i2c        ,
-    uint16_t                  *out_rh            ,
-    bool                       crc_check         ,
-    TickType_t                 wait_before_read );
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint16_t                  *out_rh              ,
+    bool                       crc_check           ,
+    uint32_t                   wait_before_read_us );
 
 esp_err_t si7021_i2c_measure_temp_hold_master(
-    si7021_i2c_handle_t const  si7021_i2c        ,
-    uint16_t                  *out_temp          ,
-    bool                       crc_check         ,
-    TickType_t                 wait_before_read );
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint16_t                  *out_temp            ,
+    bool                       crc_check           ,
+    uint32_t                   wait_before_read_us );
 
 esp_err_t si7021_i2c_measure_temp_nohold_master(
-    si7021_i2c_handle_t const  si7021_i2c        ,
-    uint16_t                  *out_temp          ,
-    bool                       crc_check         ,
-    TickType_t                 wait_before_read );
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint16_t                  *out_temp            ,
+    bool                       crc_check           ,
+    uint32_t                   wait_before_read_us );
 
+/* No conversion takes place: with no <wait_before_read>, the command and the
+ * read go in a single repeated start transaction. */
 esp_err_t si7021_i2c_read_temp_from_prev_rh_measurement(
     si7021_i2c_handle_t const  si7021_i2c        ,
     uint16_t                  *out_temp          ,
     TickType_t                 wait_before_read );
 
+/* Measure RH, then read the temperature of the same conversion in one
+ * repeated start write-read (no wait). <crc_check> applies to RH only: the
+ * temperature reply carries no CRC. */
+esp_err_t si7021_i2c_measure_rh_and_temp_hold_master(
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint16_t                  *out_rh              ,
+    uint16_t                  *out_temp            ,
+    bool                       crc_check           ,
+    uint32_t                   wait_before_read_us );
+
+esp_err_t si7021_i2c_measure_rh_and_temp_nohold_master(
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint16_t                  *out_rh              ,
+    uint16_t                  *out_temp            ,
+    bool                       crc_check           ,
+    uint32_t                   wait_before_read_us );
+
+/* Measure (Split) */
+/* The no hold master measure command is written and the function returns
+ * right away, so that the conversion time can be spent elsewhere. The result
+ * is then fetched with si7021_i2c_read_measure_result: the sensor NACKs it
+ * (ESP_FAIL) while still converting. After an RH result, the temperature of
+ * the same conversion can be read with si7021_i2c_read_prev_temp_result.
+ * Each of these makes a single attempt and never sleeps between retries, so
+ * they can be used from the esp_timer task; retrying is up to the caller.
+ */
+esp_err_t si7021_i2c_start_measure_rh(
+    si7021_i2c_handle_t const si7021_i2c );
+
+esp_err_t si7021_i2c_start_measure_temp(
+    si7021_i2c_handle_t const si7021_i2c );
+
+esp_err_t si7021_i2c_read_measure_result(
+    si7021_i2c_handle_t const  si7021_i2c ,
+    uint16_t                  *out_data   ,
+    bool                       crc_check  );
+
+esp_err_t si7021_i2c_read_prev_temp_result(
+    si7021_i2c_handle_t const  si7021_i2c ,
+    uint16_t                  *out_temp   );
+
+/* Wait <wait_us> for a started conversion, as a no hold master measure does
+ * before its read (whole ticks asleep, the sub-tick rest busy). It sleeps:
+ * not for the esp_timer task. */
+esp_err_t si7021_i2c_wait_conversion(
+    si7021_i2c_handle_t const si7021_i2c ,
+    uint32_t                  wait_us    );
+
 /* Reset & Registers */
 esp_err_t si7021_i2c_reset(
     si7021_i2c_handle_t const si7021_i2c );
@@ -0,0 +1,32 @@
+#ifndef __SI7021_I2C_CONSOLE_H__
+#define __SI7021_I2C_CONSOLE_H__
+
+// INCLUDES --------------------------------------------------------------------
+
+#include "esp_err.h"    // esp_err_t
+#include "si7021_i2c.h" // si7021_i2c_handle_t
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define SI7021_I2C_CONSOLE_MAX_HANDLES 4
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS -------------------------------------------------------------------
+
+/* Console Command */
+/* Registers 'si7021_i2c_stats [-r]' on the esp_console REPL (once) and adds
+ * <si7021_i2c> to the handles it dumps; -r resets their stats after dumping.
+ * Unregister a handle before deleting it.
+ */
+esp_err_t si7021_i2c_console_register(
+    si7021_i2c_handle_t si7021_i2c );
+
+esp_err_t si7021_i2c_console_unregister(
+    si7021_i2c_handle_t si7021_i2c );
+
+// -----------------------------------------------------------------------------
+
+#endif // __SI7021_I2C_CONSOLE_H__
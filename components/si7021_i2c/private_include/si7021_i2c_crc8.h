@@ -0,0 +1,114 @@
+#ifndef __SI7021_I2C_CRC8_H__
+#define __SI7021_I2C_CRC8_H__
+
+// Si7021 CRC-8 in the three flavours SI7021_I2C_CRC_IMPL chooses from. Private
+// to si7021_i2c; its tests include it to check that they agree.
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>     // uint8_t, uint16_t
+#include "esp_attr.h"   // DRAM_ATTR
+#include "si7021_i2c.h" // SI7021_I2C_CRC_TABLE_IN_DRAM
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define CRC_POLY 0x31 // x^8 + x^5 + x^4 + 1
+#define CRC_INIT 0x00
+#define CRC_XOR  0x00
+
+/* Table Generator */
+/* One bit step of the CRC register, then 4 and 8 of them. The tables below
+ * are expanded by the preprocessor, so they are constant data with no
+ * runtime init (the 256-entry one costs some compile time, not code size).
+ * The one left unused by the configured implementation is dropped.
+ */
+#define CRC_STEP_1(c) ((((c) << 1) ^ (((c) & 0x80) ? CRC_POLY : 0)) & 0xFF)
+#define CRC_STEP_2(c) CRC_STEP_1(CRC_STEP_1(c))
+#define CRC_STEP_4(c) CRC_STEP_2(CRC_STEP_2(c))
+#define CRC_STEP_8(c) CRC_STEP_4(CRC_STEP_4(c))
+
+#define CRC_ROW_4(step, i)                                                     \
+    step((i) + 0), step((i) + 1), step((i) + 2), step((i) + 3)
+#define CRC_ROW_16(step, i)                                                    \
+    CRC_ROW_4(step, (i) +  0), CRC_ROW_4(step, (i) +  4),                      \
+    CRC_ROW_4(step, (i) +  8), CRC_ROW_4(step, (i) + 12)
+
+// -----------------------------------------------------------------------------
+
+// TABLES ----------------------------------------------------------------------
+
+/* Byte Table: CRC register after shifting 8 bits out of <i> */
+#if SI7021_I2C_CRC_TABLE_IN_DRAM
+static const DRAM_ATTR uint8_t _crc8_table[256] = {
+#else
+static const uint8_t _crc8_table[256] = {
+#endif
+    CRC_ROW_16(CRC_STEP_8, 0x00), CRC_ROW_16(CRC_STEP_8, 0x10),
+    CRC_ROW_16(CRC_STEP_8, 0x20), CRC_ROW_16(CRC_STEP_8, 0x30),
+    CRC_ROW_16(CRC_STEP_8, 0x40), CRC_ROW_16(CRC_STEP_8, 0x50),
+    CRC_ROW_16(CRC_STEP_8, 0x60), CRC_ROW_16(CRC_STEP_8, 0x70),
+    CRC_ROW_16(CRC_STEP_8, 0x80), CRC_ROW_16(CRC_STEP_8, 0x90),
+    CRC_ROW_16(CRC_STEP_8, 0xA0), CRC_ROW_16(CRC_STEP_8, 0xB0),
+    CRC_ROW_16(CRC_STEP_8, 0xC0), CRC_ROW_16(CRC_STEP_8, 0xD0),
+    CRC_ROW_16(CRC_STEP_8, 0xE0), CRC_ROW_16(CRC_STEP_8, 0xF0),
+};
+
+/* Nibble Table: CRC register after shifting 4 bits out of <i> << 4 */
+#define CRC_NIBBLE(i) CRC_STEP_4((i) << 4)
+#if SI7021_I2C_CRC_TABLE_IN_DRAM
+static const DRAM_ATTR uint8_t _crc8_nibble_table[16] = {
+#else
+static const uint8_t _crc8_nibble_table[16] = {
+#endif
+    CRC_ROW_16(CRC_NIBBLE, 0x00),
+};
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS -------------------------------------------------------------------
+
+/* Each one returns the CRC register <crc> updated with <bytes> (no final
+ * XOR): one lookup per byte, two per byte, or eight shift steps per byte.
+ */
+static inline uint8_t _crc8_update_table(
+    uint8_t        crc   ,
+    uint8_t const *bytes ,
+    uint16_t       count )
+{
+    for (int i = 0; i < count; i++)
+        crc = _crc8_table[crc ^ bytes[i]];
+    return crc;
+}
+
+static inline uint8_t _crc8_update_nibble(
+    uint8_t        crc   ,
+    uint8_t const *bytes ,
+    uint16_t       count )
+{
+    for (int i = 0; i < count; i++) {
+        crc ^= bytes[i];
+        crc = (crc << 4) ^ _crc8_nibble_table[crc >> 4];
+        crc = (crc << 4) ^ _crc8_nibble_table[crc >> 4];
+    }
+    return crc;
+}
+
+static inline uint8_t _crc8_update_bitwise(
+    uint8_t        crc   ,
+    uint8_t const *bytes ,
+    uint16_t       count )
+{
+    for (int i = 0; i < count; i++) {
+        crc ^= bytes[i];
+        for (int j = 0; j < 8; j++)
+            if (crc & 0x80) crc = (crc << 1) ^ CRC_POLY;
+            else            crc = (crc << 1);
+    }
+    return crc;
+}
+
+// -----------------------------------------------------------------------------
+
+#endif // __SI7021_I2C_CRC8_H__
@@ -0,0 +1,1304 @@
+#include "si7021_i2c.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdlib.h>         // for calloc, free
+#include "string.h"         // for strncpy, memset
+#include "esp_err.h"        // for ESP errors
+#include "i2c_bus.h"        // for shared I2C bus
+#include "freertos/task.h"  // for vTaskDelay, xTaskCheckForTimeOut
+#include "esp_timer.h"      // for esp_timer_get_time (waits & stats)
+#include "esp_rom_sys.h"    // for esp_rom_delay_us
+
+#include "si7021_i2c_crc8.h" // for CRC-8 implementations (private)
+
+/* Logging */
+#include "esp_log.h"
+static const char *TAG = "Si7021 I2C";
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Si7021 I2C Handle */
+struct si7021_i2c_handle {
+    char name[SI7021_I2C_HANDLE_NAME_LENGTH]; // Handle name
+
+    i2c_port_t              i2c_port;          // I2C port
+    TickType_t              i2c_retry_timeout; // I2C retry timeout
+    i2c_bus_handle_t        bus;               // Bus owning the port
+    bool                    bus_delete;        // Bus created here, delete it
+    i2c_bus_device_handle_t device;            // Si7021 on the bus
+
+    si7021_i2c_retry_policy_t   retry_policy;   // Backoff between retries
+    si7021_i2c_retry_counters_t retry_counters; // Per-handle retry counters
+    portMUX_TYPE                lock;           // Protects counters & stats
+
+#if SI7021_I2C_STATS
+    si7021_i2c_stats_t stats; // Latency histograms & CRC counters
+#endif
+};
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+//// CREATE & DELETE -----------------------------------------------------------
+
+#define CHECK_ERR_CREATE_ARGS(create_args)                                     \
+    if (!create_args) {                                                        \
+        ESP_LOGE(TAG, "Pointer to si7021_i2c_create_args_t is NULL.");         \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_HANDLE(out_handle)                                       \
+    if (!out_handle) {                                                         \
+        ESP_LOGE(TAG, "Pointer to si7021_i2c_handle_t is NULL.");              \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define LOG_I2C_DRIVER_CONFIG(config)                                          \
+    ESP_LOGI(TAG, "I2C driver configuration:\n"                                \
+                  "  > Mode: %s\n"                                             \
+                  "  > SDA GPIO: %d (pull-up: %s)\n"                           \
+                  "  > SCL GPIO: %d (pull-up: %s)\n"                           \
+                  "  > Clock Speed: %d Hz",                                    \
+                    config.mode == I2C_MODE_MASTER ? "Master" : "Slave",       \
+                    config.sda_io_num,                                         \
+                    config.sda_pullup_en ? "yes" : "no",                       \
+                    config.scl_io_num,                                         \
+                    config.scl_pullup_en ? "yes" : "no",                       \
+                    (int) config.master.clk_speed                              \
+    );                                                                         \
+    if (config.master.clk_speed > SI7021_I2C_MAX_CLOCK_SPEED) {                \
+        ESP_LOGW(TAG, "I2C clock speed is greater than maximum recommended "   \
+                      "value of %d Hz.", SI7021_I2C_MAX_CLOCK_SPEED);          \
+    }
+
+#define CHECK_ERR_I2C_MODE_IS_MASTER(mode, handle)                             \
+    if (mode != I2C_MODE_MASTER) {                                             \
+        ESP_LOGE(TAG, "I2C driver mode is not I2C_MODE_MASTER.");              \
+        free(handle);                                                          \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_I2C_BUS_CREATE(err, handle)                                  \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not create I2C bus: %s", esp_err_to_name(err));   \
+        free(handle);                                                          \
+        return err;                                                            \
+    }
+
+#define CHECK_ERR_I2C_BUS_ADD_DEVICE(err, handle)                              \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not add Si7021 to I2C bus: %s",                   \
+            esp_err_to_name(err));                                             \
+        if (handle->bus_delete) i2c_bus_delete(handle->bus);                   \
+        free(handle);                                                          \
+        return err;                                                            \
+    }
+
+#define CHECK_ERR_MALLOC(ptr)                                                  \
+    if (!ptr) {                                                                \
+        ESP_LOGE(TAG, "Could not allocate memory.");                           \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+#define CHECK_WARN_I2C_CLOCK_SPEED(i2c_clock_speed)                            \
+    if (i2c_clock_speed > SI7021_I2C_MAX_CLOCK_SPEED) {                        \
+        ESP_LOGW(TAG, "I2C clock speed is greater than maximum recommended "   \
+                      "value of %d Hz.", SI7021_I2C_MAX_CLOCK_SPEED);          \
+    }
+
+#define CHECK_WARN_I2C_BUS_DELETE(err)                                         \
+    if (err) {                                                                 \
+        ESP_LOGW(TAG, "Could not delete I2C bus: %s", esp_err_to_name(err));   \
+    }
+
+//// ---------------------------------------------------------------------------
+
+//// HANDLE & OUT PARAM ERRORS -------------------------------------------------
+
+#define CHECK_ERR_HANDLE(handle)                                               \
+    if (!handle) {                                                             \
+        ESP_LOGE(TAG, "Si7021 I2C handle is NULL.");                           \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_PARAM(out_param)                                         \
+    if (!out_param) {                                                          \
+        ESP_LOGE(TAG, "Pointer to out parameter is NULL.");                    \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+//// ---------------------------------------------------------------------------
+
+//// I2C ERRORS ----------------------------------------------------------------
+
+#define CHECK_ERR_SI7021_I2C_WRITE(err)                                        \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not write to Si7021: %s", esp_err_to_name(err));  \
+        return err;                                                            \
+    }
+
+#define CHECK_ERR_SI7021_I2C_READ(err)                                         \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not read from Si7021: %s", esp_err_to_name(err)); \
+        return err;                                                            \
+    }
+
+#define CHECK_ERR_SI7021_I2C_DO_WRITE_THEN_READ(err)                           \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not write then read from Si7021: %s",             \
+            esp_err_to_name(err));                                             \
+        return err;                                                            \
+    }
+
+//// ---------------------------------------------------------------------------
+
+//// CRC ERRORS ----------------------------------------------------------------
+
+#define CHECK_ERR_COMPARE_MEASURE_CRC(byte_0, byte_1, calc, recv)              \
+    if (calc != recv) {                                                        \
+        ESP_LOGE(TAG, "CRC check failed:\n"                                    \
+                          " - From > 0x%02x 0x%02x\n"                          \
+                          " - Calc > 0x%02x\n"                                 \
+                          " - Recv > 0x%02x",                                  \
+                          byte_0, byte_1, calc, recv                           \
+        );                                                                     \
+        return ESP_ERR_INVALID_CRC;                                            \
+    }
+
+#define CHECK_ERR_COMPARE_FIRST_EID_CRC(init, byte, calc, recv)                \
+    if (calc != recv) {                                                        \
+        ESP_LOGE(TAG, "CRC check failed:\n"                                \
+                          " - Init > 0x%02x\n"                                 \
+                          " - From > 0x%02x\n"                                 \
+                          " - Calc > 0x%02x\n"                                 \
+                          " - Recv > 0x%02x",                                  \
+                          init, byte, calc, recv                               \
+        );                                                                     \
+        return ESP_ERR_INVALID_CRC;                                            \
+    }
+
+#define CHECK_ERR_COMPARE_LAST_EID_CRC(init, byte_0, byte_1, calc, recv)       \
+    if (calc != recv) {                                                        \
+        ESP_LOGE(TAG, "CRC check failed:\n"                                \
+                          " - Init > 0x%02x\n"                                 \
+                          " - From > 0x%02x 0x%02x\n"                          \
+                          " - Calc > 0x%02x\n"                                 \
+                          " - Recv > 0x%02x",                                  \
+                          init, byte_0, byte_1, calc, recv                     \
+        );                                                                     \
+        return ESP_ERR_INVALID_CRC;                                            \
+    }
+
+//// ---------------------------------------------------------------------------
+
+//// CONVERSIONS FROM UINT8_T --------------------------------------------------
+
+#define UINT16_T_FROM_UINT8_T(uint8_1, uint8_0)                                \
+    ((uint16_t) uint8_1 << 8) |                                                \
+    ((uint16_t) uint8_0 << 0)
+
+#define UINT32_T_FROM_UINT8_T(uint8_3, uint8_2, uint8_1, uint8_0)              \
+    ((uint32_t) uint8_3 << 24) |                                               \
+    ((uint32_t) uint8_2 << 16) |                                               \
+    ((uint32_t) uint8_1 <<  8) |                                               \
+    ((uint32_t) uint8_0 <<  0)
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+//// CRC -----------------------------------------------------------------------
+
+/* CRC-8 of <bytes> with the implementation chosen in Kconfig (all three are
+ * in si7021_i2c_crc8.h) */
+static uint8_t _crc8_general(
+    uint8_t  *bytes ,
+    uint16_t  count ,
+    uint8_t   init  ,
+    uint8_t   xor   )
+{
+#if SI7021_I2C_CRC_IMPL_TABLE
+    return _crc8_update_table(init, bytes, count) ^ xor;
+#elif SI7021_I2C_CRC_IMPL_NIBBLE
+    return _crc8_update_nibble(init, bytes, count) ^ xor;
+#else
+    return _crc8_update_bitwise(init, bytes, count) ^ xor;
+#endif
+}
+
+static inline uint8_t _crc8(
+    uint8_t  *bytes ,
+    uint16_t  count )
+{ return _crc8_general(bytes, count, CRC_INIT, CRC_XOR); }
+
+//// ---------------------------------------------------------------------------
+
+
+//// Stats ---------------------------------------------------------------------
+
+/* Without SI7021_I2C_STATS these are empty and compiled out at the call sites
+ * (no clock reads either).
+ */
+
+/* Stats Clock (us) */
+static inline int64_t _si7021_i2c_stats_now(void)
+{
+#if SI7021_I2C_STATS
+    return esp_timer_get_time();
+#else
+    return 0;
+#endif
+}
+
+/* Log2 Bucket of <value> (0 and 1 go to bucket 0) */
+static inline uint32_t _si7021_i2c_stats_log2(
+    uint32_t value   ,
+    uint32_t buckets )
+{
+    uint32_t bucket = 31 - __builtin_clz(value | 1);
+    return bucket < buckets ? bucket : buckets - 1;
+}
+
+/* Add a Latency since <start_us> to <histogram> */
+static inline void _si7021_i2c_stats_latency(
+    si7021_i2c_histogram_t *histogram ,
+    int64_t                 start_us  )
+{
+#if SI7021_I2C_STATS
+    int64_t  elapsed_us = _si7021_i2c_stats_now() - start_us;
+    uint32_t us = elapsed_us > UINT32_MAX ? UINT32_MAX : (uint32_t) elapsed_us;
+
+    histogram->count++;
+    histogram->total_us += us;
+    if (us > histogram->max_us) histogram->max_us = us;
+    histogram->buckets[_si7021_i2c_stats_log2(us, SI7021_I2C_STATS_BUCKETS)]++;
+#endif
+}
+
+/* Add a Wait (conversion time between write and read) */
+static inline void _si7021_i2c_stats_wait(
+    si7021_i2c_handle_t const si7021_i2c ,
+    int64_t                   start_us   )
+{
+#if SI7021_I2C_STATS
+    portENTER_CRITICAL(&si7021_i2c->lock);
+    _si7021_i2c_stats_latency(&si7021_i2c->stats.wait, start_us);
+    portEXIT_CRITICAL(&si7021_i2c->lock);
+#endif
+}
+
+/* Add a Transfer (latency by kind & retry count) */
+static inline void _si7021_i2c_stats_transfer(
+    si7021_i2c_handle_t const si7021_i2c ,
+    size_t                    write_len  ,
+    size_t                    read_len   ,
+    int64_t                   start_us   ,
+    uint32_t                  retries    )
+{
+#if SI7021_I2C_STATS
+    si7021_i2c_stats_t *stats = &si7021_i2c->stats;
+    uint32_t bucket = retries ? 1 + _si7021_i2c_stats_log2(
+        retries, SI7021_I2C_STATS_RETRY_BUCKETS - 1) : 0;
+
+    portENTER_CRITICAL(&si7021_i2c->lock);
+    _si7021_i2c_stats_latency(
+        write_len && read_len ? &stats->write_read :
+        write_len             ? &stats->write      : &stats->read, start_us);
+
+    // > Retries: 0, 1, 2-3, 4-7, ...
+    stats->retries[bucket]++;
+    portEXIT_CRITICAL(&si7021_i2c->lock);
+#endif
+}
+
+/* Add a CRC Check */
+static inline void _si7021_i2c_stats_crc(
+    si7021_i2c_handle_t const si7021_i2c ,
+    bool                      ok         )
+{
+#if SI7021_I2C_STATS
+    portENTER_CRITICAL(&si7021_i2c->lock);
+    si7021_i2c->stats.crc_checks++;
+    if (!ok) si7021_i2c->stats.crc_failures++;
+    portEXIT_CRITICAL(&si7021_i2c->lock);
+#endif
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Si7021 I2C ----------------------------------------------------------------
+
+/* I2C Transfer (write, read or both) with Retry Policy */
+/* Failed attempts are classified from the driver error:
+ *  - ESP_FAIL: the sensor NACKed (e.g. still converting). Retried.
+ *  - ESP_ERR_TIMEOUT before the time given to the driver ran out: the
+ *    transaction was aborted by the bus (arbitration lost, SCL held) and the
+ *    driver has reset its FSM. Retried.
+ *  - ESP_ERR_TIMEOUT after that time: the retry timeout is used up.
+ *  - Anything else (driver not installed, bad args): returned at once.
+ * Between retries the task sleeps for the policy backoff instead of spinning.
+ * Without <retry> a single attempt is made and nothing sleeps (for callers in
+ * the esp_timer task); a NACK is then not counted as a failure, as the sensor
+ * NACKs reads while converting.
+ */
+/* With both write and read, they go in one transaction (repeated start), and
+ * a retry repeats both. Counters are added to the handle once, at the end.
+ */
+static esp_err_t _si7021_i2c_transfer(
+    si7021_i2c_handle_t const  si7021_i2c ,
+    uint8_t                   *write_data ,
+    size_t                     write_len  ,
+    uint8_t                   *read_data  ,
+    size_t                     read_len   ,
+    bool                       retry      )
+{
+    si7021_i2c_retry_policy_t   const *policy = &si7021_i2c->retry_policy;
+    si7021_i2c_retry_counters_t        delta  = { .transfers = 1 };
+    esp_err_t err = ESP_OK;
+
+    TimeOut_t  timeout;
+    TickType_t remaining = si7021_i2c->i2c_retry_timeout;
+    TickType_t backoff   = policy->backoff_initial;
+    if (!backoff) backoff = 1;
+    vTaskSetTimeOutState(&timeout);
+
+    int64_t start_us = _si7021_i2c_stats_now();
+
+    while (1) {
+        // > Attempt (the bus may block for the remaining time)
+        TickType_t start_ticks = xTaskGetTickCount();
+        i2c_bus_transaction_t txn = {
+            .write_data = write_data, .write_len = write_len,
+            .read_data  = read_data,  .read_len  = read_len,
+            .priority   = I2C_BUS_PRIORITY_NORMAL,
+            .timeout    = remaining };
+        err = i2c_bus_transfer(si7021_i2c->device, &txn, remaining);
+        TickType_t elapsed = xTaskGetTickCount() - start_ticks;
+        if (err == ESP_OK) break;
+
+        // > Classify
+        if      (err == ESP_FAIL)             delta.nacks++;
+        else if (err != ESP_ERR_TIMEOUT)      break;
+        else if (elapsed < remaining)         delta.arbitrations++;
+        else                                { delta.timeouts++; break; }
+
+        // > Backoff (yield), without going past the retry timeout
+        if (!retry) break;
+        if (xTaskCheckForTimeOut(&timeout, &remaining)) break;
+        vTaskDelay(backoff < remaining ? backoff : remaining);
+        if (xTaskCheckForTimeOut(&timeout, &remaining)) break;
+
+        delta.retries++;
+        backoff *= policy->backoff_multiplier;
+        if (backoff > policy->backoff_max) backoff = policy->backoff_max;
+        if (!backoff)                      backoff = 1;
+    }
+
+    if (err && (retry || err != ESP_FAIL)) delta.failures++;
+
+    // > Add Counters
+    portENTER_CRITICAL(&si7021_i2c->lock);
+    si7021_i2c->retry_counters.transfers    += delta.transfers;
+    si7021_i2c->retry_counters.retries      += delta.retries;
+    si7021_i2c->retry_counters.nacks        += delta.nacks;
+    si7021_i2c->retry_counters.timeouts     += delta.timeouts;
+    si7021_i2c->retry_counters.arbitrations += delta.arbitrations;
+    si7021_i2c->retry_counters.failures     += delta.failures;
+    portEXIT_CRITICAL(&si7021_i2c->lock);
+
+    _si7021_i2c_stats_transfer(
+        si7021_i2c, write_len, read_len, start_us, delta.retries);
+    return err;
+}
+
+/* I2C Write */
+static inline esp_err_t _si7021_i2c_write(
+    si7021_i2c_handle_t const  si7021_i2c ,
+    uint8_t                   *data       ,
+    size_t                     data_len   )
+{ return _si7021_i2c_transfer(si7021_i2c, data, data_len, NULL, 0, true); }
+
+/* I2C Read */
+static inline esp_err_t _si7021_i2c_read(
+    si7021_i2c_handle_t const  si7021_i2c ,
+    uint8_t                   *data       ,
+    size_t                     data_len   )
+{ return _si7021_i2c_transfer(si7021_i2c, NULL, 0, data, data_len, true); }
+
+/* I2C Write then Read (repeated start) */
+static inline esp_err_t _si7021_i2c_write_read(
+    si7021_i2c_handle_t const  si7021_i2c     ,
+    uint8_t                   *write_data     ,
+    size_t                     write_data_len ,
+    uint8_t                   *read_data      ,
+    size_t                     read_data_len  )
+{
+    return _si7021_i2c_transfer(
+        si7021_i2c, write_data, write_data_len, read_data, read_data_len, true);
+}
+
+/* Wait <wait_us>: asleep for the whole ticks that fit before the deadline
+ * (vTaskDelay(n) ends within the nth tick), then, with <busy_rest>, busy for
+ * the sub-tick rest. Without it the rest is left to the sensor (a hold master
+ * read stretches SCL until the conversion is done).
+ */
+static void _si7021_i2c_wait(
+    si7021_i2c_handle_t const si7021_i2c ,
+    uint32_t                  wait_us    ,
+    bool                      busy_rest  )
+{
+    if (!wait_us) return;
+
+    int64_t start_us    = esp_timer_get_time();
+    int64_t deadline_us = start_us + wait_us;
+    int64_t tick_us     = portTICK_PERIOD_MS * 1000;
+    int64_t left_us;
+
+    while ((left_us = deadline_us - esp_timer_get_time()) >= tick_us)
+        vTaskDelay((TickType_t) (left_us / tick_us));
+    if (busy_rest && left_us > 0) esp_rom_delay_us((uint32_t) left_us);
+
+    _si7021_i2c_stats_wait(si7021_i2c, start_us);
+}
+
+// > Do Write, Wait then Read
+static esp_err_t _si7021_do_write_wait_read(
+    si7021_i2c_handle_t const  si7021_i2c     ,
+    uint8_t                   *write_data     ,
+    size_t                     write_data_len ,
+    uint8_t                   *read_data      ,
+    size_t                     read_data_len  ,
+    uint32_t                   wait_us        ,
+    bool                       busy_rest      )
+{
+    esp_err_t err = ESP_OK;
+
+    // > I2C Write
+    err = _si7021_i2c_write(
+        si7021_i2c         ,
+        write_data         ,
+        write_data_len    );
+    CHECK_ERR_SI7021_I2C_WRITE(err);
+
+    // > Wait before read
+    _si7021_i2c_wait(si7021_i2c, wait_us, busy_rest);
+
+    // > I2C Read
+    err = _si7021_i2c_read(
+        si7021_i2c         ,
+        read_data          ,
+        read_data_len     );
+    CHECK_ERR_SI7021_I2C_READ(err);
+
+    return err;
+}
+
+// > Do Write then Read (waiting whole ticks)
+esp_err_t _si7021_do_write_then_read(
+    si7021_i2c_handle_t const  si7021_i2c       ,
+    uint8_t                   *write_data       ,
+    size_t                     write_data_len   ,
+    uint8_t                   *read_data        ,
+    size_t                     read_data_len    ,
+    TickType_t                 wait_before_read )
+{
+    return _si7021_do_write_wait_read(
+        si7021_i2c                                                  ,
+        write_data                                                  ,
+        write_data_len                                              ,
+        read_data                                                   ,
+        read_data_len                                               ,
+        (uint32_t) wait_before_read * portTICK_PERIOD_MS * 1000     ,
+        false                                                      );
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Si7021 I2C Commands Util --------------------------------------------------
+
+esp_err_t _si7021_i2c_parse_measure(
+    si7021_i2c_handle_t const  si7021_i2c ,
+    uint8_t                   *data       ,
+    uint16_t                  *out_data   ,
+    bool                       crc_check  )
+{
+    // > Check CRC
+    if (crc_check) {
+        uint8_t crc = _crc8(&data[0], 2);
+        _si7021_i2c_stats_crc(si7021_i2c, crc == data[2]);
+        CHECK_ERR_COMPARE_MEASURE_CRC(data[0], data[1], crc, data[2]);
+    }
+
+    // > Parse Data
+    *out_data = UINT16_T_FROM_UINT8_T(data[0], data[1]);
+
+    return ESP_OK;
+}
+
+/* Hold master measure commands: the sensor stretches SCL through the rest of
+ * the conversion, so only no hold master waits are completed busy.
+ */
+static inline bool _si7021_i2c_is_hold_master(
+    uint8_t command )
+{
+    return command == SI7021_I2C_CMD_MEASURE_RH_HOLD_MASTER ||
+           command == SI7021_I2C_CMD_MEASURE_TEMP_HOLD_MASTER;
+}
+
+esp_err_t _si7021_i2c_do_measure_command(
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint8_t                    command             ,
+    uint16_t                  *out_data            ,
+    bool                       crc_check           ,
+    uint32_t                   wait_before_read_us )
+{
+    esp_err_t err = ESP_OK;
+
+    // > Write <command>, wait for the conversion, then read <data>
+    uint8_t data[3] = {0};
+    err = _si7021_do_write_wait_read(
+        si7021_i2c                           ,
+        &command                             ,
+        1                                    ,
+        data                                 ,
+        crc_check ? 3 : 2                    ,
+        wait_before_read_us                  ,
+        !_si7021_i2c_is_hold_master(command) );
+    CHECK_ERR_SI7021_I2C_DO_WRITE_THEN_READ(err);
+
+    // > Check CRC & Parse Data
+    return _si7021_i2c_parse_measure(si7021_i2c, data, out_data, crc_check);
+}
+
+/* Measure RH, then read the temperature of that conversion (0xE0). There is
+ * no conversion behind 0xE0, so it goes as a single write-read with no wait.
+ * 0xE0 replies carry no CRC: only the RH one is checked, after both reads.
+ */
+esp_err_t _si7021_i2c_do_measure_rh_and_temp_command(
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint8_t                    command             ,
+    uint16_t                  *out_rh              ,
+    uint16_t                  *out_temp            ,
+    bool                       crc_check           ,
+    uint32_t                   wait_before_read_us )
+{
+    esp_err_t err = ESP_OK;
+
+    // > Write <command>, wait for the conversion, then read RH <data>
+    uint8_t rh_data[3] = {0};
+    err = _si7021_do_write_wait_read(
+        si7021_i2c                           ,
+        &command                             ,
+        1                                    ,
+        rh_data                              ,
+        crc_check ? 3 : 2                    ,
+        wait_before_read_us                  ,
+        !_si7021_i2c_is_hold_master(command) );
+    CHECK_ERR_SI7021_I2C_DO_WRITE_THEN_READ(err);
+
+    // > Write 0xE0 & read temp <data> (repeated start)
+    uint8_t temp_command = SI7021_I2C_CMD_READ_TEMP_FROM_PREV_RH_MEASUREMENT;
+    uint8_t temp_data[2] = {0};
+    err = _si7021_i2c_write_read(
+        si7021_i2c        ,
+        &temp_command     ,
+        1                 ,
+        temp_data         ,
+        2                );
+    CHECK_ERR_SI7021_I2C_DO_WRITE_THEN_READ(err);
+
+    // > Check CRC & Parse Data
+    err = _si7021_i2c_parse_measure(si7021_i2c, rh_data, out_rh, crc_check);
+    if (err) return err;
+    *out_temp = UINT16_T_FROM_UINT8_T(temp_data[0], temp_data[1]);
+
+    return err;
+}
+
+esp_err_t _si7021_i2c_do_read_reg_command(
+    si7021_i2c_handle_t const  si7021_i2c       ,
+    uint8_t                    command          ,
+    uint8_t                   *out_reg_value    ,
+    TickType_t                 wait_before_read )
+{
+    esp_err_t err = ESP_OK;
+
+    // > Write <command> then read <reg_value>
+    uint8_t reg_value;
+    err = _si7021_do_write_then_read(
+        si7021_i2c        ,
+        &command          ,
+        1                 ,
+        &reg_value        ,
+        1                 ,
+        wait_before_read  );
+    CHECK_ERR_SI7021_I2C_DO_WRITE_THEN_READ(err);
+
+    // > Parse Data
+    *out_reg_value = reg_value;
+
+    return err;
+}
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+//// Create & Delete -----------------------------------------------------------
+
+// > Create Si7021 I2C Handle
+esp_err_t si7021_i2c_create(
+    si7021_i2c_create_args_t const *create_args ,
+    si7021_i2c_handle_t            *out_handle  )
+{
+    CHECK_ERR_CREATE_ARGS(create_args);
+    CHECK_ERR_OUT_HANDLE(out_handle);
+    esp_err_t err = ESP_OK;
+
+    // > Allocate Memory for Handle
+    *out_handle = calloc(1, sizeof(struct si7021_i2c_handle));
+    CHECK_ERR_MALLOC(*out_handle);
+    si7021_i2c_handle_t si7021_i2c = *out_handle;
+    portMUX_INITIALIZE(&si7021_i2c->lock);
+
+    // > Set Handle
+    /* Name */
+    strncpy(
+        si7021_i2c->name                   ,
+        create_args->name                  ,
+        SI7021_I2C_HANDLE_NAME_LENGTH - 1 );
+
+    /* Port & Retry Timeout */
+    si7021_i2c->i2c_port          = create_args->i2c_port;
+    si7021_i2c->i2c_retry_timeout = create_args->i2c_retry_timeout;
+
+    // > I2C Bus: given, already owning the port, or created here
+    si7021_i2c->bus = create_args->i2c_bus;
+    if (!si7021_i2c->bus &&
+        i2c_bus_get(create_args->i2c_port, &si7021_i2c->bus) != ESP_OK) {
+
+        i2c_bus_create_args_t bus_args = I2C_BUS_DEFAULT_CREATE_ARGS();
+        bus_args.i2c_port              = create_args->i2c_port;
+        bus_args.i2c_driver.install    = create_args->i2c_driver.install;
+        bus_args.i2c_driver.set_config = create_args->i2c_driver.set_config;
+        bus_args.i2c_driver.config     = create_args->i2c_driver.config;
+
+        if (create_args->i2c_driver.install &&
+            create_args->i2c_driver.set_config) {
+            CHECK_ERR_I2C_MODE_IS_MASTER(
+                create_args->i2c_driver.config.mode, si7021_i2c);
+            LOG_I2C_DRIVER_CONFIG(create_args->i2c_driver.config);
+        }
+
+        ESP_LOGI(TAG, "Creating I2C bus...");
+        err = i2c_bus_create(&bus_args, &si7021_i2c->bus);
+        CHECK_ERR_I2C_BUS_CREATE(err, si7021_i2c);
+        si7021_i2c->bus_delete = create_args->i2c_driver.uninstall_at_delete;
+    }
+
+    // > Add Si7021 to the Bus (behind a mux channel?)
+    err = i2c_bus_add_mux_device(
+        si7021_i2c->bus      ,
+        si7021_i2c->name     ,
+        create_args->address ,
+        &create_args->mux    ,
+        &si7021_i2c->device );
+    CHECK_ERR_I2C_BUS_ADD_DEVICE(err, si7021_i2c);
+
+    /* Retry Policy (counters start at 0) */
+    si7021_i2c->retry_policy = create_args->retry_policy;
+    if (!si7021_i2c->retry_policy.backoff_multiplier)
+        si7021_i2c->retry_policy.backoff_multiplier = 1;
+    
+    return err;
+}
+
+// > Delete Si7021 I2C Handle
+esp_err_t si7021_i2c_delete(
+    si7021_i2c_handle_t si7021_i2c )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    esp_err_t err = ESP_OK;
+
+    // > Remove from Bus
+    i2c_bus_remove_device(si7021_i2c->device);
+
+    // > Delete I2C Bus (and its driver) if created here?
+    if (si7021_i2c->bus_delete) {
+        ESP_LOGI(TAG, "Deleting I2C bus...");
+        err = i2c_bus_delete(si7021_i2c->bus);
+        CHECK_WARN_I2C_BUS_DELETE(err);
+    }
+
+    // > Free Memory
+    free(si7021_i2c);
+
+    return err;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Retry Counters ------------------------------------------------------------
+
+/* Get Retry Counters */
+esp_err_t si7021_i2c_get_retry_counters(
+    si7021_i2c_handle_t         const  si7021_i2c   ,
+    si7021_i2c_retry_counters_t       *out_counters )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_counters);
+    portENTER_CRITICAL(&si7021_i2c->lock);
+    *out_counters = si7021_i2c->retry_counters;
+    portEXIT_CRITICAL(&si7021_i2c->lock);
+    return ESP_OK;
+}
+
+/* Reset Retry Counters */
+esp_err_t si7021_i2c_reset_retry_counters(
+    si7021_i2c_handle_t const si7021_i2c )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    portENTER_CRITICAL(&si7021_i2c->lock);
+    memset(&si7021_i2c->retry_counters, 0, sizeof(si7021_i2c->retry_counters));
+    portEXIT_CRITICAL(&si7021_i2c->lock);
+    return ESP_OK;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Stats ---------------------------------------------------------------------
+
+/* Get Stats */
+esp_err_t si7021_i2c_get_stats(
+    si7021_i2c_handle_t const  si7021_i2c ,
+    si7021_i2c_stats_t        *out_stats  )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_stats);
+#if SI7021_I2C_STATS
+    portENTER_CRITICAL(&si7021_i2c->lock);
+    *out_stats = si7021_i2c->stats;
+    portEXIT_CRITICAL(&si7021_i2c->lock);
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/* Reset Stats */
+esp_err_t si7021_i2c_reset_stats(
+    si7021_i2c_handle_t const si7021_i2c )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+#if SI7021_I2C_STATS
+    portENTER_CRITICAL(&si7021_i2c->lock);
+    memset(&si7021_i2c->stats, 0, sizeof(si7021_i2c->stats));
+    portEXIT_CRITICAL(&si7021_i2c->lock);
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/* Dump Histogram (non-empty buckets only) */
+static void _si7021_i2c_dump_histogram(
+    const char                   *label     ,
+    si7021_i2c_histogram_t const *histogram )
+{
+    ESP_LOGI(TAG, " - %-10s %u (mean %u us, max %u us)"        ,
+        label                                                  ,
+        (unsigned) histogram->count                            ,
+        (unsigned) (histogram->count ?
+            histogram->total_us / histogram->count : 0)        ,
+        (unsigned) histogram->max_us                          );
+
+    for (int i = 0; i < SI7021_I2C_STATS_BUCKETS; i++) {
+        if (!histogram->buckets[i]) continue;
+        if (i == SI7021_I2C_STATS_BUCKETS - 1)
+            ESP_LOGI(TAG, "   - >= %7u us: %u", 1u << i,
+                (unsigned) histogram->buckets[i]);
+        else
+            ESP_LOGI(TAG, "   - < %8u us: %u", 2u << i,
+                (unsigned) histogram->buckets[i]);
+    }
+}
+
+/* Dump Stats */
+esp_err_t si7021_i2c_dump_stats(
+    si7021_i2c_handle_t const si7021_i2c )
+{
+    si7021_i2c_stats_t stats;
+    esp_err_t err = si7021_i2c_get_stats(si7021_i2c, &stats);
+    if (err) return err;
+
+    ESP_LOGI(TAG, "Si7021 I2C Stats (%s):", si7021_i2c->name);
+    _si7021_i2c_dump_histogram("Write:",      &stats.write);
+    _si7021_i2c_dump_histogram("Read:",       &stats.read);
+    _si7021_i2c_dump_histogram("Write-Read:", &stats.write_read);
+    _si7021_i2c_dump_histogram("Wait:",       &stats.wait);
+
+    ESP_LOGI(TAG, " - Retries per transfer:");
+    for (int i = 0; i < SI7021_I2C_STATS_RETRY_BUCKETS; i++) {
+        if (!stats.retries[i]) continue;
+        unsigned low  = i ? 1u << (i - 1) : 0;
+        unsigned high = i ? (2u << (i - 1)) - 1 : 0;
+        if (i == SI7021_I2C_STATS_RETRY_BUCKETS - 1)
+            ESP_LOGI(TAG, "   - >= %u: %u", low, (unsigned) stats.retries[i]);
+        else
+            ESP_LOGI(TAG, "   - %u-%u: %u", low, high,
+                (unsigned) stats.retries[i]);
+    }
+
+    ESP_LOGI(TAG, " - CRC failures: %u of %u",
+        (unsigned) stats.crc_failures, (unsigned) stats.crc_checks);
+    return ESP_OK;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Measure -------------------------------------------------------------------
+
+/* Measure Relative Humidity (Hold Master) */
+esp_err_t si7021_i2c_measure_rh_hold_master(
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint16_t                  *out_rh              ,
+    bool                       crc_check           ,
+    uint32_t                   wait_before_read_us )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_rh);
+    return _si7021_i2c_do_measure_command(
+        si7021_i2c                            ,
+        SI7021_I2C_CMD_MEASURE_RH_HOLD_MASTER ,
+        out_rh                                ,
+        crc_check                             ,
+        wait_before_read_us                  );
+}
+
+/* Measure Relative Humidity (No Hold Master) */
+esp_err_t si7021_i2c_measure_rh_nohold_master(
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint16_t                  *out_rh              ,
+    bool                       crc_check           ,
+    uint32_t                   wait_before_read_us )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_rh);
+    return _si7021_i2c_do_measure_command(
+        si7021_i2c                              ,
+        SI7021_I2C_CMD_MEASURE_RH_NOHOLD_MASTER ,
+        out_rh                                  ,
+        crc_check                               ,
+        wait_before_read_us                    );
+}
+
+/* Measure Temperature (Hold Master) */
+esp_err_t si7021_i2c_measure_temp_hold_master(
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint16_t                  *out_temp            ,
+    bool                       crc_check           ,
+    uint32_t                   wait_before_read_us )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_temp);
+    return _si7021_i2c_do_measure_command(
+        si7021_i2c                              ,
+        SI7021_I2C_CMD_MEASURE_TEMP_HOLD_MASTER ,
+        out_temp                                ,
+        crc_check                               ,
+        wait_before_read_us                    );
+}
+
+/* Measure Temperature (No Hold Master) */
+esp_err_t si7021_i2c_measure_temp_nohold_master(
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint16_t                  *out_temp            ,
+    bool                       crc_check           ,
+    uint32_t                   wait_before_read_us )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_temp);
+    return _si7021_i2c_do_measure_command(
+        si7021_i2c                                ,
+        SI7021_I2C_CMD_MEASURE_TEMP_NOHOLD_MASTER ,
+        out_temp                                  ,
+        crc_check                                 ,
+        wait_before_read_us                      );
+}
+
+/* Read Temperature Value From Previous RH Measurement */
+esp_err_t si7021_i2c_read_temp_from_prev_rh_measurement(
+    si7021_i2c_handle_t const  si7021_i2c       ,
+    uint16_t                  *out_temp         ,
+    TickType_t                 wait_before_read )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_temp);
+
+    // > No conversion behind it: without a wait, write & read in one go
+    if (!wait_before_read) {
+        uint8_t command = SI7021_I2C_CMD_READ_TEMP_FROM_PREV_RH_MEASUREMENT;
+        uint8_t data[2] = {0};
+        esp_err_t err = _si7021_i2c_write_read(
+            si7021_i2c, &command, 1, data, 2);
+        CHECK_ERR_SI7021_I2C_DO_WRITE_THEN_READ(err);
+        *out_temp = UINT16_T_FROM_UINT8_T(data[0], data[1]);
+        return err;
+    }
+
+    uint8_t command = SI7021_I2C_CMD_READ_TEMP_FROM_PREV_RH_MEASUREMENT;
+    uint8_t data[2] = {0};
+    esp_err_t err = _si7021_do_write_then_read(
+        si7021_i2c       ,
+        &command         ,
+        1                ,
+        data             ,
+        2                ,
+        wait_before_read );
+    CHECK_ERR_SI7021_I2C_DO_WRITE_THEN_READ(err);
+    return _si7021_i2c_parse_measure(si7021_i2c, data, out_temp, false);
+}
+
+esp_err_t si7021_i2c_measure_rh_and_temp_hold_master(
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint16_t                  *out_rh              ,
+    uint16_t                  *out_temp            ,
+    bool                       crc_check           ,
+    uint32_t                   wait_before_read_us )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_rh);
+    CHECK_ERR_OUT_PARAM(out_temp);
+    return _si7021_i2c_do_measure_rh_and_temp_command(
+        si7021_i2c                            ,
+        SI7021_I2C_CMD_MEASURE_RH_HOLD_MASTER ,
+        out_rh                                ,
+        out_temp                              ,
+        crc_check                             ,
+        wait_before_read_us                  );
+}
+
+esp_err_t si7021_i2c_measure_rh_and_temp_nohold_master(
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint16_t                  *out_rh              ,
+    uint16_t                  *out_temp            ,
+    bool                       crc_check           ,
+    uint32_t                   wait_before_read_us )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_rh);
+    CHECK_ERR_OUT_PARAM(out_temp);
+    return _si7021_i2c_do_measure_rh_and_temp_command(
+        si7021_i2c                              ,
+        SI7021_I2C_CMD_MEASURE_RH_NOHOLD_MASTER ,
+        out_rh                                  ,
+        out_temp                                ,
+        crc_check                               ,
+        wait_before_read_us                    );
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Measure (Split) -----------------------------------------------------------
+
+/* Start Relative Humidity Measurement (No Hold Master) */
+esp_err_t si7021_i2c_start_measure_rh(
+    si7021_i2c_handle_t const si7021_i2c )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    esp_err_t err = ESP_OK;
+
+    // > Write Measure Command (single attempt)
+    err = _si7021_i2c_transfer(
+        si7021_i2c                                             ,
+        (uint8_t[]) {SI7021_I2C_CMD_MEASURE_RH_NOHOLD_MASTER}  ,
+        1                                                      ,
+        NULL                                                   ,
+        0                                                      ,
+        false                                                 );
+    CHECK_ERR_SI7021_I2C_WRITE(err);
+
+    return err;
+}
+
+/* Start Temperature Measurement (No Hold Master) */
+esp_err_t si7021_i2c_start_measure_temp(
+    si7021_i2c_handle_t const si7021_i2c )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    esp_err_t err = ESP_OK;
+
+    // > Write Measure Command (single attempt)
+    err = _si7021_i2c_transfer(
+        si7021_i2c                                               ,
+        (uint8_t[]) {SI7021_I2C_CMD_MEASURE_TEMP_NOHOLD_MASTER}  ,
+        1                                                        ,
+        NULL                                                     ,
+        0                                                        ,
+        false                                                   );
+    CHECK_ERR_SI7021_I2C_WRITE(err);
+
+    return err;
+}
+
+/* Read Measurement Result (single attempt) */
+esp_err_t si7021_i2c_read_measure_result(
+    si7021_i2c_handle_t const  si7021_i2c ,
+    uint16_t                  *out_data   ,
+    bool                       crc_check  )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_data);
+    esp_err_t err = ESP_OK;
+
+    // > Read once (NACK while the conversion is in progress, not an error)
+    uint8_t data[3] = {0};
+    err = _si7021_i2c_transfer(
+        si7021_i2c, NULL, 0, data, crc_check ? 3 : 2, false);
+    if (err) return err;
+
+    // > Check CRC & Parse Data
+    return _si7021_i2c_parse_measure(si7021_i2c, data, out_data, crc_check);
+}
+
+/* Read Temperature of the Previous RH Measurement (single attempt) */
+esp_err_t si7021_i2c_read_prev_temp_result(
+    si7021_i2c_handle_t const  si7021_i2c ,
+    uint16_t                  *out_temp   )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_temp);
+    esp_err_t err = ESP_OK;
+
+    // > Write 0xE0 & read once (repeated start, no CRC)
+    uint8_t command = SI7021_I2C_CMD_READ_TEMP_FROM_PREV_RH_MEASUREMENT;
+    uint8_t data[2] = {0};
+    err = _si7021_i2c_transfer(si7021_i2c, &command, 1, data, 2, false);
+    if (err) return err;
+
+    *out_temp = UINT16_T_FROM_UINT8_T(data[0], data[1]);
+    return err;
+}
+
+/* Wait for a Conversion */
+esp_err_t si7021_i2c_wait_conversion(
+    si7021_i2c_handle_t const si7021_i2c ,
+    uint32_t                  wait_us    )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    _si7021_i2c_wait(si7021_i2c, wait_us, true);
+    return ESP_OK;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Reset & Registers ---------------------------------------------------------
+
+/* Reset */
+esp_err_t si7021_i2c_reset(
+    si7021_i2c_handle_t const si7021_i2c )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    esp_err_t err = ESP_OK;
+
+    // > Write Reset Command
+    err = _si7021_i2c_write(
+        si7021_i2c                         ,
+        (uint8_t[]) {SI7021_I2C_CMD_RESET} ,
+        1                                 );
+    CHECK_ERR_SI7021_I2C_WRITE(err);
+
+    return err;
+}
+
+/* Write RH/T User Register 1 */
+esp_err_t si7021_i2c_write_user_reg_1(
+    si7021_i2c_handle_t const si7021_i2c ,
+    uint8_t                   reg_value  )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    esp_err_t err = ESP_OK;
+
+    // > Write RH/T User Register 1
+    err = _si7021_i2c_write(
+        si7021_i2c                                                    ,
+        (uint8_t[]) {SI7021_I2C_CMD_WRITE_RH_T_USER_REG_1, reg_value} ,
+        2                                                            );
+    CHECK_ERR_SI7021_I2C_WRITE(err);
+
+    return err;
+}
+
+/* Read RH/T User Register 1 */
+esp_err_t si7021_i2c_read_user_reg_1(
+    si7021_i2c_handle_t const  si7021_i2c       ,
+    uint8_t                   *out_reg_value    ,
+    TickType_t                 wait_before_read )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_reg_value);
+    return _si7021_i2c_do_read_reg_command(
+        si7021_i2c                          ,
+        SI7021_I2C_CMD_READ_RH_T_USER_REG_1 ,
+        out_reg_value                       ,
+        wait_before_read                   );
+}
+
+/* Write Heater Control Register */
+esp_err_t si7021_i2c_write_heater_control_reg(
+    si7021_i2c_handle_t const si7021_i2c ,
+    uint8_t                   reg_value  )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    esp_err_t err = ESP_OK;
+
+    // > Write Heater Control Register
+    err = _si7021_i2c_write(
+        si7021_i2c                                                       ,
+        (uint8_t[]) {SI7021_I2C_CMD_WRITE_HEATER_CONTROL_REG, reg_value} ,
+        2                                                               );
+    CHECK_ERR_SI7021_I2C_WRITE(err);
+
+    return err;
+}
+
+/* Read Heater Control Register */
+esp_err_t si7021_i2c_read_heater_control_reg(
+    si7021_i2c_handle_t const  si7021_i2c       ,
+    uint8_t                   *out_reg_value    ,
+    TickType_t                 wait_before_read )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_reg_value);
+    return _si7021_i2c_do_read_reg_command(
+        si7021_i2c                             ,
+        SI7021_I2C_CMD_READ_HEATER_CONTROL_REG ,
+        out_reg_value                          ,
+        wait_before_read                      );
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Serial Number & Firmware --------------------------------------------------
+
+/* Read Electronic ID First Bytes */
+esp_err_t si7021_i2c_read_electronic_id_first_bytes(
+    si7021_i2c_handle_t const  si7021_i2c          ,
+    uint32_t                  *out_eid_first_bytes ,
+    bool                       crc_check           ,
+    TickType_t                 wait_before_read    )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_eid_first_bytes);
+    esp_err_t err = ESP_OK;
+
+    // > Write commands then read data
+    uint8_t data[8] = {0};
+    err = _si7021_do_write_then_read(
+        si7021_i2c                                           ,
+        (uint8_t[]) {
+            SI7021_I2C_CMD_READ_ELECTRONIC_ID_FIRST_BYTES_A  ,
+            SI7021_I2C_CMD_READ_ELECTRONIC_ID_FIRST_BYTES_B },
+        2                                                    ,
+        data                                                 ,
+        8                                                    ,
+        wait_before_read                                    );
+    CHECK_ERR_SI7021_I2C_DO_WRITE_THEN_READ(err);
+
+    // > Check CRC
+    if (crc_check) {
+        uint8_t init = CRC_INIT;
+        for (int i = 0; i < 8; i += 2) {
+            uint8_t crc = _crc8_general(&data[i], 1, init, CRC_XOR);
+            _si7021_i2c_stats_crc(si7021_i2c, crc == data[i + 1]);
+            CHECK_ERR_COMPARE_FIRST_EID_CRC(init, data[i], crc, data[i + 1]);
+            init = crc;
+        }
+    }
+
+    // > Parse Data
+    *out_eid_first_bytes = UINT32_T_FROM_UINT8_T(
+        data[0], data[2], data[4], data[6]);
+
+    return err;
+}
+
+/* Read Electronic ID Last Bytes */
+esp_err_t si7021_i2c_read_electronic_id_last_bytes(
+    si7021_i2c_handle_t const  si7021_i2c         ,
+    uint32_t                  *out_eid_last_bytes ,
+    bool                       crc_check          ,
+    TickType_t                 wait_before_read   )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_eid_last_bytes);
+    esp_err_t err = ESP_OK;
+
+    // > Write commands then read data
+    uint8_t data[6];
+    err = _si7021_do_write_then_read(
+        si7021_i2c                                          ,
+        (uint8_t[]) {
+            SI7021_I2C_CMD_READ_ELECTRONIC_ID_LAST_BYTES_A  ,
+            SI7021_I2C_CMD_READ_ELECTRONIC_ID_LAST_BYTES_B },
+        2                                                   ,
+        data                                                ,
+        6                                                   ,
+        wait_before_read                                   );
+    CHECK_ERR_SI7021_I2C_DO_WRITE_THEN_READ(err);
+
+    // > Check CRC
+    if (crc_check) {
+        uint8_t init = CRC_INIT;
+        for (int i = 0; i < 6; i += 3) {
+            uint8_t crc = _crc8_general(&data[i], 2, init, CRC_XOR);
+            _si7021_i2c_stats_crc(si7021_i2c, crc == data[i + 2]);
+            CHECK_ERR_COMPARE_LAST_EID_CRC(
+                init, data[i], data[i + 1], crc, data[i + 2]);
+            init = crc;
+        }
+    }
+
+    // > Parse Data
+    *out_eid_last_bytes = UINT32_T_FROM_UINT8_T(
+        data[0], data[1], data[3], data[4]);
+
+    return err;
+}
+
+/* Read Firmware Revision */
+esp_err_t si7021_i2c_read_firmware_revision(
+    si7021_i2c_handle_t const  si7021_i2c            ,
+    uint8_t                   *out_firmware_revision ,
+    TickType_t                 wait_before_read      )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    CHECK_ERR_OUT_PARAM(out_firmware_revision);
+    esp_err_t err = ESP_OK;
+
+    // > Write commands then read data
+    err = _si7021_do_write_then_read(
+        si7021_i2c                                   ,
+        (uint8_t[]) {
+            SI7021_I2C_CMD_READ_FIRMWARE_REVISION_A  ,
+            SI7021_I2C_CMD_READ_FIRMWARE_REVISION_B },
+        2                                            ,
+        out_firmware_revision                        ,
+        1                                            ,
+        wait_before_read                            );
+    CHECK_ERR_SI7021_I2C_DO_WRITE_THEN_READ(err);
+    
+    return err;
+}
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
\ No newline at end of file
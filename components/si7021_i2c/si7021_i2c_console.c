@@ -0,0 +1,128 @@
+#include "si7021_i2c_console.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdio.h>                   // for stderr
+#include "esp_err.h"                 // for ESP errors
+#include "esp_console.h"             // for esp_console_cmd_register
+#include "argtable3/argtable3.h"     // for command args
+
+/* Logging */
+#include "esp_log.h"
+static const char *TAG = "Si7021 I2C Console";
+
+// -----------------------------------------------------------------------------
+
+// GLOBALS ---------------------------------------------------------------------
+
+/* Handles dumped by the command (NULL: free slot) */
+static si7021_i2c_handle_t _handles[SI7021_I2C_CONSOLE_MAX_HANDLES];
+static bool                _registered = false;
+
+/* Command Args */
+static struct {
+    struct arg_lit *reset;
+    struct arg_end *end;
+} _stats_args;
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+#define CHECK_ERR_HANDLE(si7021_i2c)                                           \
+    if (!si7021_i2c) {                                                         \
+        ESP_LOGE(TAG, "Si7021 I2C handle is NULL.");                           \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+// -----------------------------------------------------------------------------
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+/* si7021_i2c_stats [-r] */
+static int _si7021_i2c_stats_cmd(
+    int    argc ,
+    char **argv )
+{
+    int nerrors = arg_parse(argc, argv, (void **) &_stats_args);
+    if (nerrors) {
+        arg_print_errors(stderr, _stats_args.end, argv[0]);
+        return 1;
+    }
+
+    int dumped = 0;
+    for (int i = 0; i < SI7021_I2C_CONSOLE_MAX_HANDLES; i++) {
+        if (!_handles[i]) continue;
+        esp_err_t err = si7021_i2c_dump_stats(_handles[i]);
+        if (err) {
+            ESP_LOGE(TAG, "Could not dump stats: %s", esp_err_to_name(err));
+            return 1;
+        }
+        if (_stats_args.reset->count) si7021_i2c_reset_stats(_handles[i]);
+        dumped++;
+    }
+
+    if (!dumped) ESP_LOGW(TAG, "No Si7021 I2C handles registered.");
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+/* Register Handle (and the command, the first time) */
+esp_err_t si7021_i2c_console_register(
+    si7021_i2c_handle_t si7021_i2c )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+
+    // > Command
+    if (!_registered) {
+        _stats_args.reset = arg_lit0("r", "reset", "Reset stats after dump");
+        _stats_args.end   = arg_end(1);
+        const esp_console_cmd_t cmd = {
+            .command  = "si7021_i2c_stats",
+            .help     = "Dump Si7021 I2C latency histograms & CRC failures",
+            .hint     = NULL,
+            .func     = &_si7021_i2c_stats_cmd,
+            .argtable = &_stats_args
+        };
+        esp_err_t err = esp_console_cmd_register(&cmd);
+        if (err) {
+            ESP_LOGE(TAG, "Could not register command: %s",
+                esp_err_to_name(err));
+            return err;
+        }
+        _registered = true;
+    }
+
+    // > Handle (first free slot)
+    for (int i = 0; i < SI7021_I2C_CONSOLE_MAX_HANDLES; i++) {
+        if (_handles[i] == si7021_i2c) return ESP_OK;
+    }
+    for (int i = 0; i < SI7021_I2C_CONSOLE_MAX_HANDLES; i++) {
+        if (_handles[i]) continue;
+        _handles[i] = si7021_i2c;
+        return ESP_OK;
+    }
+
+    ESP_LOGE(TAG, "No free slot (max %d handles).",
+        SI7021_I2C_CONSOLE_MAX_HANDLES);
+    return ESP_ERR_NO_MEM;
+}
+
+/* Unregister Handle (the command stays) */
+esp_err_t si7021_i2c_console_unregister(
+    si7021_i2c_handle_t si7021_i2c )
+{
+    CHECK_ERR_HANDLE(si7021_i2c);
+    for (int i = 0; i < SI7021_I2C_CONSOLE_MAX_HANDLES; i++) {
+        if (_handles[i] == si7021_i2c) {
+            _handles[i] = NULL;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+// -----------------------------------------------------------------------------
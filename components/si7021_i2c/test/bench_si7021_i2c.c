@@ -0,0 +1,47 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include "unity.h"
+
+#include "bench_utils.h"
+
+#include "si7021_i2c.h"
+#include "si7021_i2c_crc8.h"
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define BENCH_CRC_ITERATIONS 200000
+
+// BENCHMARKS ------------------------------------------------------------------
+
+/* A measurement reply (2 bytes) and an electronic ID reply (8 data bytes) */
+TEST_CASE("CRC-8 table vs nibble vs bitwise", "[si7021_i2c]" BENCH_TAG)
+{
+    uint8_t reply[2] = { 0x68, 0x3A };
+    uint8_t eid[8]   = { 0x15, 0xFF, 0x2C, 0x81, 0x06, 0x2B, 0x3C, 0x5D };
+
+    BENCH_RUN("crc8 table   2 B", BENCH_CRC_ITERATIONS, {
+        reply[1] = _bench_i;
+        bench_sink(_crc8_update_table(CRC_INIT, reply, 2));
+    });
+    BENCH_RUN("crc8 nibble  2 B", BENCH_CRC_ITERATIONS, {
+        reply[1] = _bench_i;
+        bench_sink(_crc8_update_nibble(CRC_INIT, reply, 2));
+    });
+    BENCH_RUN("crc8 bitwise 2 B", BENCH_CRC_ITERATIONS, {
+        reply[1] = _bench_i;
+        bench_sink(_crc8_update_bitwise(CRC_INIT, reply, 2));
+    });
+
+    BENCH_RUN("crc8 table   8 B", BENCH_CRC_ITERATIONS, {
+        eid[7] = _bench_i;
+        bench_sink(_crc8_update_table(CRC_INIT, eid, 8));
+    });
+    BENCH_RUN("crc8 nibble  8 B", BENCH_CRC_ITERATIONS, {
+        eid[7] = _bench_i;
+        bench_sink(_crc8_update_nibble(CRC_INIT, eid, 8));
+    });
+    BENCH_RUN("crc8 bitwise 8 B", BENCH_CRC_ITERATIONS, {
+        eid[7] = _bench_i;
+        bench_sink(_crc8_update_bitwise(CRC_INIT, eid, 8));
+    });
+}
@@ -0,0 +1,294 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include "unity.h"
+
+#include "esp_timer.h"
+#include "esp_console.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include "si7021_i2c.h"
+#include "si7021_i2c_console.h"
+#include "si7021_i2c_crc8.h"
+#include "si7021_sim.h"
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define READER_TASKS     3   // Tasks reading at once
+#define READER_TRANSFERS 200 // Reads per task
+#define WAIT_RUNS        5   // Timed measurements per wait
+
+#define CRC_FAULT_EVERY  2 // Sim corrupts every 2nd reply
+#define CRC_FAULT_READS  4 // Measurements with a CRC check
+
+#define CRC_RANDOM_BUFFERS 1000 // Random buffers compared across variants
+#define CRC_RANDOM_MAX_LEN 64   // Longest random buffer
+
+// STRUCTURES ------------------------------------------------------------------
+
+typedef struct {
+    si7021_sim_handle_t sim;
+    si7021_i2c_handle_t i2c;
+} fixture_t;
+
+typedef struct {
+    si7021_i2c_handle_t i2c;
+    SemaphoreHandle_t   done;
+    volatile int        errors;
+} reader_t;
+
+/* Reference vector: <len> bytes and their CRC-8 */
+typedef struct {
+    uint8_t bytes[9];
+    uint8_t len;
+    uint8_t crc;
+} crc_vector_t;
+
+/* CRC-8 Variant */
+typedef uint8_t (*crc_update_t)(uint8_t, uint8_t const *, uint16_t);
+
+// DATA ------------------------------------------------------------------------
+
+/* Worked examples of the CRC-8 shared by the Si7021 and the SHT2x it mirrors
+ * (poly 0x31, init 0x00), plus the usual "123456789" check value */
+static const crc_vector_t _crc_vectors[] = {
+    { .bytes = { 0xDC },       .len = 1, .crc = 0x79 },
+    { .bytes = { 0x68, 0x3A }, .len = 2, .crc = 0x7C },
+    { .bytes = { 0x4E, 0x85 }, .len = 2, .crc = 0x6B },
+    { .bytes = "123456789",    .len = 9, .crc = 0xA2 },
+};
+
+static const crc_update_t _crc_variants[] = {
+    &_crc8_update_table, &_crc8_update_nibble, &_crc8_update_bitwise,
+};
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+/* Sensor model on the simulated bus and a si7021_i2c handle creating the bus */
+static void _fixture_setup(fixture_t *f)
+{
+    si7021_sim_create_args_t sim_args = SI7021_SIM_DEFAULT_CREATE_ARGS();
+    si7021_i2c_create_args_t i2c_args = SI7021_I2C_DEFAULT_CREATE_ARGS();
+    i2c_args.i2c_driver.uninstall_at_delete = true;
+
+    f->sim = NULL;
+    f->i2c = NULL;
+    TEST_ESP_OK(si7021_sim_create(&sim_args, &f->sim));
+    TEST_ESP_OK(si7021_i2c_create(&i2c_args, &f->i2c));
+}
+
+static void _fixture_teardown(fixture_t *f)
+{
+    TEST_ESP_OK(si7021_i2c_delete(f->i2c));
+    TEST_ESP_OK(si7021_sim_delete(f->sim));
+}
+
+/* Reads the last temperature READER_TRANSFERS times (one write-read each, so
+ * the readers cannot interleave within a command) */
+static void _reader_task(void *arg)
+{
+    reader_t *reader = (reader_t *) arg;
+    uint16_t  temp;
+    for (int i = 0; i < READER_TRANSFERS; i++)
+        if (si7021_i2c_read_temp_from_prev_rh_measurement(reader->i2c, &temp, 0))
+            reader->errors++;
+    xSemaphoreGive(reader->done);
+    vTaskDelete(NULL);
+}
+
+// TESTS -----------------------------------------------------------------------
+
+TEST_CASE("counters and stats add up with transfers from several tasks", "[si7021_i2c]")
+{
+    fixture_t f;
+    reader_t  reader = { .done = xSemaphoreCreateCounting(READER_TASKS, 0) };
+    _fixture_setup(&f);
+    reader.i2c = f.i2c;
+
+    for (int i = 0; i < READER_TASKS; i++)
+        TEST_ASSERT_TRUE(xTaskCreate(&_reader_task, "reader", 3072, &reader,
+            5, NULL));
+    for (int i = 0; i < READER_TASKS; i++)
+        TEST_ASSERT_TRUE(xSemaphoreTake(reader.done, pdMS_TO_TICKS(5000)));
+    TEST_ASSERT_EQUAL(0, reader.errors);
+
+    si7021_i2c_retry_counters_t retry;
+    TEST_ESP_OK(si7021_i2c_get_retry_counters(f.i2c, &retry));
+    TEST_ASSERT_EQUAL(READER_TASKS * READER_TRANSFERS, retry.transfers);
+    TEST_ASSERT_EQUAL(0, retry.failures);
+
+#if SI7021_I2C_STATS
+    si7021_i2c_stats_t stats;
+    TEST_ESP_OK(si7021_i2c_get_stats(f.i2c, &stats));
+    TEST_ASSERT_EQUAL(READER_TASKS * READER_TRANSFERS, stats.write_read.count);
+    TEST_ASSERT_EQUAL(READER_TASKS * READER_TRANSFERS, stats.retries[0]);
+#endif
+
+    _fixture_teardown(&f);
+    vSemaphoreDelete(reader.done);
+}
+
+TEST_CASE("split measure API makes a single attempt and never sleeps", "[si7021_i2c]")
+{
+    fixture_t f;
+    uint16_t  code;
+    _fixture_setup(&f);
+
+    // > Result read while converting: NACKed at once, not retried
+    TEST_ESP_OK(si7021_i2c_start_measure_rh(f.i2c));
+    int64_t start_us = esp_timer_get_time();
+    TEST_ESP_ERR(ESP_FAIL, si7021_i2c_read_measure_result(f.i2c, &code, true));
+    TEST_ASSERT_LESS_THAN(1000 * portTICK_PERIOD_MS,
+        esp_timer_get_time() - start_us);
+
+    si7021_i2c_retry_counters_t retry;
+    TEST_ESP_OK(si7021_i2c_get_retry_counters(f.i2c, &retry));
+    TEST_ASSERT_EQUAL(2, retry.transfers);
+    TEST_ASSERT_EQUAL(1, retry.nacks);
+    TEST_ASSERT_EQUAL(0, retry.retries);
+    TEST_ASSERT_EQUAL(0, retry.failures);
+
+    // > Once converted: RH, then the temperature of the same conversion
+    uint16_t temp;
+    vTaskDelay(pdMS_TO_TICKS(30));
+    TEST_ESP_OK(si7021_i2c_read_measure_result(f.i2c, &code, true));
+    TEST_ESP_OK(si7021_i2c_read_prev_temp_result(f.i2c, &temp));
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, SI7021_SIM_DEFAULT_RH,
+        125.0f * code / 65536.0f - 6.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, SI7021_SIM_DEFAULT_TEMP,
+        175.72f * temp / 65536.0f - 46.85f);
+    _fixture_teardown(&f);
+}
+
+TEST_CASE("no hold master measure waits are kept to the microsecond", "[si7021_i2c]")
+{
+    fixture_t f;
+    uint16_t  code;
+    int64_t   start_us, elapsed_us;
+    int64_t   measure_us = INT64_MAX, conversion_us = INT64_MAX;
+    _fixture_setup(&f);
+
+    // > RH08_TEMP12: 3.1 + 3.8 ms, under a tick at 100 Hz
+    uint32_t wait_us = 3100 + 3800 + 200;
+    TEST_ESP_OK(si7021_i2c_write_user_reg_1(f.i2c, 0x3B));
+    TEST_ESP_OK(si7021_i2c_reset_retry_counters(f.i2c));
+
+    // > Fastest of a few runs (the others may have been preempted)
+    for (int i = 0; i < WAIT_RUNS; i++) {
+        start_us = esp_timer_get_time();
+        TEST_ESP_OK(si7021_i2c_measure_rh_nohold_master(f.i2c, &code, true, wait_us));
+        elapsed_us = esp_timer_get_time() - start_us;
+        if (elapsed_us < measure_us) measure_us = elapsed_us;
+
+        // > Same wait for a conversion started through the split API
+        TEST_ESP_OK(si7021_i2c_start_measure_temp(f.i2c));
+        start_us = esp_timer_get_time();
+        TEST_ESP_OK(si7021_i2c_wait_conversion(f.i2c, 3800 + 200));
+        elapsed_us = esp_timer_get_time() - start_us;
+        if (elapsed_us < conversion_us) conversion_us = elapsed_us;
+        TEST_ESP_OK(si7021_i2c_read_measure_result(f.i2c, &code, true));
+    }
+
+    si7021_i2c_retry_counters_t retry;
+    TEST_ESP_OK(si7021_i2c_get_retry_counters(f.i2c, &retry));
+    _fixture_teardown(&f);
+
+    // > Read once the conversion is done, not a tick later
+    TEST_ASSERT_EQUAL(0, retry.nacks);
+    TEST_ASSERT_TRUE(measure_us >= wait_us);
+    TEST_ASSERT_TRUE(measure_us < wait_us + 2000);
+    TEST_ASSERT_TRUE(conversion_us >= 3800 + 200);
+    TEST_ASSERT_TRUE(conversion_us < 3800 + 200 + 2000);
+}
+
+#if SI7021_I2C_STATS
+TEST_CASE("stats count CRC failures and the console command resets them", "[si7021_i2c]")
+{
+    fixture_t f;
+    uint16_t  code;
+    int       ret;
+    _fixture_setup(&f);
+
+    // > Every other reply corrupted: each one fails its check (no retry)
+    si7021_sim_faults_t faults = { .crc_error_every = CRC_FAULT_EVERY };
+    TEST_ESP_OK(si7021_sim_set_faults(f.sim, &faults));
+    int failed = 0;
+    for (int i = 0; i < CRC_FAULT_READS; i++)
+        if (si7021_i2c_measure_rh_hold_master(f.i2c, &code, true, 0)
+                == ESP_ERR_INVALID_CRC)
+            failed++;
+
+    si7021_i2c_stats_t stats;
+    TEST_ESP_OK(si7021_i2c_get_stats(f.i2c, &stats));
+    TEST_ASSERT_EQUAL(CRC_FAULT_READS / CRC_FAULT_EVERY, failed);
+    TEST_ASSERT_EQUAL(CRC_FAULT_READS, stats.crc_checks);
+    TEST_ASSERT_EQUAL(failed, stats.crc_failures);
+    TEST_ASSERT_EQUAL(CRC_FAULT_READS, stats.read.count);
+
+    // > Console (the command stays registered once the REPL has it)
+    esp_console_config_t console_config = ESP_CONSOLE_CONFIG_DEFAULT();
+    esp_err_t err = esp_console_init(&console_config);
+    TEST_ASSERT_TRUE(err == ESP_OK || err == ESP_ERR_INVALID_STATE);
+    TEST_ESP_OK(si7021_i2c_console_register(f.i2c));
+
+    // > Dump only: stats kept
+    TEST_ESP_OK(esp_console_run("si7021_i2c_stats", &ret));
+    TEST_ASSERT_EQUAL(0, ret);
+    TEST_ESP_OK(si7021_i2c_get_stats(f.i2c, &stats));
+    TEST_ASSERT_EQUAL(CRC_FAULT_READS, stats.crc_checks);
+
+    // > Dump & reset
+    TEST_ESP_OK(esp_console_run("si7021_i2c_stats -r", &ret));
+    TEST_ASSERT_EQUAL(0, ret);
+    TEST_ESP_OK(si7021_i2c_get_stats(f.i2c, &stats));
+    TEST_ASSERT_EQUAL(0, stats.crc_checks);
+    TEST_ASSERT_EQUAL(0, stats.crc_failures);
+    TEST_ASSERT_EQUAL(0, stats.read.count);
+
+    // > Bad args rejected; an unregistered handle is left alone
+    TEST_ESP_OK(esp_console_run("si7021_i2c_stats --bogus", &ret));
+    TEST_ASSERT_EQUAL(1, ret);
+    TEST_ESP_OK(si7021_i2c_console_unregister(f.i2c));
+    TEST_ESP_ERR(ESP_ERR_NOT_FOUND, si7021_i2c_console_unregister(f.i2c));
+
+    _fixture_teardown(&f);
+}
+#endif
+
+TEST_CASE("CRC-8 variants match the reference vectors", "[si7021_i2c]")
+{
+    size_t variants = sizeof(_crc_variants) / sizeof(_crc_variants[0]);
+    size_t vectors  = sizeof(_crc_vectors) / sizeof(_crc_vectors[0]);
+    for (size_t v = 0; v < variants; v++)
+        for (size_t i = 0; i < vectors; i++)
+            TEST_ASSERT_EQUAL_HEX8(_crc_vectors[i].crc, _crc_variants[v](
+                CRC_INIT, _crc_vectors[i].bytes, _crc_vectors[i].len));
+}
+
+TEST_CASE("CRC-8 table, nibble and bitwise variants agree", "[si7021_i2c]")
+{
+    // > Every 2-byte reply
+    for (uint32_t code = 0; code <= 0xFFFF; code++) {
+        uint8_t bytes[2] = { code >> 8, code & 0xFF };
+        uint8_t crc      = _crc8_update_bitwise(CRC_INIT, bytes, 2);
+        TEST_ASSERT_EQUAL_HEX8(crc, _crc8_update_table(CRC_INIT, bytes, 2));
+        TEST_ASSERT_EQUAL_HEX8(crc, _crc8_update_nibble(CRC_INIT, bytes, 2));
+    }
+
+    // > Random buffers from every initial register value
+    uint32_t seed = 1;
+    uint8_t  bytes[CRC_RANDOM_MAX_LEN];
+    for (int n = 0; n < CRC_RANDOM_BUFFERS; n++) {
+        seed = seed * 1664525u + 1013904223u;
+        uint16_t len  = 1 + (seed >> 16) % CRC_RANDOM_MAX_LEN;
+        uint8_t  init = n & 0xFF;
+        for (int i = 0; i < len; i++) {
+            seed = seed * 1664525u + 1013904223u;
+            bytes[i] = seed >> 24;
+        }
+        uint8_t crc = _crc8_update_bitwise(init, bytes, len);
+        TEST_ASSERT_EQUAL_HEX8(crc, _crc8_update_table(init, bytes, len));
+        TEST_ASSERT_EQUAL_HEX8(crc, _crc8_update_nibble(init, bytes, len));
+    }
+}
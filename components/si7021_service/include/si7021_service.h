@@ -0,0 +1,98 @@
+#ifndef __SI7021_SERVICE_H__
+#define __SI7021_SERVICE_H__
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>             // uint32_t, int64_t
+#include "esp_err.h"            // esp_err_t
+#include "freertos/FreeRTOS.h"  // UBaseType_t
+#include "si7021.h"             // si7021_handle_t, si7021_measure_kind_t
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define SI7021_SERVICE_NAME_LENGTH 16
+
+//// KCONFIG -------------------------------------------------------------------
+
+#define SI7021_SERVICE_DEFAULT_NAME                     /* "si7021_service" */ \
+        CONFIG_SI7021_SERVICE_DEFAULT_NAME
+#define SI7021_SERVICE_DEFAULT_PERIOD_MS                            /* 1000 */ \
+        CONFIG_SI7021_SERVICE_DEFAULT_PERIOD_MS
+#define SI7021_SERVICE_DEFAULT_TASK_PRIORITY                           /* 2 */ \
+        CONFIG_SI7021_SERVICE_DEFAULT_TASK_PRIORITY
+#define SI7021_SERVICE_DEFAULT_TASK_STACK_SIZE                      /* 2560 */ \
+        CONFIG_SI7021_SERVICE_DEFAULT_TASK_STACK_SIZE
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Si7021 Service Handle */
+typedef struct si7021_service *si7021_service_handle_t;
+
+/* Si7021 Service Create Args */
+typedef struct {
+    const char            *name;            // Handle (and task) name
+    si7021_handle_t        si7021;          // Sensor (owned by the caller)
+    si7021_measure_kind_t  kind;            // What to measure each period
+    uint32_t               period_ms;       // Cadence of the measurements
+    UBaseType_t            task_priority;   // Acquisition task priority
+    uint32_t               task_stack_size; // Acquisition task stack size
+} si7021_service_create_args_t;
+
+/* Si7021 Service Sample */
+typedef struct {
+    float    rh_percent;   // Latest RH (if kind measures it)
+    float    temp_celsius; // Latest temperature (if kind measures it)
+    int64_t  timestamp_us; // esp_timer time of the latest values
+    uint32_t samples;      // Successful measurements so far
+    uint32_t errors;       // Failed measurements so far (values kept)
+} si7021_service_sample_t;
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+/* Si7021 Service Default Create Args (si7021 must be set) */
+#define SI7021_SERVICE_DEFAULT_CREATE_ARGS() {                                 \
+    .name            = SI7021_SERVICE_DEFAULT_NAME,                            \
+    .si7021          = NULL,                                                   \
+    .kind            = SI7021_MEASURE_RH_AND_TEMP,                             \
+    .period_ms       = SI7021_SERVICE_DEFAULT_PERIOD_MS,                       \
+    .task_priority   = SI7021_SERVICE_DEFAULT_TASK_PRIORITY,                   \
+    .task_stack_size = SI7021_SERVICE_DEFAULT_TASK_STACK_SIZE                  \
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS -------------------------------------------------------------------
+
+/* Create & Delete */
+/* The service task owns the measurement cadence: no one else should issue
+ * blocking or async commands on the sensor while the service runs. Deleting
+ * the service waits for a measurement in progress to end.
+ */
+esp_err_t si7021_service_create(
+    si7021_service_create_args_t const *create_args ,
+    si7021_service_handle_t            *out_handle  );
+
+esp_err_t si7021_service_delete(
+    si7021_service_handle_t service );
+
+/* Latest Values */
+/* Lock-free and O(1), from any task: no bus traffic and no mutex. The values
+ * are a consistent snapshot of the last successful measurement; their age is
+ * esp_timer_get_time() - timestamp_us. ESP_ERR_NOT_FOUND until the first
+ * measurement succeeds (errors are still reported).
+ */
+esp_err_t si7021_service_get_latest(
+    si7021_service_handle_t  const  service    ,
+    si7021_service_sample_t        *out_sample );
+
+// -----------------------------------------------------------------------------
+
+#endif // __SI7021_SERVICE_H__
@@ -0,0 +1,293 @@
+#include "si7021_service.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdlib.h>              // for calloc, free
+#include "string.h"              // for strncpy
+#include "esp_err.h"             // for ESP errors
+#include "esp_timer.h"           // for esp_timer_get_time
+#include "freertos/FreeRTOS.h"   // for FreeRTOS
+#include "freertos/task.h"       // for service task & notifications
+#include "freertos/semphr.h"     // for stop handshake
+
+/* Logging */
+#include "esp_log.h"
+static const char *TAG = "Si7021 Service";
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Si7021 Service */
+/* The latest values live in a double buffer guarded by a sequence counter
+ * (seqlock). There is a single writer, the service task: it fills the buffer
+ * readers are not pointed at, then publishes it by bumping <seq> with release
+ * order. Readers copy the buffer <seq> points at and retry whenever <seq>
+ * moved meanwhile. A single publication leaves that buffer alone, and only a
+ * second one can tear it, but the reader cannot tell them apart.
+ */
+struct si7021_service {
+    char                  name[SI7021_SERVICE_NAME_LENGTH]; // Handle name
+    si7021_handle_t       si7021;                           // Measured sensor
+    si7021_measure_kind_t kind;                             // Measurement
+    int64_t               period_us;                        // Cadence
+
+    TaskHandle_t      task;    // Service task
+    SemaphoreHandle_t stopped; // Given by exiting task
+    volatile bool     running; // Cleared at delete
+
+    /* Latest values */
+    volatile uint32_t       seq;    // Publications (buf[seq & 1] is current)
+    si7021_service_sample_t buf[2]; // Current & next
+    si7021_service_sample_t last;   // Writer copy of the current buffer
+};
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+//// CREATE & DELETE -----------------------------------------------------------
+
+#define CHECK_ERR_CREATE_ARGS(create_args)                                     \
+    if (!create_args) {                                                        \
+        ESP_LOGE(TAG, "Pointer to si7021_service_create_args_t is NULL.");     \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_HANDLE(out_handle)                                       \
+    if (!out_handle) {                                                         \
+        ESP_LOGE(TAG, "Pointer to out handle is NULL.");                       \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_SI7021(si7021)                                               \
+    if (!si7021) {                                                             \
+        ESP_LOGE(TAG, "Si7021 handle is NULL.");                               \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_KIND(kind)                                                   \
+    if ((unsigned) kind > SI7021_MEASURE_RH_AND_TEMP) {                        \
+        ESP_LOGE(TAG, "Measure kind %d is not valid.", (int) kind);            \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_PERIOD(period_ms)                                            \
+    if (!period_ms) {                                                          \
+        ESP_LOGE(TAG, "Period must be at least 1 ms.");                        \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_MALLOC(ptr, service)                                         \
+    if (!ptr) {                                                                \
+        ESP_LOGE(TAG, "Could not allocate memory.");                           \
+        _si7021_service_free(service);                                         \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+#define CHECK_ERR_TASK_CREATE(ok, service)                                     \
+    if (ok != pdPASS) {                                                        \
+        ESP_LOGE(TAG, "Could not create service task.");                       \
+        _si7021_service_free(service);                                         \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+//// OTHER ---------------------------------------------------------------------
+
+#define CHECK_ERR_HANDLE(service)                                              \
+    if (!service) {                                                            \
+        ESP_LOGE(TAG, "Si7021 service handle is NULL.");                       \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_SAMPLE(out_sample)                                       \
+    if (!out_sample) {                                                         \
+        ESP_LOGE(TAG, "Pointer to out sample is NULL.");                       \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+//// Create & Delete -----------------------------------------------------------
+
+/* Free Service (and whatever was created) */
+static void _si7021_service_free(
+    si7021_service_handle_t service )
+{
+    if (!service) return;
+    if (service->stopped) vSemaphoreDelete(service->stopped);
+    free(service);
+}
+
+//// Latest Values -------------------------------------------------------------
+
+/* Publish <sample> (service task only) */
+static void _si7021_service_publish(
+    si7021_service_handle_t        service ,
+    si7021_service_sample_t const *sample  )
+{
+    uint32_t seq = service->seq; // Only this task writes it
+
+    // > Fill the buffer readers are not pointed at
+    service->buf[(seq + 1) & 1] = *sample;
+
+    // > Point readers at it (buffer writes visible first)
+    __atomic_store_n(&service->seq, seq + 1, __ATOMIC_RELEASE);
+
+    service->last = *sample;
+}
+
+//// Task ----------------------------------------------------------------------
+
+/* Measure into <sample> (partly written on error) */
+static esp_err_t _si7021_service_measure(
+    si7021_service_handle_t  service ,
+    si7021_service_sample_t *sample  )
+{
+    switch (service->kind) {
+        case SI7021_MEASURE_RH:
+            return si7021_measure_rh(service->si7021, &sample->rh_percent);
+        case SI7021_MEASURE_TEMP:
+            return si7021_measure_temp(service->si7021, &sample->temp_celsius);
+        default:
+            return si7021_measure_rh_and_temp(
+                service->si7021, &sample->rh_percent, &sample->temp_celsius);
+    }
+}
+
+/* Ticks until <deadline_us> (rounded up) */
+static TickType_t _si7021_service_wait(
+    int64_t deadline_us )
+{
+    int64_t wait_us = deadline_us - esp_timer_get_time();
+    int64_t tick_us = portTICK_PERIOD_MS * 1000;
+    return wait_us <= 0 ? 0 : (TickType_t) ((wait_us + tick_us - 1) / tick_us);
+}
+
+/* Service Task */
+static void _si7021_service_task(
+    void *arg )
+{
+    si7021_service_handle_t service  = (si7021_service_handle_t) arg;
+    int64_t                 deadline = esp_timer_get_time();
+
+    while (1) {
+        // > Wait for the next period (or delete)
+        ulTaskNotifyTake(pdTRUE, _si7021_service_wait(deadline));
+        if (!service->running) break;
+
+        // > Measure (on error, republish the last values with the count)
+        si7021_service_sample_t sample = service->last;
+        esp_err_t err = _si7021_service_measure(service, &sample);
+        if (err) {
+            sample = service->last;
+            sample.errors++;
+            ESP_LOGW(TAG, "'%s' measurement failed: %s", service->name,
+                esp_err_to_name(err));
+        }
+        else {
+            sample.timestamp_us = esp_timer_get_time();
+            sample.samples++;
+        }
+        _si7021_service_publish(service, &sample);
+
+        // > Next deadline (skip missed periods instead of bursting)
+        deadline += service->period_us;
+        int64_t now_us = esp_timer_get_time();
+        if (deadline <= now_us) deadline = now_us + service->period_us;
+    }
+
+    xSemaphoreGive(service->stopped);
+    vTaskDelete(NULL);
+}
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+//// Create & Delete -----------------------------------------------------------
+
+/* Create Si7021 Service */
+esp_err_t si7021_service_create(
+    si7021_service_create_args_t const *create_args ,
+    si7021_service_handle_t            *out_handle  )
+{
+    CHECK_ERR_CREATE_ARGS(create_args);
+    CHECK_ERR_OUT_HANDLE(out_handle);
+    CHECK_ERR_SI7021(create_args->si7021);
+    CHECK_ERR_KIND(create_args->kind);
+    CHECK_ERR_PERIOD(create_args->period_ms);
+
+    // > Allocate Handle & Semaphore
+    si7021_service_handle_t service = calloc(1, sizeof(struct si7021_service));
+    CHECK_ERR_MALLOC(service, service);
+    service->stopped = xSemaphoreCreateBinary();
+    CHECK_ERR_MALLOC(service->stopped, service);
+
+    strncpy(service->name, create_args->name, SI7021_SERVICE_NAME_LENGTH - 1);
+    service->si7021    = create_args->si7021;
+    service->kind      = create_args->kind;
+    service->period_us = (int64_t) create_args->period_ms * 1000;
+
+    // > Service Task (first measurement right away)
+    service->running = true;
+    BaseType_t ok = xTaskCreate(
+        &_si7021_service_task           ,
+        service->name                   ,
+        create_args->task_stack_size    ,
+        service                         ,
+        create_args->task_priority      ,
+        &service->task                 );
+    CHECK_ERR_TASK_CREATE(ok, service);
+
+    ESP_LOGI(TAG, "Service '%s' measures every %u ms.", service->name,
+        (unsigned) create_args->period_ms);
+    *out_handle = service;
+    return ESP_OK;
+}
+
+/* Delete Si7021 Service */
+esp_err_t si7021_service_delete(
+    si7021_service_handle_t service )
+{
+    CHECK_ERR_HANDLE(service);
+
+    // > Stop Service Task (after a measurement in progress)
+    service->running = false;
+    xTaskNotifyGive(service->task);
+    xSemaphoreTake(service->stopped, portMAX_DELAY);
+
+    _si7021_service_free(service);
+    return ESP_OK;
+}
+
+//// Latest Values -------------------------------------------------------------
+
+/* Get Latest Values */
+esp_err_t si7021_service_get_latest(
+    si7021_service_handle_t  const  service    ,
+    si7021_service_sample_t        *out_sample )
+{
+    CHECK_ERR_HANDLE(service);
+    CHECK_ERR_OUT_SAMPLE(out_sample);
+
+    // > Copy the current buffer (retried if a publication overlapped)
+    uint32_t seq;
+    do {
+        seq = __atomic_load_n(&service->seq, __ATOMIC_ACQUIRE);
+        *out_sample = service->buf[seq & 1];
+
+        // > Copy done before checking the counter again
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while (__atomic_load_n(&service->seq, __ATOMIC_RELAXED) != seq);
+
+    return out_sample->samples ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+// -----------------------------------------------------------------------------
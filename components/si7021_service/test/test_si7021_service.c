@@ -0,0 +1,264 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include <math.h>
+
+#include "unity.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+
+#include "si7021.h"
+#include "si7021_service.h"
+#include "si7021_sim.h"
+
+// DEFINITIONS -----------------------------------------------------------------
+
+/* Environments the concurrent test switches between */
+#define ENV_A_RH   20.0f
+#define ENV_A_TEMP 10.0f
+#define ENV_B_RH   80.0f
+#define ENV_B_TEMP 40.0f
+
+#define READERS 2
+
+// STRUCTURES ------------------------------------------------------------------
+
+typedef struct {
+    si7021_sim_handle_t     sim;
+    si7021_handle_t         si7021;
+    si7021_service_handle_t service;
+} fixture_t;
+
+/* Task switching the environment or reading the latest values until stopped */
+typedef struct {
+    fixture_t         *f;
+    volatile bool      stop;
+    SemaphoreHandle_t  done;
+    uint32_t           reads;
+    uint32_t           torn;       // Values not from one conversion
+    uint32_t           backwards;  // Counts or timestamp going back
+} worker_t;
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+/* Sensor model on the simulated bus and a fast (RH08_TEMP12) si7021 handle */
+static void _fixture_setup(fixture_t *f)
+{
+    si7021_sim_create_args_t sim_args = SI7021_SIM_DEFAULT_CREATE_ARGS();
+    si7021_create_args_t     args     = SI7021_DEFAULT_CREATE_ARGS();
+    args.i2c.i2c_driver.uninstall_at_delete = true;
+    args.at_init.dump.device_info           = false;
+    args.at_init.set_user_register_info     = true;
+    args.at_init.user_register_info.resolution = SI7021_RESOLUTION_RH08_TEMP12;
+
+    f->sim     = NULL;
+    f->si7021  = NULL;
+    f->service = NULL;
+    TEST_ESP_OK(si7021_sim_create(&sim_args, &f->sim));
+    TEST_ESP_OK(si7021_create(&args, &f->si7021));
+}
+
+static void _fixture_start(fixture_t *f, uint32_t period_ms)
+{
+    si7021_service_create_args_t args = SI7021_SERVICE_DEFAULT_CREATE_ARGS();
+    args.si7021    = f->si7021;
+    args.period_ms = period_ms;
+    TEST_ESP_OK(si7021_service_create(&args, &f->service));
+}
+
+static void _fixture_teardown(fixture_t *f)
+{
+    if (f->service) TEST_ESP_OK(si7021_service_delete(f->service));
+    TEST_ESP_OK(si7021_delete(f->si7021));
+    TEST_ESP_OK(si7021_sim_delete(f->sim));
+}
+
+/* Poll the latest values until <samples> and <errors> reach the given counts */
+static esp_err_t _wait_latest(
+    fixture_t               *f       ,
+    uint32_t                 samples ,
+    uint32_t                 errors  ,
+    si7021_service_sample_t *sample  )
+{
+    esp_err_t err = ESP_ERR_TIMEOUT;
+    for (int i = 0; i < 200; i++) {
+        err = si7021_service_get_latest(f->service, sample);
+        if (sample->samples >= samples && sample->errors >= errors) return err;
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    TEST_FAIL_MESSAGE("Service did not reach the expected counts");
+    return err;
+}
+
+static bool _is_env(float rh, float temp, float env_rh, float env_temp)
+{
+    return fabsf(rh - env_rh) < 1.0f && fabsf(temp - env_temp) < 0.1f;
+}
+
+static void _env_task(void *arg)
+{
+    worker_t *env = (worker_t *) arg;
+    for (bool b = false; !env->stop; b = !b) {
+        si7021_sim_set_environment(env->f->sim,
+            b ? ENV_B_RH : ENV_A_RH, b ? ENV_B_TEMP : ENV_A_TEMP);
+        vTaskDelay(1);
+    }
+    xSemaphoreGive(env->done);
+    vTaskDelete(NULL);
+}
+
+static void _reader_task(void *arg)
+{
+    worker_t *reader = (worker_t *) arg;
+    si7021_service_sample_t prev = { 0 }, sample;
+
+    while (!reader->stop) {
+        if (si7021_service_get_latest(reader->f->service, &sample) != ESP_OK)
+            continue;
+        reader->reads++;
+
+        // > RH & temp of one conversion (the sim pairs them)
+        if (!_is_env(sample.rh_percent, sample.temp_celsius, ENV_A_RH, ENV_A_TEMP) &&
+            !_is_env(sample.rh_percent, sample.temp_celsius, ENV_B_RH, ENV_B_TEMP))
+            reader->torn++;
+
+        // > Counts & timestamp of one publication, never behind the last one
+        if (sample.samples < prev.samples || sample.errors < prev.errors ||
+            (sample.samples == prev.samples &&
+                sample.timestamp_us != prev.timestamp_us) ||
+            (sample.samples > prev.samples &&
+                sample.timestamp_us <= prev.timestamp_us))
+            reader->backwards++;
+        prev = sample;
+    }
+    xSemaphoreGive(reader->done);
+    vTaskDelete(NULL);
+}
+
+// TESTS -----------------------------------------------------------------------
+
+TEST_CASE("service publishes the measured values", "[si7021_service]")
+{
+    fixture_t f;
+    si7021_service_sample_t sample;
+    _fixture_setup(&f);
+    TEST_ESP_OK(si7021_sim_set_environment(f.sim, 40.0f, 21.5f));
+    _fixture_start(&f, 20);
+
+    TEST_ESP_OK(_wait_latest(&f, 1, 0, &sample));
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 40.0f, sample.rh_percent);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 21.5f, sample.temp_celsius);
+    TEST_ASSERT_EQUAL(0, sample.errors);
+    TEST_ASSERT_TRUE(sample.timestamp_us <= esp_timer_get_time());
+
+    // > New values at the next periods
+    int64_t first_us = sample.timestamp_us;
+    TEST_ESP_OK(si7021_sim_set_environment(f.sim, 60.0f, 30.0f));
+    TEST_ESP_OK(_wait_latest(&f, sample.samples + 2, 0, &sample));
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 60.0f, sample.rh_percent);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 30.0f, sample.temp_celsius);
+    TEST_ASSERT_TRUE(sample.timestamp_us > first_us);
+
+    _fixture_teardown(&f);
+}
+
+TEST_CASE("latest values stay consistent under concurrent publications", "[si7021_service]")
+{
+    fixture_t f;
+    worker_t  env = { .f = &f, .done = xSemaphoreCreateBinary() };
+    worker_t  readers[READERS];
+    _fixture_setup(&f);
+    _fixture_start(&f, 1);
+
+    // > Environment switching every tick, readers spinning below the service
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(&_env_task, "env", 2048, &env,
+        SI7021_SERVICE_DEFAULT_TASK_PRIORITY + 1, NULL));
+    for (int i = 0; i < READERS; i++) {
+        readers[i] = (worker_t) { .f = &f, .done = xSemaphoreCreateBinary() };
+        TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(&_reader_task, "reader", 2048,
+            &readers[i], SI7021_SERVICE_DEFAULT_TASK_PRIORITY - 1, NULL));
+    }
+    vTaskDelay(pdMS_TO_TICKS(500));
+
+    env.stop = true;
+    TEST_ASSERT_TRUE(xSemaphoreTake(env.done, pdMS_TO_TICKS(500)));
+    for (int i = 0; i < READERS; i++) {
+        readers[i].stop = true;
+        TEST_ASSERT_TRUE(xSemaphoreTake(readers[i].done, pdMS_TO_TICKS(500)));
+        vSemaphoreDelete(readers[i].done);
+
+        TEST_ASSERT_GREATER_THAN(0, readers[i].reads);
+        TEST_ASSERT_EQUAL(0, readers[i].torn);
+        TEST_ASSERT_EQUAL(0, readers[i].backwards);
+    }
+
+    // > Many publications overlapped the reads
+    si7021_service_sample_t sample;
+    TEST_ESP_OK(si7021_service_get_latest(f.service, &sample));
+    TEST_ASSERT_GREATER_THAN(10, sample.samples);
+    TEST_ASSERT_EQUAL(0, sample.errors);
+
+    _fixture_teardown(&f);
+    vSemaphoreDelete(env.done);
+}
+
+TEST_CASE("failed measurements are counted and keep the last values", "[si7021_service]")
+{
+    fixture_t f;
+    si7021_service_sample_t sample, last;
+    si7021_sim_faults_t faults = { .crc_error_every = 1 };
+    _fixture_setup(&f);
+    TEST_ESP_OK(si7021_sim_set_environment(f.sim, 40.0f, 21.5f));
+
+    // > Nothing measured yet: not found, errors still reported
+    TEST_ESP_OK(si7021_sim_set_faults(f.sim, &faults));
+    _fixture_start(&f, 10);
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, _wait_latest(&f, 0, 2, &sample));
+    TEST_ASSERT_EQUAL(0, sample.samples);
+
+    // > Recovered
+    faults.crc_error_every = 0;
+    TEST_ESP_OK(si7021_sim_set_faults(f.sim, &faults));
+    TEST_ESP_OK(_wait_latest(&f, 1, 0, &last));
+
+    // > Failing again (from the first error on): counted, last values kept
+    faults.crc_error_every = 1;
+    TEST_ESP_OK(si7021_sim_set_faults(f.sim, &faults));
+    TEST_ESP_OK(si7021_sim_set_environment(f.sim, 60.0f, 30.0f));
+    TEST_ESP_OK(_wait_latest(&f, 0, last.errors + 1, &last));
+    TEST_ESP_OK(_wait_latest(&f, 0, last.errors + 3, &sample));
+    TEST_ASSERT_EQUAL(last.samples, sample.samples);
+    TEST_ASSERT_EQUAL_FLOAT(last.rh_percent, sample.rh_percent);
+    TEST_ASSERT_EQUAL_FLOAT(last.temp_celsius, sample.temp_celsius);
+    TEST_ASSERT_TRUE(sample.timestamp_us == last.timestamp_us);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 40.0f, sample.rh_percent);
+
+    _fixture_teardown(&f);
+}
+
+TEST_CASE("delete stops the measurements", "[si7021_service]")
+{
+    fixture_t f;
+    si7021_service_sample_t sample;
+    si7021_sim_counters_t before, after;
+    _fixture_setup(&f);
+    _fixture_start(&f, 1);
+    TEST_ESP_OK(_wait_latest(&f, 3, 0, &sample));
+
+    // > No bus traffic once deleted (a measurement in progress has ended)
+    TEST_ESP_OK(si7021_service_delete(f.service));
+    f.service = NULL;
+    TEST_ESP_OK(si7021_sim_get_counters(f.sim, &before));
+    vTaskDelay(pdMS_TO_TICKS(50));
+    TEST_ESP_OK(si7021_sim_get_counters(f.sim, &after));
+    TEST_ASSERT_EQUAL(before.commands, after.commands);
+    TEST_ASSERT_EQUAL(before.conversions, after.conversions);
+
+    // > The sensor is free again
+    float rh;
+    TEST_ESP_OK(si7021_measure_rh(f.si7021, &rh));
+
+    _fixture_teardown(&f);
+}
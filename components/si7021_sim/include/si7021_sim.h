@@ -0,0 +1,105 @@
+#ifndef __SI7021_SIM_H__
+#define __SI7021_SIM_H__
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint8_t, uint32_t, uint64_t
+#include "esp_err.h"        // esp_err_t
+#include "i2c_bus_driver.h" // i2c_port_t
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define SI7021_SIM_DEFAULT_I2C_PORT          (i2c_port_t) 0
+#define SI7021_SIM_DEFAULT_ELECTRONIC_ID     0x5A5A5A5A15FFB5FFULL // SNB_3 0x15
+#define SI7021_SIM_DEFAULT_FIRMWARE_REVISION 0x20                  // 2.0
+#define SI7021_SIM_DEFAULT_RH                50.0f                 // %RH
+#define SI7021_SIM_DEFAULT_TEMP              25.0f                 // ºC
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Si7021 Sim Handle */
+typedef struct si7021_sim *si7021_sim_handle_t;
+
+/* Si7021 Sim Create Args */
+typedef struct {
+    i2c_port_t i2c_port;          // Simulated bus port (address from Kconfig)
+    uint64_t   electronic_id;     // SNA_3..SNA_0 SNB_3..SNB_0
+    uint8_t    firmware_revision; // 0xFF: 1.0, 0x20: 2.0
+    float      rh;                // Environment relative humidity (%RH)
+    float      temp;              // Environment temperature (ºC)
+} si7021_sim_create_args_t;
+
+/* Si7021 Sim Faults */
+typedef struct {
+    uint32_t crc_error_every; // Corrupt the CRC of every Nth reply (0: never)
+    bool     stuck_bus;       // Hold SCL low: every transfer times out
+} si7021_sim_faults_t;
+
+/* Si7021 Sim Counters */
+typedef struct {
+    uint32_t commands;    // Commands ACKed
+    uint32_t conversions; // Conversions started
+    uint32_t nacks;       // Phases NACKed (converting, resetting, unknown)
+    uint32_t stretches;   // Hold master reads stretched until done
+    uint32_t crc_errors;  // Replies sent with a corrupt CRC
+    uint32_t stuck;       // Phases refused with the bus stuck
+} si7021_sim_counters_t;
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+/* Si7021 Sim Default Create Args */
+#define SI7021_SIM_DEFAULT_CREATE_ARGS() {                                     \
+    .i2c_port          = SI7021_SIM_DEFAULT_I2C_PORT,                          \
+    .electronic_id     = SI7021_SIM_DEFAULT_ELECTRONIC_ID,                     \
+    .firmware_revision = SI7021_SIM_DEFAULT_FIRMWARE_REVISION,                 \
+    .rh                = SI7021_SIM_DEFAULT_RH,                                \
+    .temp              = SI7021_SIM_DEFAULT_TEMP                               \
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS -------------------------------------------------------------------
+
+/* Create & Delete */
+/* The simulated sensor is attached to the simulated bus (see i2c_bus_sim.h)
+ * at SI7021_I2C_ADDRESS. It models the si7021_i2c command set: NACK while
+ * converting or resetting, clock stretching in hold master mode, conversion
+ * times of the active resolution (datasheet maximums), CRC bytes, the user and
+ * heater registers, and the electronic ID and firmware revision.
+ */
+esp_err_t si7021_sim_create(
+    si7021_sim_create_args_t const *create_args ,
+    si7021_sim_handle_t            *out_handle  );
+
+esp_err_t si7021_sim_delete(
+    si7021_sim_handle_t sim );
+
+/* Environment (taken by the next conversion) */
+esp_err_t si7021_sim_set_environment(
+    si7021_sim_handle_t const sim  ,
+    float                     rh   ,
+    float                     temp );
+
+/* Fault Injection */
+esp_err_t si7021_sim_set_faults(
+    si7021_sim_handle_t const  sim    ,
+    si7021_sim_faults_t const *faults );
+
+/* Counters */
+esp_err_t si7021_sim_get_counters(
+    si7021_sim_handle_t   const  sim          ,
+    si7021_sim_counters_t       *out_counters );
+
+esp_err_t si7021_sim_reset_counters(
+    si7021_sim_handle_t const sim );
+
+// -----------------------------------------------------------------------------
+
+#endif // __SI7021_SIM_H__
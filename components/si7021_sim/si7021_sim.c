@@ -0,0 +1,482 @@
+#include "si7021_sim.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdlib.h>              // for calloc, free
+#include "string.h"              // for memcpy, memset
+#include "esp_err.h"             // for ESP errors
+#include "esp_timer.h"           // for esp_timer_get_time
+#include "freertos/FreeRTOS.h"   // for FreeRTOS
+#include "freertos/task.h"       // for vTaskDelay (clock stretching)
+#include "i2c_bus_sim.h"         // for simulated bus
+#include "si7021_i2c.h"          // for command codes & address
+
+/* Logging */
+#include "esp_log.h"
+static const char *TAG = "Si7021 Sim";
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define SI7021_SIM_RESET_US 15000 // Powerup time after a soft reset (max)
+
+/* Register defaults & writable bits */
+#define SI7021_SIM_USER_REG_DEFAULT     0x3A
+#define SI7021_SIM_USER_REG_WRITABLE    0x85 // RES1, HTRE, RES0
+#define SI7021_SIM_HEATER_REG_DEFAULT   0x00
+#define SI7021_SIM_HEATER_REG_WRITABLE  0x0F // Heater current
+
+#define SI7021_SIM_CRC_POLY 0x31 // x^8 + x^5 + x^4 + 1
+#define SI7021_SIM_NO_CRC   0xFF // Reply without CRC byte
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Si7021 Sim Handle */
+struct si7021_sim {
+    i2c_port_t   i2c_port; // Simulated bus port
+    portMUX_TYPE lock;     // Protects everything below
+
+    uint64_t electronic_id;     // SNA_3..SNA_0 SNB_3..SNB_0
+    uint8_t  firmware_revision; // Firmware revision byte
+    float    rh;                // Environment (%RH)
+    float    temp;              // Environment (ºC)
+
+    uint8_t  user_reg;      // User Register 1
+    uint8_t  heater_reg;    // Heater Control Register
+    int64_t  busy_until_us; // End of a soft reset
+    uint16_t prev_temp;     // Temperature code of the last RH conversion
+
+    /* Reply to the next read */
+    struct {
+        uint8_t data[8];  // Reply bytes
+        uint8_t len;      // 0: nothing to read (NACK)
+        uint8_t crc_at;   // Index of the CRC corruptible by faults
+        bool    hold;     // Hold master: stretch instead of NACK
+        int64_t ready_us; // Conversion end
+    } reply;
+
+    si7021_sim_faults_t   faults;   // Injected faults
+    uint32_t              replies;  // CRC replies sent (for crc_error_every)
+    si7021_sim_counters_t counters; // Counters
+};
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+#define CHECK_ERR_CREATE_ARGS(create_args)                                     \
+    if (!create_args) {                                                        \
+        ESP_LOGE(TAG, "Pointer to si7021_sim_create_args_t is NULL.");         \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_HANDLE(out_handle)                                       \
+    if (!out_handle) {                                                         \
+        ESP_LOGE(TAG, "Pointer to out handle is NULL.");                       \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_MALLOC(ptr)                                                  \
+    if (!ptr) {                                                                \
+        ESP_LOGE(TAG, "Could not allocate memory.");                           \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+#define CHECK_ERR_ATTACH(err, sim)                                             \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not attach to simulated bus.");                   \
+        free(sim);                                                             \
+        return err;                                                            \
+    }
+
+#define CHECK_ERR_HANDLE(handle)                                               \
+    if (!handle) {                                                             \
+        ESP_LOGE(TAG, "Handle is NULL.");                                      \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_IN_PARAM(param)                                              \
+    if (!param) {                                                              \
+        ESP_LOGE(TAG, "Pointer to input parameter is NULL.");                  \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_PARAM(param)                                             \
+    if (!param) {                                                              \
+        ESP_LOGE(TAG, "Pointer to output parameter is NULL.");                 \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+// -----------------------------------------------------------------------------
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+//// Model ---------------------------------------------------------------------
+
+/* Resolution index from User Register 1 (RES1 RES0) */
+static inline int _si7021_sim_resolution(
+    uint8_t user_reg )
+{ return ((user_reg >> 6) & 0x02) | (user_reg & 0x01); }
+
+/* Conversion times (datasheet maximums) & bits, per resolution index */
+static const uint32_t _rh_us[4]     = { 12000, 3100, 4500, 7000 };
+static const uint32_t _temp_us[4]   = { 10800, 3800, 6200, 2400 };
+static const uint8_t  _rh_bits[4]   = { 12, 8, 10, 11 };
+static const uint8_t  _temp_bits[4] = { 14, 12, 13, 11 };
+
+/* CRC-8 (bitwise, independent of the driver tables it checks) */
+static uint8_t _si7021_sim_crc8(
+    uint8_t const *bytes ,
+    size_t         count ,
+    uint8_t        init  )
+{
+    uint8_t crc = init;
+    for (size_t i = 0; i < count; i++) {
+        crc ^= bytes[i];
+        for (int j = 0; j < 8; j++)
+            crc = (crc & 0x80) ? (crc << 1) ^ SI7021_SIM_CRC_POLY : (crc << 1);
+    }
+    return crc;
+}
+
+/* Measurement code of <value>, truncated to <bits> */
+static uint16_t _si7021_sim_code(
+    float   value ,
+    float   scale ,
+    float   shift ,
+    uint8_t bits  )
+{
+    float code = (value + shift) * 65536.0f / scale;
+    if (code < 0.0f)     code = 0.0f;
+    if (code > 65535.0f) code = 65535.0f;
+    return (uint16_t) code & (uint16_t) (0xFFFF << (16 - bits));
+}
+
+/* Reply: code MSB, LSB (& CRC) */
+static void _si7021_sim_reply_code(
+    si7021_sim_handle_t const sim  ,
+    uint16_t                  code ,
+    bool                      crc  )
+{
+    sim->reply.data[0] = code >> 8;
+    sim->reply.data[1] = code & 0xFF;
+    sim->reply.data[2] = _si7021_sim_crc8(sim->reply.data, 2, 0x00);
+    sim->reply.len     = crc ? 3 : 2;
+    sim->reply.crc_at  = crc ? 2 : SI7021_SIM_NO_CRC;
+}
+
+/* Start a conversion (RH also converts temperature) */
+static void _si7021_sim_convert(
+    si7021_sim_handle_t const sim  ,
+    bool                      rh   ,
+    bool                      hold )
+{
+    int      res       = _si7021_sim_resolution(sim->user_reg);
+    uint16_t temp_code = _si7021_sim_code(
+        sim->temp, 175.72f, 46.85f, _temp_bits[res]);
+    uint32_t conv_us   = _temp_us[res];
+
+    if (rh) {
+        conv_us       += _rh_us[res];
+        sim->prev_temp = temp_code;
+        _si7021_sim_reply_code(sim,
+            _si7021_sim_code(sim->rh, 125.0f, 6.0f, _rh_bits[res]), true);
+    } else {
+        _si7021_sim_reply_code(sim, temp_code, true);
+    }
+
+    sim->reply.hold     = hold;
+    sim->reply.ready_us = esp_timer_get_time() + conv_us;
+    sim->counters.conversions++;
+}
+
+/* Reply: electronic ID first (SNA) or last (SNB) bytes, with running CRC */
+static void _si7021_sim_reply_eid(
+    si7021_sim_handle_t const sim   ,
+    bool                      first )
+{
+    uint32_t sn  = first
+        ? (uint32_t) (sim->electronic_id >> 32)
+        : (uint32_t) (sim->electronic_id);
+    uint8_t  crc = 0x00;
+    uint8_t  len = 0;
+
+    for (int i = 3; i >= 0; i--) {
+        sim->reply.data[len++] = (sn >> (8 * i)) & 0xFF;
+        crc = _si7021_sim_crc8(&sim->reply.data[len - 1], 1, crc);
+        if (first || !(i & 1)) sim->reply.data[len++] = crc;
+    }
+
+    sim->reply.len    = len;
+    sim->reply.crc_at = len - 1;
+}
+
+/* Soft reset */
+static void _si7021_sim_reset(
+    si7021_sim_handle_t const sim )
+{
+    sim->user_reg      = SI7021_SIM_USER_REG_DEFAULT;
+    sim->heater_reg    = SI7021_SIM_HEATER_REG_DEFAULT;
+    sim->reply.len     = 0;
+    sim->busy_until_us = esp_timer_get_time() + SI7021_SIM_RESET_US;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Simulated Target ----------------------------------------------------------
+
+/* Write phase: a command (& argument) */
+static esp_err_t _si7021_sim_write(
+    void          *ctx  ,
+    uint8_t const *data ,
+    size_t         len  )
+{
+    si7021_sim_handle_t sim = (si7021_sim_handle_t) ctx;
+    esp_err_t err = ESP_OK;
+    int64_t   now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&sim->lock);
+
+    // > Bus stuck, resetting or converting: no ACK
+    if (sim->faults.stuck_bus) {
+        sim->counters.stuck++;
+        portEXIT_CRITICAL(&sim->lock);
+        return ESP_ERR_TIMEOUT;
+    }
+    if (now < sim->busy_until_us ||
+        (sim->reply.len && now < sim->reply.ready_us)) {
+        sim->counters.nacks++;
+        portEXIT_CRITICAL(&sim->lock);
+        return ESP_FAIL;
+    }
+
+    // > Command
+    sim->reply.len      = 0;
+    sim->reply.hold     = false;
+    sim->reply.ready_us = 0;
+    uint8_t cmd = data[0];
+    uint8_t arg = len > 1 ? data[1] : 0;
+
+    if      (cmd == SI7021_I2C_CMD_MEASURE_RH_HOLD_MASTER)
+        _si7021_sim_convert(sim, true,  true);
+    else if (cmd == SI7021_I2C_CMD_MEASURE_RH_NOHOLD_MASTER)
+        _si7021_sim_convert(sim, true,  false);
+    else if (cmd == SI7021_I2C_CMD_MEASURE_TEMP_HOLD_MASTER)
+        _si7021_sim_convert(sim, false, true);
+    else if (cmd == SI7021_I2C_CMD_MEASURE_TEMP_NOHOLD_MASTER)
+        _si7021_sim_convert(sim, false, false);
+    else if (cmd == SI7021_I2C_CMD_READ_TEMP_FROM_PREV_RH_MEASUREMENT)
+        _si7021_sim_reply_code(sim, sim->prev_temp, false);
+    else if (cmd == SI7021_I2C_CMD_RESET)
+        _si7021_sim_reset(sim);
+    else if (cmd == SI7021_I2C_CMD_WRITE_RH_T_USER_REG_1 && len == 2)
+        sim->user_reg = (sim->user_reg & ~SI7021_SIM_USER_REG_WRITABLE) |
+                        (arg & SI7021_SIM_USER_REG_WRITABLE);
+    else if (cmd == SI7021_I2C_CMD_READ_RH_T_USER_REG_1) {
+        sim->reply.data[0] = sim->user_reg;
+        sim->reply.len     = 1;
+        sim->reply.crc_at  = SI7021_SIM_NO_CRC;
+    }
+    else if (cmd == SI7021_I2C_CMD_WRITE_HEATER_CONTROL_REG && len == 2)
+        sim->heater_reg = (sim->heater_reg & ~SI7021_SIM_HEATER_REG_WRITABLE) |
+                          (arg & SI7021_SIM_HEATER_REG_WRITABLE);
+    else if (cmd == SI7021_I2C_CMD_READ_HEATER_CONTROL_REG) {
+        sim->reply.data[0] = sim->heater_reg;
+        sim->reply.len     = 1;
+        sim->reply.crc_at  = SI7021_SIM_NO_CRC;
+    }
+    else if (cmd == SI7021_I2C_CMD_READ_ELECTRONIC_ID_FIRST_BYTES_A &&
+             arg == SI7021_I2C_CMD_READ_ELECTRONIC_ID_FIRST_BYTES_B)
+        _si7021_sim_reply_eid(sim, true);
+    else if (cmd == SI7021_I2C_CMD_READ_ELECTRONIC_ID_LAST_BYTES_A &&
+             arg == SI7021_I2C_CMD_READ_ELECTRONIC_ID_LAST_BYTES_B)
+        _si7021_sim_reply_eid(sim, false);
+    else if (cmd == SI7021_I2C_CMD_READ_FIRMWARE_REVISION_A &&
+             arg == SI7021_I2C_CMD_READ_FIRMWARE_REVISION_B) {
+        sim->reply.data[0] = sim->firmware_revision;
+        sim->reply.len     = 1;
+        sim->reply.crc_at  = SI7021_SIM_NO_CRC;
+    }
+    else err = ESP_FAIL; // Unknown command byte: NACK
+
+    if (err) sim->counters.nacks++;
+    else     sim->counters.commands++;
+
+    portEXIT_CRITICAL(&sim->lock);
+    return err;
+}
+
+/* Read phase: the reply of the last command */
+static esp_err_t _si7021_sim_read(
+    void    *ctx  ,
+    uint8_t *data ,
+    size_t   len  )
+{
+    si7021_sim_handle_t sim = (si7021_sim_handle_t) ctx;
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&sim->lock);
+
+    // > Bus stuck, resetting or nothing to read: no ACK
+    if (sim->faults.stuck_bus) {
+        sim->counters.stuck++;
+        portEXIT_CRITICAL(&sim->lock);
+        return ESP_ERR_TIMEOUT;
+    }
+    if (now < sim->busy_until_us || !sim->reply.len) {
+        sim->counters.nacks++;
+        portEXIT_CRITICAL(&sim->lock);
+        return ESP_FAIL;
+    }
+
+    // > Converting: NACK, or stretch SCL until done (hold master)
+    if (now < sim->reply.ready_us) {
+        if (!sim->reply.hold) {
+            sim->counters.nacks++;
+            portEXIT_CRITICAL(&sim->lock);
+            return ESP_FAIL;
+        }
+        int64_t    wait_us = sim->reply.ready_us - now;
+        int64_t    tick_us = portTICK_PERIOD_MS * 1000;
+        TickType_t ticks   = (TickType_t) ((wait_us + tick_us - 1) / tick_us);
+        sim->counters.stretches++;
+        portEXIT_CRITICAL(&sim->lock);
+        vTaskDelay(ticks);
+        portENTER_CRITICAL(&sim->lock);
+    }
+
+    // > Reply (bytes past the reply read as 0xFF), corrupt CRC if due
+    uint8_t reply[sizeof(sim->reply.data)];
+    memcpy(reply, sim->reply.data, sizeof(reply));
+    if (sim->reply.crc_at != SI7021_SIM_NO_CRC) {
+        sim->replies++;
+        if (sim->faults.crc_error_every &&
+            sim->replies % sim->faults.crc_error_every == 0) {
+            reply[sim->reply.crc_at] ^= 0xFF;
+            sim->counters.crc_errors++;
+        }
+    }
+    for (size_t i = 0; i < len; i++)
+        data[i] = i < sim->reply.len ? reply[i] : 0xFF;
+    sim->reply.len = 0; // Read once
+
+    portEXIT_CRITICAL(&sim->lock);
+    return ESP_OK;
+}
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+/* Create Si7021 Sim */
+esp_err_t si7021_sim_create(
+    si7021_sim_create_args_t const *create_args ,
+    si7021_sim_handle_t            *out_handle  )
+{
+    CHECK_ERR_CREATE_ARGS(create_args);
+    CHECK_ERR_OUT_HANDLE(out_handle);
+    esp_err_t err = ESP_OK;
+
+    // > Allocate & Set Handle
+    si7021_sim_handle_t sim = calloc(1, sizeof(struct si7021_sim));
+    CHECK_ERR_MALLOC(sim);
+
+    sim->i2c_port          = create_args->i2c_port;
+    sim->electronic_id     = create_args->electronic_id;
+    sim->firmware_revision = create_args->firmware_revision;
+    sim->rh                = create_args->rh;
+    sim->temp              = create_args->temp;
+    sim->user_reg          = SI7021_SIM_USER_REG_DEFAULT;
+    sim->heater_reg        = SI7021_SIM_HEATER_REG_DEFAULT;
+    portMUX_INITIALIZE(&sim->lock);
+
+    // > Attach to Simulated Bus
+    i2c_bus_sim_target_t target = {
+        .write = &_si7021_sim_write ,
+        .read  = &_si7021_sim_read  ,
+        .ctx   = sim               };
+    err = i2c_bus_sim_attach(sim->i2c_port, SI7021_I2C_ADDRESS, &target);
+    CHECK_ERR_ATTACH(err, sim);
+
+    *out_handle = sim;
+    return err;
+}
+
+/* Delete Si7021 Sim */
+esp_err_t si7021_sim_delete(
+    si7021_sim_handle_t sim )
+{
+    CHECK_ERR_HANDLE(sim);
+
+    i2c_bus_sim_detach(sim->i2c_port, SI7021_I2C_ADDRESS);
+    free(sim);
+
+    return ESP_OK;
+}
+
+/* Set Environment */
+esp_err_t si7021_sim_set_environment(
+    si7021_sim_handle_t const sim  ,
+    float                     rh   ,
+    float                     temp )
+{
+    CHECK_ERR_HANDLE(sim);
+
+    portENTER_CRITICAL(&sim->lock);
+    sim->rh   = rh;
+    sim->temp = temp;
+    portEXIT_CRITICAL(&sim->lock);
+
+    return ESP_OK;
+}
+
+/* Set Faults */
+esp_err_t si7021_sim_set_faults(
+    si7021_sim_handle_t const  sim    ,
+    si7021_sim_faults_t const *faults )
+{
+    CHECK_ERR_HANDLE(sim);
+    CHECK_ERR_IN_PARAM(faults);
+
+    portENTER_CRITICAL(&sim->lock);
+    sim->faults  = *faults;
+    sim->replies = 0;
+    portEXIT_CRITICAL(&sim->lock);
+
+    return ESP_OK;
+}
+
+/* Get Counters */
+esp_err_t si7021_sim_get_counters(
+    si7021_sim_handle_t   const  sim          ,
+    si7021_sim_counters_t       *out_counters )
+{
+    CHECK_ERR_HANDLE(sim);
+    CHECK_ERR_OUT_PARAM(out_counters);
+
+    portENTER_CRITICAL(&sim->lock);
+    *out_counters = sim->counters;
+    portEXIT_CRITICAL(&sim->lock);
+
+    return ESP_OK;
+}
+
+/* Reset Counters */
+esp_err_t si7021_sim_reset_counters(
+    si7021_sim_handle_t const sim )
+{
+    CHECK_ERR_HANDLE(sim);
+
+    portENTER_CRITICAL(&sim->lock);
+    memset(&sim->counters, 0, sizeof(sim->counters));
+    portEXIT_CRITICAL(&sim->lock);
+
+    return ESP_OK;
+}
+
+// -----------------------------------------------------------------------------
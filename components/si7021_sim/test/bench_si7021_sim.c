@@ -0,0 +1,45 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include "unity.h"
+
+#include "bench_utils.h"
+
+#include "si7021_i2c.h"
+#include "si7021_sim.h"
+
+// BENCHMARKS ------------------------------------------------------------------
+
+/* The model keeps datasheet conversion times, so these measure end-to-end
+ * latency (command to result) rather than CPU cost. */
+TEST_CASE("si7021_i2c measurement latency on the model", "[si7021_sim]" BENCH_TAG)
+{
+    si7021_sim_create_args_t sim_args = SI7021_SIM_DEFAULT_CREATE_ARGS();
+    si7021_i2c_create_args_t i2c_args = SI7021_I2C_DEFAULT_CREATE_ARGS();
+    si7021_sim_handle_t sim = NULL;
+    si7021_i2c_handle_t i2c = NULL;
+    uint16_t rh, temp;
+    uint8_t reg;
+    i2c_args.i2c_driver.uninstall_at_delete = true;
+    TEST_ESP_OK(si7021_sim_create(&sim_args, &sim));
+    TEST_ESP_OK(si7021_i2c_create(&i2c_args, &i2c));
+
+    BENCH_RUN("si7021_i2c read_user_reg_1 (no conversion)", 2000, {
+        si7021_i2c_read_user_reg_1(i2c, &reg, 0);
+        bench_sink(reg);
+    });
+    BENCH_RUN("si7021_i2c measure_rh_and_temp hold master", 20, {
+        si7021_i2c_measure_rh_and_temp_hold_master(i2c, &rh, &temp, true, 0);
+        bench_sink(rh ^ temp);
+    });
+    BENCH_RUN("si7021_i2c measure_rh_and_temp no hold, polled", 20, {
+        si7021_i2c_measure_rh_and_temp_nohold_master(i2c, &rh, &temp, true, 0);
+        bench_sink(rh ^ temp);
+    });
+
+    si7021_i2c_retry_counters_t retry;
+    TEST_ESP_OK(si7021_i2c_get_retry_counters(i2c, &retry));
+    TEST_ASSERT_EQUAL(0, retry.failures);
+
+    TEST_ESP_OK(si7021_i2c_delete(i2c));
+    TEST_ESP_OK(si7021_sim_delete(sim));
+}
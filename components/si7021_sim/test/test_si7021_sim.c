@@ -0,0 +1,139 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include "unity.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "si7021_i2c.h"
+#include "si7021_sim.h"
+
+// DEFINITIONS -----------------------------------------------------------------
+
+/* Datasheet conversion (for checks only; si7021 has the fixed point one) */
+#define RH_FROM_CODE(code)   (125.0f * (code) / 65536.0f - 6.0f)
+#define TEMP_FROM_CODE(code) (175.72f * (code) / 65536.0f - 46.85f)
+
+// STRUCTURES ------------------------------------------------------------------
+
+typedef struct {
+    si7021_sim_handle_t sim;
+    si7021_i2c_handle_t i2c;
+} fixture_t;
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+/* Sensor model on the simulated bus and a si7021_i2c handle creating the bus */
+static void _fixture_setup(fixture_t *f)
+{
+    si7021_sim_create_args_t sim_args = SI7021_SIM_DEFAULT_CREATE_ARGS();
+    si7021_i2c_create_args_t i2c_args = SI7021_I2C_DEFAULT_CREATE_ARGS();
+    i2c_args.i2c_driver.uninstall_at_delete = true;
+
+    f->sim = NULL;
+    f->i2c = NULL;
+    TEST_ESP_OK(si7021_sim_create(&sim_args, &f->sim));
+    TEST_ESP_OK(si7021_i2c_create(&i2c_args, &f->i2c));
+}
+
+static void _fixture_teardown(fixture_t *f)
+{
+    TEST_ESP_OK(si7021_i2c_delete(f->i2c));
+    TEST_ESP_OK(si7021_sim_delete(f->sim));
+}
+
+// TESTS -----------------------------------------------------------------------
+
+TEST_CASE("hold master measurements follow the simulated environment", "[si7021_sim]")
+{
+    fixture_t f;
+    uint16_t rh, temp;
+    _fixture_setup(&f);
+    TEST_ESP_OK(si7021_sim_set_environment(f.sim, 40.0f, 21.5f));
+
+    TEST_ESP_OK(si7021_i2c_measure_rh_hold_master(f.i2c, &rh, true, 0));
+    TEST_ESP_OK(si7021_i2c_measure_temp_hold_master(f.i2c, &temp, true, 0));
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 40.0f, RH_FROM_CODE(rh));
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 21.5f, TEMP_FROM_CODE(temp));
+
+    si7021_sim_counters_t counters;
+    TEST_ESP_OK(si7021_sim_get_counters(f.sim, &counters));
+    TEST_ASSERT_EQUAL(2, counters.conversions);
+    TEST_ASSERT_EQUAL(2, counters.stretches);
+    _fixture_teardown(&f);
+}
+
+TEST_CASE("no hold master reads are NACKed and retried until converted", "[si7021_sim]")
+{
+    fixture_t f;
+    uint16_t rh, temp;
+    si7021_i2c_retry_counters_t retry;
+    _fixture_setup(&f);
+
+    TEST_ESP_OK(si7021_i2c_measure_rh_and_temp_nohold_master(
+        f.i2c, &rh, &temp, true, 0));
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, SI7021_SIM_DEFAULT_RH, RH_FROM_CODE(rh));
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, SI7021_SIM_DEFAULT_TEMP, TEMP_FROM_CODE(temp));
+
+    TEST_ESP_OK(si7021_i2c_get_retry_counters(f.i2c, &retry));
+    TEST_ASSERT_GREATER_THAN(0, retry.nacks);
+    TEST_ASSERT_EQUAL(retry.nacks, retry.retries);
+    TEST_ASSERT_EQUAL(0, retry.failures);
+    _fixture_teardown(&f);
+}
+
+TEST_CASE("injected CRC errors are caught only when checked", "[si7021_sim]")
+{
+    fixture_t f;
+    uint16_t rh;
+    si7021_sim_faults_t faults = { .crc_error_every = 1 };
+    _fixture_setup(&f);
+    TEST_ESP_OK(si7021_sim_set_faults(f.sim, &faults));
+
+    TEST_ESP_ERR(ESP_ERR_INVALID_CRC,
+        si7021_i2c_measure_rh_hold_master(f.i2c, &rh, true, 0));
+    TEST_ESP_OK(si7021_i2c_measure_rh_hold_master(f.i2c, &rh, false, 0));
+    _fixture_teardown(&f);
+}
+
+TEST_CASE("stuck bus fails once the retry timeout is used up", "[si7021_sim]")
+{
+    fixture_t f;
+    uint8_t reg;
+    si7021_i2c_retry_counters_t retry;
+    si7021_sim_faults_t faults = { .stuck_bus = true };
+    _fixture_setup(&f);
+    TEST_ESP_OK(si7021_sim_set_faults(f.sim, &faults));
+
+    TEST_ESP_ERR(ESP_ERR_TIMEOUT, si7021_i2c_read_user_reg_1(f.i2c, &reg, 0));
+    TEST_ESP_OK(si7021_i2c_get_retry_counters(f.i2c, &retry));
+    TEST_ASSERT_EQUAL(1, retry.timeouts);
+    TEST_ASSERT_EQUAL(1, retry.failures);
+
+    faults.stuck_bus = false;
+    TEST_ESP_OK(si7021_sim_set_faults(f.sim, &faults));
+    TEST_ESP_OK(si7021_i2c_read_user_reg_1(f.i2c, &reg, 0));
+    _fixture_teardown(&f);
+}
+
+TEST_CASE("registers keep reserved bits and the ID reads back", "[si7021_sim]")
+{
+    fixture_t f;
+    uint8_t reg, fw;
+    uint32_t sna, snb;
+    _fixture_setup(&f);
+
+    TEST_ESP_OK(si7021_i2c_read_user_reg_1(f.i2c, &reg, 0));
+    TEST_ASSERT_EQUAL_HEX8(0x3A, reg);
+    TEST_ESP_OK(si7021_i2c_write_user_reg_1(f.i2c, 0xFF));
+    TEST_ESP_OK(si7021_i2c_read_user_reg_1(f.i2c, &reg, 0));
+    TEST_ASSERT_EQUAL_HEX8(0x3A | 0x85, reg);
+
+    TEST_ESP_OK(si7021_i2c_read_electronic_id_first_bytes(f.i2c, &sna, true, 0));
+    TEST_ESP_OK(si7021_i2c_read_electronic_id_last_bytes(f.i2c, &snb, true, 0));
+    TEST_ASSERT_EQUAL_HEX32(SI7021_SIM_DEFAULT_ELECTRONIC_ID >> 32, sna);
+    TEST_ASSERT_EQUAL_HEX32(SI7021_SIM_DEFAULT_ELECTRONIC_ID & 0xFFFFFFFF, snb);
+    TEST_ESP_OK(si7021_i2c_read_firmware_revision(f.i2c, &fw, 0));
+    TEST_ASSERT_EQUAL_HEX8(SI7021_SIM_DEFAULT_FIRMWARE_REVISION, fw);
+    _fixture_teardown(&f);
+}
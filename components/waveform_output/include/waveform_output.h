@@ -0,0 +1,102 @@
+#ifndef __WAVEFORM_OUTPUT_H__
+#define __WAVEFORM_OUTPUT_H__
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>      // uint8_t, uint32_t
+#include <stdbool.h>     // bool
+#include "esp_err.h"     // esp_err_t
+#include "driver/gpio.h" // gpio_num_t
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define WAVEFORM_OUTPUT_NAME_LENGTH 32
+#define WAVEFORM_OUTPUT_MAX_GPIO    8
+
+//// KCONFIG -------------------------------------------------------------------
+
+#define WAVEFORM_OUTPUT_DEFAULT_NAME                    /* "waveform_output" */ \
+        CONFIG_WAVEFORM_OUTPUT_DEFAULT_NAME
+#define WAVEFORM_OUTPUT_DEFAULT_LEDC_TIMER                              /* 0 */ \
+        CONFIG_WAVEFORM_OUTPUT_DEFAULT_LEDC_TIMER
+#define WAVEFORM_OUTPUT_DEFAULT_LEDC_CHANNEL                            /* 0 */ \
+        CONFIG_WAVEFORM_OUTPUT_DEFAULT_LEDC_CHANNEL
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Waveform Output Handle */
+typedef struct waveform_output *waveform_output_handle_t;
+
+/* Waveform Output Create Args */
+typedef struct {
+    const char *name;         // Handle name
+    uint8_t     num_gpio;     // Number of GPIOs (all driven in phase)
+    uint8_t     ledc_timer;   // LEDC timer (low speed mode)
+    uint8_t     ledc_channel; // LEDC channel (low speed mode)
+
+    gpio_num_t gpio[WAVEFORM_OUTPUT_MAX_GPIO]; // Output GPIOs
+} waveform_output_create_args_t;
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+/* Waveform Output Default Create Args (GPIOs must be set by the user) */
+#define WAVEFORM_OUTPUT_DEFAULT_CREATE_ARGS() {                                \
+    .name         = WAVEFORM_OUTPUT_DEFAULT_NAME,                              \
+    .num_gpio     = 0,                                                         \
+    .ledc_timer   = WAVEFORM_OUTPUT_DEFAULT_LEDC_TIMER,                        \
+    .ledc_channel = WAVEFORM_OUTPUT_DEFAULT_LEDC_CHANNEL,                      \
+    .gpio         = { 0 }                                                      \
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS -------------------------------------------------------------------
+
+/* Create & Delete */
+/* The GPIOs are configured as outputs (low) at creation and reset at deletion.
+ * The LEDC timer and channel must not be used by anyone else.
+ */
+esp_err_t waveform_output_create(
+    waveform_output_create_args_t const *create_args ,
+    waveform_output_handle_t            *out_handle  );
+
+esp_err_t waveform_output_delete(
+    waveform_output_handle_t waveform_output );
+
+/* Square Wave */
+/* While started, the GPIOs are routed to the LEDC channel and the waveform is
+ * generated by the peripheral with no CPU involvement. <period_us> is the full
+ * period (a blink toggling every T ms has a period of 2*T ms) and
+ * <duty_percent> the high time. Periods from ~1 us up to ~13.4 s (ESP32:
+ * 20-bit duty at the slowest divider of the 80 MHz clock) are supported;
+ * targets with a 14-bit duty resolution stop at ~0.2 s. Longer periods return
+ * ESP_ERR_INVALID_ARG. Calling it while started just changes the waveform.
+ */
+esp_err_t waveform_output_start_square(
+    waveform_output_handle_t const waveform_output ,
+    uint32_t                       period_us       ,
+    uint8_t                        duty_percent    );
+
+/* Stop */
+/* Stops the waveform and gives the GPIOs back to the GPIO driver, at
+ * <idle_level>, so gpio_set_level works on them again.
+ */
+esp_err_t waveform_output_stop(
+    waveform_output_handle_t const waveform_output ,
+    uint32_t                       idle_level      );
+
+/* Info */
+bool waveform_output_is_active(
+    waveform_output_handle_t const waveform_output );
+
+// -----------------------------------------------------------------------------
+
+#endif // __WAVEFORM_OUTPUT_H__
@@ -0,0 +1,141 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include "unity.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+
+#include "gpio_mock.h"
+
+#include "waveform_output.h"
+
+// The linux target builds the esp_timer backend (WAVEFORM_OUTPUT_BACKEND_TIMER)
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+static waveform_output_handle_t _create(void)
+{
+    waveform_output_create_args_t args = WAVEFORM_OUTPUT_DEFAULT_CREATE_ARGS();
+    args.num_gpio = 2;
+    args.gpio[0]  = GPIO_NUM_4;
+    args.gpio[1]  = GPIO_NUM_5;
+
+    waveform_output_handle_t waveform_output = NULL;
+    gpio_mock_reset();
+    TEST_ESP_OK(waveform_output_create(&args, &waveform_output));
+    return waveform_output;
+}
+
+/* Busy wait (shorter than a tick) */
+static void _spin_us(int64_t us)
+{
+    int64_t end = esp_timer_get_time() + us;
+    while (esp_timer_get_time() < end) { }
+}
+
+// TESTS -----------------------------------------------------------------------
+
+TEST_CASE("square wave toggles in phase and stops at the idle level", "[waveform_output]")
+{
+    waveform_output_handle_t waveform_output = _create();
+
+    // > 10 ms period: a toggle every 5 ms on both GPIOs
+    TEST_ESP_OK(waveform_output_start_square(waveform_output, 10000, 50));
+    TEST_ASSERT_TRUE(waveform_output_is_active(waveform_output));
+    vTaskDelay(pdMS_TO_TICKS(100));
+    TEST_ESP_OK(waveform_output_stop(waveform_output, 1));
+
+    uint32_t toggles = gpio_mock_get_toggles(GPIO_NUM_4);
+    TEST_ASSERT_UINT32_WITHIN(10, 20, toggles);
+    TEST_ASSERT_UINT32_WITHIN(1, toggles, gpio_mock_get_toggles(GPIO_NUM_5));
+    TEST_ASSERT_EQUAL(1, gpio_get_level(GPIO_NUM_4));
+    TEST_ASSERT_EQUAL(1, gpio_get_level(GPIO_NUM_5));
+    TEST_ASSERT_FALSE(waveform_output_is_active(waveform_output));
+
+    // > Stopped for good
+    vTaskDelay(pdMS_TO_TICKS(30));
+    TEST_ASSERT_EQUAL_UINT32(toggles, gpio_mock_get_toggles(GPIO_NUM_4));
+
+    // > Starts again after a stop
+    TEST_ESP_OK(waveform_output_start_square(waveform_output, 10000, 50));
+    vTaskDelay(pdMS_TO_TICKS(50));
+    TEST_ESP_OK(waveform_output_stop(waveform_output, 0));
+    TEST_ASSERT_GREATER_THAN_UINT32(toggles + 4, gpio_mock_get_toggles(GPIO_NUM_4));
+    TEST_ASSERT_EQUAL(0, gpio_get_level(GPIO_NUM_4));
+
+    TEST_ESP_OK(waveform_output_delete(waveform_output));
+}
+
+TEST_CASE("constant duty cycles need no timer", "[waveform_output]")
+{
+    waveform_output_handle_t waveform_output = _create();
+
+    TEST_ESP_OK(waveform_output_start_square(waveform_output, 1000, 100));
+    vTaskDelay(pdMS_TO_TICKS(10));
+    TEST_ASSERT_EQUAL(1, gpio_get_level(GPIO_NUM_4));
+    TEST_ASSERT_EQUAL_UINT32(1, gpio_mock_get_toggles(GPIO_NUM_4));
+
+    TEST_ESP_OK(waveform_output_start_square(waveform_output, 1000, 0));
+    vTaskDelay(pdMS_TO_TICKS(10));
+    TEST_ASSERT_EQUAL(0, gpio_get_level(GPIO_NUM_4));
+    TEST_ASSERT_EQUAL_UINT32(2, gpio_mock_get_toggles(GPIO_NUM_4));
+
+    TEST_ESP_OK(waveform_output_delete(waveform_output));
+}
+
+TEST_CASE("stop waits for a toggle in progress", "[waveform_output]")
+{
+    waveform_output_handle_t waveform_output = _create();
+
+    // > Slow toggles (3 ms per GPIO): stop lands in the middle of one
+    gpio_mock_set_level_delay(3000);
+    for (int i = 0; i < 5; i++) {
+        TEST_ESP_OK(waveform_output_start_square(waveform_output, 20000, 50));
+        vTaskDelay(pdMS_TO_TICKS(12));
+        TEST_ESP_OK(waveform_output_stop(waveform_output, 0));
+
+        uint32_t toggles = gpio_mock_get_toggles(GPIO_NUM_5);
+        vTaskDelay(pdMS_TO_TICKS(40));
+        TEST_ASSERT_EQUAL_UINT32(toggles, gpio_mock_get_toggles(GPIO_NUM_5));
+        TEST_ASSERT_EQUAL(0, gpio_get_level(GPIO_NUM_4));
+        TEST_ASSERT_EQUAL(0, gpio_get_level(GPIO_NUM_5));
+    }
+    gpio_mock_set_level_delay(0);
+
+    TEST_ESP_OK(waveform_output_delete(waveform_output));
+}
+
+TEST_CASE("stop, restart and delete race the re-arming callback", "[waveform_output]")
+{
+    // > Stop while a callback may be toggling: no toggle after the stop
+    waveform_output_handle_t waveform_output = _create();
+    for (int i = 0; i < 200; i++) {
+        TEST_ESP_OK(waveform_output_start_square(waveform_output, 200, 50));
+        _spin_us(100 + (i % 7) * 37);
+        TEST_ESP_OK(waveform_output_stop(waveform_output, 0));
+
+        uint32_t toggles = gpio_mock_get_toggles(GPIO_NUM_4);
+        _spin_us(1000);
+        TEST_ASSERT_EQUAL_UINT32(toggles, gpio_mock_get_toggles(GPIO_NUM_4));
+        TEST_ASSERT_EQUAL(0, gpio_get_level(GPIO_NUM_4));
+    }
+
+    // > Restart while toggling: the new waveform keeps running
+    for (int i = 0; i < 200; i++) {
+        TEST_ESP_OK(waveform_output_start_square(waveform_output, 200, 50));
+        _spin_us(100 + (i % 7) * 37);
+    }
+    uint32_t toggles = gpio_mock_get_toggles(GPIO_NUM_4);
+    vTaskDelay(pdMS_TO_TICKS(20));
+    TEST_ASSERT_GREATER_THAN_UINT32(toggles, gpio_mock_get_toggles(GPIO_NUM_4));
+    TEST_ESP_OK(waveform_output_delete(waveform_output));
+
+    // > Delete while toggling (no callback left on the freed handle)
+    for (int i = 0; i < 50; i++) {
+        waveform_output = _create();
+        TEST_ESP_OK(waveform_output_start_square(waveform_output, 200, 50));
+        _spin_us(100 + (i % 7) * 37);
+        TEST_ESP_OK(waveform_output_delete(waveform_output));
+    }
+}
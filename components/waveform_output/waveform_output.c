@@ -0,0 +1,538 @@
+#include "waveform_output.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdlib.h>         // for malloc, free
+#include "string.h"         // for strncpy
+#include "esp_err.h"        // for ESP errors
+#include "driver/gpio.h"    // for ESP GPIO driver
+
+#if CONFIG_WAVEFORM_OUTPUT_BACKEND_TIMER
+#include "esp_timer.h"      // for esp_timer (fallback backend)
+#include "freertos/FreeRTOS.h" // for critical sections
+#include "freertos/semphr.h"   // for delete fence
+#else
+#include "driver/ledc.h"    // for LEDC driver
+#include "esp_rom_gpio.h"   // for esp_rom_gpio_connect_out_signal
+#include "soc/gpio_sig_map.h" // for SIG_GPIO_OUT_IDX
+#endif
+
+/* Logging */
+#include "esp_log.h"
+static const char *TAG = "Waveform Output";
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#if !CONFIG_WAVEFORM_OUTPUT_BACKEND_TIMER
+/* LEDC timer clock (APB) and divider format (10 integer, 8 fractional bits) */
+#define WAVEFORM_OUTPUT_LEDC_CLK_MHZ  80ULL
+#define WAVEFORM_OUTPUT_LEDC_DIV_MIN  (1UL << 8)
+#define WAVEFORM_OUTPUT_LEDC_DIV_MAX  (1UL << 18)
+#endif
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Waveform Output Handle */
+struct waveform_output {
+    char       name[WAVEFORM_OUTPUT_NAME_LENGTH]; // Handle name
+    uint8_t    num_gpio;                          // Number of GPIOs
+    gpio_num_t gpio[WAVEFORM_OUTPUT_MAX_GPIO];    // Output GPIOs
+    bool       active;                            // Waveform running
+
+#if CONFIG_WAVEFORM_OUTPUT_BACKEND_TIMER
+    esp_timer_handle_t timer;    // Toggle timer
+    portMUX_TYPE       lock;     // Toggle state below
+    bool               toggling; // Callback toggles & re-arms
+    bool               fencing;  // Callback gives <fence> (delete)
+    SemaphoreHandle_t  fence;    // No callback of the handle left running
+    uint32_t           high_us;  // High time
+    uint32_t           low_us;   // Low time
+    uint32_t           level;    // Current level
+#else
+    ledc_timer_t   ledc_timer;   // LEDC timer
+    ledc_channel_t ledc_channel; // LEDC channel
+#endif
+};
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+//// CREATE & DELETE -----------------------------------------------------------
+
+#define CHECK_ERR_CREATE_ARGS(create_args)                                     \
+    if (!create_args) {                                                        \
+        ESP_LOGE(TAG, "Pointer to waveform_output_create_args_t is NULL.");    \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUT_HANDLE(out_handle)                                       \
+    if (!out_handle) {                                                         \
+        ESP_LOGE(TAG, "Pointer to waveform_output_handle_t is NULL.");         \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_NUM_GPIO(num_gpio)                                           \
+    if (num_gpio == 0 || num_gpio > WAVEFORM_OUTPUT_MAX_GPIO) {                \
+        ESP_LOGE(TAG, "Number of GPIOs must be between 1 and %d.",             \
+            WAVEFORM_OUTPUT_MAX_GPIO);                                         \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_OUTPUT_GPIO(gpio)                                            \
+    if (!GPIO_IS_VALID_OUTPUT_GPIO(gpio)) {                                    \
+        ESP_LOGE(TAG, "GPIO %d is not a valid output GPIO.", gpio);            \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_MALLOC(ptr)                                                  \
+    if (!ptr) {                                                                \
+        ESP_LOGE(TAG, "Could not allocate memory.");                           \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+#define CHECK_ERR_GPIO_CONFIG(err, ptr)                                        \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Could not configure GPIOs: %s", esp_err_to_name(err));  \
+        free(ptr);                                                             \
+        return err;                                                            \
+    }
+
+#define CHECK_ERR_CREATE_TIMER(err, ptr)                                       \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Error creating timer: %s", esp_err_to_name(err));       \
+        if (ptr->fence) vSemaphoreDelete(ptr->fence);                          \
+        free(ptr);                                                             \
+        return err;                                                            \
+    }
+
+#define LOG_WARN_GPIO_RESET_PIN(err, gpio)                                     \
+    if (err)                                                                   \
+        ESP_LOGW(TAG, "Error resetting GPIO %d: %s",                           \
+            gpio, esp_err_to_name(err));
+
+//// ---------------------------------------------------------------------------
+
+//// HANDLE ERRORS -------------------------------------------------------------
+
+#define CHECK_ERR_HANDLE(handle)                                               \
+    if (!handle) {                                                             \
+        ESP_LOGE(TAG, "Waveform output handle is NULL.");                      \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+//// ---------------------------------------------------------------------------
+
+//// WAVEFORM ERRORS -----------------------------------------------------------
+
+#define CHECK_ERR_WAVEFORM(period_us, duty_percent)                            \
+    if (period_us == 0 || duty_percent > 100) {                                \
+        ESP_LOGE(TAG, "Invalid waveform (period %u us, duty %u%%).",           \
+            (unsigned) period_us, (unsigned) duty_percent);                    \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_LEDC_DIVIDER(div, period_us)                                 \
+    if (div < WAVEFORM_OUTPUT_LEDC_DIV_MIN || div >= WAVEFORM_OUTPUT_LEDC_DIV_MAX) { \
+        ESP_LOGE(TAG, "Period %u us out of LEDC range.", (unsigned) period_us);\
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_LEDC(err, what)                                              \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Error setting LEDC %s: %s", what, esp_err_to_name(err));\
+        return err;                                                            \
+    }
+
+#define CHECK_ERR_TIMER(err)                                                   \
+    if (err) {                                                                 \
+        ESP_LOGE(TAG, "Error starting timer: %s", esp_err_to_name(err));       \
+        return err;                                                            \
+    }
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+/* Set all GPIOs to <level> (through the GPIO driver) */
+static void _waveform_output_set_gpio_level(
+    struct waveform_output *waveform_output ,
+    uint32_t                level           )
+{
+    for (int i = 0; i < waveform_output->num_gpio; i++)
+        gpio_set_level(waveform_output->gpio[i], level);
+}
+
+#if CONFIG_WAVEFORM_OUTPUT_BACKEND_TIMER
+
+//// Timer Backend -------------------------------------------------------------
+
+/* Toggle Timer Callback (one shot, re-armed with the next phase duration) */
+/* esp_timer_stop does not wait for a callback already running, so the toggle
+ * state is only changed under <lock>, here and by start & stop. A callback
+ * that finds the timer armed again lost a race with a newer start: the new
+ * waveform is left alone.
+ */
+static void _waveform_output_timer_cb(
+    void *arg )
+{
+    struct waveform_output *waveform_output = arg;
+
+    portENTER_CRITICAL(&waveform_output->lock);
+    if (esp_timer_is_active(waveform_output->timer)) {
+        portEXIT_CRITICAL(&waveform_output->lock);
+        return;
+    }
+
+    // > Delete fence: last access to the handle
+    if (waveform_output->fencing) {
+        SemaphoreHandle_t fence = waveform_output->fence;
+        portEXIT_CRITICAL(&waveform_output->lock);
+        xSemaphoreGive(fence);
+        return;
+    }
+
+    // > Toggle & re-arm (unless stopped meanwhile)
+    if (waveform_output->toggling) {
+        waveform_output->level ^= 1;
+        _waveform_output_set_gpio_level(waveform_output, waveform_output->level);
+        esp_timer_start_once(
+            waveform_output->timer                    ,
+            waveform_output->level ? waveform_output->high_us
+                                   : waveform_output->low_us );
+    }
+    portEXIT_CRITICAL(&waveform_output->lock);
+}
+
+/* Start Square Wave */
+static esp_err_t _waveform_output_backend_start(
+    struct waveform_output *waveform_output ,
+    uint32_t                period_us       ,
+    uint8_t                 duty_percent    )
+{
+    esp_err_t err = ESP_OK;
+
+    // > Stop previous waveform
+    portENTER_CRITICAL(&waveform_output->lock);
+    waveform_output->toggling = false;
+    esp_timer_stop(waveform_output->timer);
+
+    // > Constant levels need no timer
+    if (duty_percent == 0 || duty_percent == 100) {
+        waveform_output->level = duty_percent ? 1 : 0;
+        _waveform_output_set_gpio_level(waveform_output, waveform_output->level);
+        portEXIT_CRITICAL(&waveform_output->lock);
+        return err;
+    }
+
+    waveform_output->high_us = (uint64_t) period_us * duty_percent / 100;
+    waveform_output->low_us  = period_us - waveform_output->high_us;
+
+    // > Start high
+    waveform_output->level = 1;
+    _waveform_output_set_gpio_level(waveform_output, 1);
+    err = esp_timer_start_once(waveform_output->timer, waveform_output->high_us);
+    waveform_output->toggling = !err;
+    portEXIT_CRITICAL(&waveform_output->lock);
+    CHECK_ERR_TIMER(err);
+
+    return err;
+}
+
+/* Stop */
+static esp_err_t _waveform_output_backend_stop(
+    struct waveform_output *waveform_output ,
+    uint32_t                idle_level      )
+{
+    portENTER_CRITICAL(&waveform_output->lock);
+    waveform_output->toggling = false;
+    esp_timer_stop(waveform_output->timer);
+    waveform_output->level = idle_level;
+    _waveform_output_set_gpio_level(waveform_output, idle_level);
+    portEXIT_CRITICAL(&waveform_output->lock);
+    return ESP_OK;
+}
+
+/* Wait for a Callback in Flight (before deleting the timer) */
+/* Callbacks run one at a time in the esp_timer task: once an immediate one
+ * armed here has run, any earlier one has returned.
+ */
+static void _waveform_output_backend_fence(
+    struct waveform_output *waveform_output )
+{
+    portENTER_CRITICAL(&waveform_output->lock);
+    waveform_output->toggling = false;
+    waveform_output->fencing  = true;
+    esp_timer_stop(waveform_output->timer);
+    esp_err_t err = esp_timer_start_once(waveform_output->timer, 0);
+    portEXIT_CRITICAL(&waveform_output->lock);
+
+    if (!err) xSemaphoreTake(waveform_output->fence, portMAX_DELAY);
+}
+
+//// ---------------------------------------------------------------------------
+
+#else
+
+//// LEDC Backend --------------------------------------------------------------
+
+/* Start Square Wave */
+static esp_err_t _waveform_output_backend_start(
+    struct waveform_output *waveform_output ,
+    uint32_t                period_us       ,
+    uint8_t                 duty_percent    )
+{
+    esp_err_t err = ESP_OK;
+
+    // > Find the highest duty resolution whose clock divider fits
+    uint32_t duty_resolution;
+    uint64_t div = 0;
+    for (duty_resolution = LEDC_TIMER_BIT_MAX - 1; duty_resolution > 1; duty_resolution--) {
+        div = (WAVEFORM_OUTPUT_LEDC_CLK_MHZ * period_us * WAVEFORM_OUTPUT_LEDC_DIV_MIN)
+            >> duty_resolution;
+        if (div >= WAVEFORM_OUTPUT_LEDC_DIV_MIN) break;
+    }
+    CHECK_ERR_LEDC_DIVIDER(div, period_us);
+
+    // > Configure Timer
+    // (ledc_timer_config only takes whole Hz, so the exact divider is set after)
+    uint32_t freq_hz = (1000000UL + period_us / 2) / period_us;
+    ledc_timer_config_t timer_conf = {
+        .speed_mode      = LEDC_LOW_SPEED_MODE           ,
+        .duty_resolution = duty_resolution               ,
+        .timer_num       = waveform_output->ledc_timer   ,
+        .freq_hz         = freq_hz ? freq_hz : 1         ,
+        .clk_cfg         = LEDC_USE_APB_CLK            };
+    err = ledc_timer_config(&timer_conf);
+    CHECK_ERR_LEDC(err, "timer");
+
+    err = ledc_timer_set(
+        LEDC_LOW_SPEED_MODE         ,
+        waveform_output->ledc_timer ,
+        (uint32_t) div              ,
+        duty_resolution             ,
+        LEDC_APB_CLK                );
+    CHECK_ERR_LEDC(err, "timer divider");
+
+    err = ledc_timer_rst(LEDC_LOW_SPEED_MODE, waveform_output->ledc_timer);
+    CHECK_ERR_LEDC(err, "timer reset");
+
+    // (paused by a previous stop: neither config nor reset clear the pause)
+    err = ledc_timer_resume(LEDC_LOW_SPEED_MODE, waveform_output->ledc_timer);
+    CHECK_ERR_LEDC(err, "timer resume");
+
+    // > Configure Channel on first GPIO (starts the output)
+    ledc_channel_config_t channel_conf = {
+        .gpio_num   = waveform_output->gpio[0]                         ,
+        .speed_mode = LEDC_LOW_SPEED_MODE                              ,
+        .channel    = waveform_output->ledc_channel                    ,
+        .intr_type  = LEDC_INTR_DISABLE                                ,
+        .timer_sel  = waveform_output->ledc_timer                      ,
+        .duty       = (uint32_t)(((uint64_t) duty_percent << duty_resolution) / 100) ,
+        .hpoint     = 0                                              };
+    err = ledc_channel_config(&channel_conf);
+    CHECK_ERR_LEDC(err, "channel");
+
+    // > Route the same channel to the other GPIOs (all in phase)
+    for (int i = 1; i < waveform_output->num_gpio; i++) {
+        err = ledc_set_pin(
+            waveform_output->gpio[i]     ,
+            LEDC_LOW_SPEED_MODE          ,
+            waveform_output->ledc_channel );
+        CHECK_ERR_LEDC(err, "pin");
+    }
+
+    return err;
+}
+
+/* Stop */
+static esp_err_t _waveform_output_backend_stop(
+    struct waveform_output *waveform_output ,
+    uint32_t                idle_level      )
+{
+    esp_err_t err = ESP_OK;
+
+    // > Stop Channel & Timer
+    err = ledc_stop(LEDC_LOW_SPEED_MODE, waveform_output->ledc_channel, idle_level);
+    CHECK_ERR_LEDC(err, "stop");
+    ledc_timer_pause(LEDC_LOW_SPEED_MODE, waveform_output->ledc_timer);
+
+    // > Give GPIOs back to the GPIO driver (level set before rerouting)
+    _waveform_output_set_gpio_level(waveform_output, idle_level);
+    for (int i = 0; i < waveform_output->num_gpio; i++)
+        esp_rom_gpio_connect_out_signal(
+            waveform_output->gpio[i], SIG_GPIO_OUT_IDX, false, false);
+
+    return err;
+}
+
+//// ---------------------------------------------------------------------------
+
+#endif // CONFIG_WAVEFORM_OUTPUT_BACKEND_TIMER
+
+// -----------------------------------------------------------------------------
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+//// Create & Delete -----------------------------------------------------------
+
+/* Create Waveform Output */
+esp_err_t waveform_output_create(
+    waveform_output_create_args_t const *create_args ,
+    waveform_output_handle_t            *out_handle  )
+{
+    CHECK_ERR_CREATE_ARGS(create_args);
+    CHECK_ERR_OUT_HANDLE(out_handle);
+    CHECK_ERR_NUM_GPIO(create_args->num_gpio);
+    esp_err_t err = ESP_OK;
+
+    // > Check GPIOs
+    uint64_t pin_bit_mask = 0;
+    for (int i = 0; i < create_args->num_gpio; i++) {
+        CHECK_ERR_OUTPUT_GPIO(create_args->gpio[i]);
+        pin_bit_mask |= 1ULL << create_args->gpio[i];
+    }
+
+    // > Allocate Memory for Handle
+    struct waveform_output *waveform_output =
+        malloc(sizeof(struct waveform_output));
+    CHECK_ERR_MALLOC(waveform_output);
+
+    // > Configure GPIOs as outputs (low)
+    gpio_config_t gpio_conf = {
+        .pin_bit_mask = pin_bit_mask          ,
+        .mode         = GPIO_MODE_OUTPUT      ,
+        .pull_up_en   = GPIO_PULLUP_DISABLE   ,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE ,
+        .intr_type    = GPIO_INTR_DISABLE   };
+    err = gpio_config(&gpio_conf);
+    CHECK_ERR_GPIO_CONFIG(err, waveform_output);
+
+    // > Set Handle
+    strncpy(
+        waveform_output->name         ,
+        create_args->name             ,
+        WAVEFORM_OUTPUT_NAME_LENGTH );
+    waveform_output->num_gpio = create_args->num_gpio;
+    for (int i = 0; i < create_args->num_gpio; i++)
+        waveform_output->gpio[i] = create_args->gpio[i];
+    waveform_output->active = false;
+    _waveform_output_set_gpio_level(waveform_output, 0);
+
+#if CONFIG_WAVEFORM_OUTPUT_BACKEND_TIMER
+    // > Create Toggle Timer & Delete Fence
+    waveform_output->level    = 0;
+    waveform_output->toggling = false;
+    waveform_output->fencing  = false;
+    portMUX_INITIALIZE(&waveform_output->lock);
+    waveform_output->fence = xSemaphoreCreateBinary();
+    err = waveform_output->fence ? ESP_OK : ESP_ERR_NO_MEM;
+    CHECK_ERR_CREATE_TIMER(err, waveform_output);
+
+    esp_timer_create_args_t timer_args = {
+        .callback        = &_waveform_output_timer_cb ,
+        .arg             = waveform_output            ,
+        .dispatch_method = ESP_TIMER_TASK             ,
+        .name            = "waveform_output"         };
+    err = esp_timer_create(&timer_args, &waveform_output->timer);
+    CHECK_ERR_CREATE_TIMER(err, waveform_output);
+#else
+    waveform_output->ledc_timer   = (ledc_timer_t)   create_args->ledc_timer;
+    waveform_output->ledc_channel = (ledc_channel_t) create_args->ledc_channel;
+#endif
+
+    *out_handle = waveform_output;
+    return err;
+}
+
+/* Delete Waveform Output */
+esp_err_t waveform_output_delete(
+    waveform_output_handle_t waveform_output )
+{
+    CHECK_ERR_HANDLE(waveform_output);
+    esp_err_t err;
+    int err_count = 0;
+
+    // > Stop Waveform
+    if (waveform_output->active)
+        _waveform_output_backend_stop(waveform_output, 0);
+
+#if CONFIG_WAVEFORM_OUTPUT_BACKEND_TIMER
+    _waveform_output_backend_fence(waveform_output);
+    esp_timer_delete(waveform_output->timer);
+    vSemaphoreDelete(waveform_output->fence);
+#endif
+
+    // > Reset GPIOs
+    for (int i = 0; i < waveform_output->num_gpio; i++) {
+        err = gpio_reset_pin(waveform_output->gpio[i]);
+        if (err) err_count++;
+        LOG_WARN_GPIO_RESET_PIN(err, waveform_output->gpio[i]);
+    }
+
+    // > Free Memory
+    free(waveform_output);
+
+    return err_count ? ESP_FAIL : ESP_OK;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Square Wave & Stop --------------------------------------------------------
+
+/* Start Square Wave */
+esp_err_t waveform_output_start_square(
+    waveform_output_handle_t const waveform_output ,
+    uint32_t                       period_us       ,
+    uint8_t                        duty_percent    )
+{
+    CHECK_ERR_HANDLE(waveform_output);
+    CHECK_ERR_WAVEFORM(period_us, duty_percent);
+    esp_err_t err = ESP_OK;
+
+    err = _waveform_output_backend_start(waveform_output, period_us, duty_percent);
+    if (err) return err;
+
+    waveform_output->active = true;
+    return err;
+}
+
+/* Stop */
+esp_err_t waveform_output_stop(
+    waveform_output_handle_t const waveform_output ,
+    uint32_t                       idle_level      )
+{
+    CHECK_ERR_HANDLE(waveform_output);
+    esp_err_t err = ESP_OK;
+
+    // > Not started: GPIOs are already driven by the GPIO driver
+    if (!waveform_output->active) {
+        _waveform_output_set_gpio_level(waveform_output, idle_level ? 1 : 0);
+        return err;
+    }
+
+    err = _waveform_output_backend_stop(waveform_output, idle_level ? 1 : 0);
+    if (err) return err;
+
+    waveform_output->active = false;
+    return err;
+}
+
+//// ---------------------------------------------------------------------------
+
+//// Info ----------------------------------------------------------------------
+
+/* Is Active */
+bool waveform_output_is_active(
+    waveform_output_handle_t const waveform_output )
+{ return waveform_output ? waveform_output->active : false; }
+
+//// ---------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
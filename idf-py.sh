@@ -1,8 +1,12 @@
 CURRENTDIR=$(pwd)
 
+# Repository root is mounted so that projects can reach the shared components
+REPODIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" >/dev/null 2>&1 && pwd )"
+PROJECTDIR="/project${CURRENTDIR#$REPODIR}"
+
 # Docker Command
 DOCKER_CMD="docker run"
-DOCKER_CMD_ARGS="--rm -it -v $CURRENTDIR:/project -w /project"
+DOCKER_CMD_ARGS="--rm -it -v $REPODIR:/project -w $PROJECTDIR"
 DOCKER_BASE_IMG="espressif/idf"
 DOCKER_IMG="$DOCKER_BASE_IMG:latest" # default image
 
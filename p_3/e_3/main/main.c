@@ -3,58 +3,42 @@
 // include for logging
 #include "esp_log.h"
 
-// include for ESP GPIO
-#include "driver/gpio.h"
+// include for GPIO edge capture
+#include "gpio_edge_capture.h"
 
 // input GPIO
 #define GPIO_INPUT 5
 
 
-// include HRT timer
-#include "esp_timer.h"
-
-#define PERIOD_MS 1000
-
-
-// Periodic timer callback
-void periodic_timer_callback(void* arg)
+void app_main(void)
 {
     // TAG
-    static const char* TAG = "TIMER";
+    static const char* TAG = "EDGE";
+
+    // capture edges of GPIO as input (interrupt driven, no polling)
+    gpio_edge_capture_create_args_t edge_capture_args = GPIO_EDGE_CAPTURE_DEFAULT_CREATE_ARGS();
+    edge_capture_args.name = "gpio_input";
+    edge_capture_args.gpio = GPIO_INPUT;
 
-    // value
-    static int prev_value = -1;
+    gpio_edge_capture_handle_t edge_capture;
+    ESP_ERROR_CHECK(gpio_edge_capture_create(&edge_capture_args, &edge_capture));
 
-    // read GPIO
-    int value = gpio_get_level(GPIO_INPUT);
+    // initial value
+    int value;
+    gpio_edge_capture_get_level(edge_capture, &value);
+    ESP_LOGI(TAG, "GPIO %d: %d", GPIO_INPUT, value);
 
-    if (value != prev_value)
+    // log each (debounced) change of the input
+    gpio_edge_capture_event_t event;
+    while (1)
     {
-        // log
-        ESP_LOGI(TAG, "GPIO %d: %d", GPIO_INPUT, value);
+        if (gpio_edge_capture_get_event(edge_capture, &event, portMAX_DELAY) != ESP_OK)
+            continue;
 
-        // update prev_value
-        prev_value = value;
-    }
-}
+        ESP_LOGI(TAG, "GPIO %d: %d (previous level lasted %lld us)",
+            GPIO_INPUT, event.edge, event.width_us);
 
-void app_main(void)
-{
-    // config GPIO as pulldown input
-    gpio_config_t io_conf = {
-        .pin_bit_mask = 1ULL << GPIO_INPUT,
-        .mode = GPIO_MODE_INPUT,
-        .pull_up_en = GPIO_PULLUP_DISABLE,
-        .intr_type = GPIO_INTR_DISABLE
-    };
-    gpio_config(&io_conf);
-
-    // Periodic timer
-    esp_timer_create_args_t periodic_timer_args = {
-        .callback = &periodic_timer_callback,
-        .name = "periodic"
-    };
-    esp_timer_handle_t periodic_timer;
-    esp_timer_create(&periodic_timer_args, &periodic_timer);
-    esp_timer_start_periodic(periodic_timer, PERIOD_MS * 1000);
+        if (event.dropped)
+            ESP_LOGW(TAG, "%u edges dropped", (unsigned) event.dropped);
+    }
 }
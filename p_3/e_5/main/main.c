@@ -10,7 +10,7 @@
 // include for HRT timer
 #include "esp_timer.h"
 
-#include "binary_counter_4b.h"
+#include "binary_counter_nb.h"
 
 #define BINARY_COUNTER_GPIO_BIT0 25
 #define BINARY_COUNTER_GPIO_BIT1 26
@@ -34,9 +34,9 @@ static counter_direction_t _counter_direction = COUNTER_UP;
 void binary_counter_timer_callback(void *args)
 {
     if (_counter_direction == COUNTER_UP) {
-        ESP_ERROR_CHECK(binary_counter_4b_increment(args));
+        ESP_ERROR_CHECK(binary_counter_nb_increment(args));
     } else {
-        ESP_ERROR_CHECK(binary_counter_4b_decrement(args));
+        ESP_ERROR_CHECK(binary_counter_nb_decrement(args));
     }
 }
 
@@ -58,16 +58,20 @@ void app_main(void)
     static const char *TAG = "APP_MAIN";
     
     // create binary counter
-    binary_counter_4b_handle_t binary_counter;
-    binary_counter_4b_create_args_t binary_counter_args = {
-        .bit0_gpio = BINARY_COUNTER_GPIO_BIT0,
-        .bit1_gpio = BINARY_COUNTER_GPIO_BIT1,
-        .bit2_gpio = BINARY_COUNTER_GPIO_BIT2,
-        .bit3_gpio = BINARY_COUNTER_GPIO_BIT3,
+    binary_counter_nb_handle_t binary_counter;
+    binary_counter_nb_create_args_t binary_counter_args = {
+        .name = "binary_counter_4b",
+        .num_bits = 4,
+        .bit_gpio = {
+            BINARY_COUNTER_GPIO_BIT0,
+            BINARY_COUNTER_GPIO_BIT1,
+            BINARY_COUNTER_GPIO_BIT2,
+            BINARY_COUNTER_GPIO_BIT3
+        },
         .initial_value = BINARY_COUNTER_INITIAL_VALUE
     };
     ESP_ERROR_CHECK(
-        binary_counter_4b_create(&binary_counter_args, &binary_counter)
+        binary_counter_nb_create(&binary_counter_args, &binary_counter)
     );
     ESP_LOGI(TAG, "binary counter created "
                   "with initial value %d", BINARY_COUNTER_INITIAL_VALUE);
@@ -98,7 +102,7 @@ void app_main(void)
     vTaskDelay(3000 / portTICK_PERIOD_MS);
 
     // reset binary counter
-    ESP_ERROR_CHECK(binary_counter_4b_reset(binary_counter));
+    ESP_ERROR_CHECK(binary_counter_nb_reset(binary_counter));
     ESP_LOGI(TAG, "binary counter reset");
 
     // start binary counter timer
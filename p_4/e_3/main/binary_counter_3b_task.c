@@ -1,6 +1,6 @@
 #ifdef CONFIG_BINARY_COUNTER_3B_TASK
 
-#include "binary_counter_3b.h"
+#include "binary_counter_nb.h"
 
 // include ESP errors
 #include "esp_err.h"
@@ -11,6 +11,13 @@
 // include ESP logs
 #include "esp_log.h"
 
+// include ESP attributes (IRAM_ATTR)
+#include "esp_attr.h"
+
+// include FreeRTOS tasks
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
 static const char *BC_TASK = "Binary Counter 3B Task";
 
 // include for ESP GPIO
@@ -74,16 +81,21 @@ static void _binary_counter_3b_event_handler(
 static esp_timer_handle_t _binary_counter_3b_timer = NULL;
 static uint32_t _period_ms = 1000;
 
+// Counter Lock
+// The timer callback (esp_timer task) increments the counter and the reset
+// worker resets it: both update the value and the GPIO bank under this lock.
+static portMUX_TYPE _binary_counter_3b_lock = portMUX_INITIALIZER_UNLOCKED;
+
 // Timer Callback Function
 static void _binary_counter_3b_timer_callback(void *args) {
-    binary_counter_3b_handle_t handle = (binary_counter_3b_handle_t) args;
+    binary_counter_nb_handle_t handle = (binary_counter_nb_handle_t) args;
 
-    // Increment Counter
-    binary_counter_3b_increment(handle);
-
-    // Get Counter Value
+    // Increment Counter & Get Counter Value
     uint8_t value;
-    binary_counter_3b_get_value(handle, &value);
+    portENTER_CRITICAL(&_binary_counter_3b_lock);
+    binary_counter_nb_increment(handle);
+    binary_counter_nb_get_value(handle, &value);
+    portEXIT_CRITICAL(&_binary_counter_3b_lock);
 
     // Post event
     esp_event_post(
@@ -95,21 +107,119 @@ static void _binary_counter_3b_timer_callback(void *args) {
     );
 }
 
+// Reset input debounce time (edges closer than this belong to the same press)
+#define BINARY_COUNTER_3B_RESET_DEBOUNCE_US \
+    ((int64_t) CONFIG_BINARY_COUNTER_3B_RESET_DEBOUNCE_MS * 1000)
+
+// Reset Edge Queue
+// Single producer (GPIO ISR) / single consumer (reset worker) ring of edge
+// timestamps. Each index is only written by one side, so no lock is needed.
+#define RESET_EDGE_QUEUE_LEN 16 // power of 2
+static int64_t  _reset_edge_queue[RESET_EDGE_QUEUE_LEN];
+static uint32_t _reset_edge_head    = 0; // written by ISR
+static uint32_t _reset_edge_tail    = 0; // written by worker
+static uint32_t _reset_edge_dropped = 0; // written by ISR (queue full)
+
+// Reset Worker Task
+static TaskHandle_t _reset_worker_task = NULL;
+
 // GPIO Input ISR Handler
-static void _gpio_input_isr_handler(void *args) {
-    binary_counter_3b_handle_t handle = (binary_counter_3b_handle_t) args;
+// Only timestamps the edge and wakes the reset worker: no driver calls and no
+// event posting in interrupt context.
+static void IRAM_ATTR _gpio_input_isr_handler(void *args) {
+    int64_t  timestamp = esp_timer_get_time();
+    uint32_t head      = _reset_edge_head;
+    uint32_t tail      = __atomic_load_n(&_reset_edge_tail, __ATOMIC_ACQUIRE);
+
+    // Push timestamp (drop edge if full)
+    if (head - tail < RESET_EDGE_QUEUE_LEN) {
+        _reset_edge_queue[head & (RESET_EDGE_QUEUE_LEN - 1)] = timestamp;
+        __atomic_store_n(&_reset_edge_head, head + 1, __ATOMIC_RELEASE);
+    } else {
+        _reset_edge_dropped++;
+    }
 
-    // Reset counter
-    binary_counter_3b_reset(handle);
+    // Notify worker
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(_reset_worker_task, &higher_priority_task_woken);
+    if (higher_priority_task_woken) {
+        portYIELD_FROM_ISR();
+    }
+}
 
-    // Post event
-    esp_event_post(
-        BINARY_COUNTER_3B_EVENTS,
-        BINARY_COUNTER_3B_RESET_EVENT,
-        NULL,
-        0,
-        0
-    );
+// Pop edge timestamp from Reset Edge Queue (false if empty)
+static bool _reset_edge_queue_pop(int64_t *timestamp) {
+    uint32_t tail = _reset_edge_tail;
+    uint32_t head = __atomic_load_n(&_reset_edge_head, __ATOMIC_ACQUIRE);
+
+    if (tail == head) {
+        return false;
+    }
+
+    *timestamp = _reset_edge_queue[tail & (RESET_EDGE_QUEUE_LEN - 1)];
+    __atomic_store_n(&_reset_edge_tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// Reset Input Debounce States
+typedef enum {
+    RESET_INPUT_IDLE,     // waiting for an edge
+    RESET_INPUT_SETTLING  // edge seen, waiting for input to be stable
+} reset_input_state_t;
+
+// Reset Worker Task Function
+// Every edge (re)starts the debounce window. When the window expires with no
+// new edges the input is stable, and the reset is applied only if the button
+// is still pressed, so release bounces and glitches are discarded.
+static void _reset_worker_task_function(void *pvParameter) {
+    binary_counter_nb_handle_t handle = (binary_counter_nb_handle_t) pvParameter;
+
+    reset_input_state_t state    = RESET_INPUT_IDLE;
+    int64_t             deadline = 0;
+    uint32_t            dropped  = 0;
+
+    while (1) {
+        // Wait for edges (or for the debounce window to expire)
+        TickType_t wait = portMAX_DELAY;
+        if (state == RESET_INPUT_SETTLING) {
+            int64_t left_us = deadline - esp_timer_get_time();
+            wait = (left_us > 0) ? pdMS_TO_TICKS((left_us + 999) / 1000) + 1 : 0;
+        }
+        ulTaskNotifyTake(pdTRUE, wait);
+
+        // Drain edges
+        int64_t timestamp;
+        while (_reset_edge_queue_pop(&timestamp)) {
+            state    = RESET_INPUT_SETTLING;
+            deadline = timestamp + BINARY_COUNTER_3B_RESET_DEBOUNCE_US;
+        }
+
+        if (dropped != _reset_edge_dropped) {
+            dropped = _reset_edge_dropped;
+            ESP_LOGW(BC_TASK, "Reset Edge Queue Full (%u edges dropped)", (unsigned) dropped);
+        }
+
+        // Input stable
+        if (state == RESET_INPUT_SETTLING && esp_timer_get_time() >= deadline) {
+            state = RESET_INPUT_IDLE;
+
+            if (gpio_get_level(BINARY_COUNTER_3B_GPIO_RESET)) {
+                // Reset counter
+                portENTER_CRITICAL(&_binary_counter_3b_lock);
+                binary_counter_nb_reset(handle);
+                portEXIT_CRITICAL(&_binary_counter_3b_lock);
+
+                // Post event
+                esp_event_post(
+                    BINARY_COUNTER_3B_EVENTS,
+                    BINARY_COUNTER_3B_RESET_EVENT,
+                    NULL,
+                    0,
+                    0
+                );
+            }
+        }
+    }
 }
 
 // Binary Counter 3B Task Function
@@ -119,16 +229,17 @@ void binary_counter_3b_task(void *pvParameter) {
     ESP_LOGI(BC_TASK, "Binary Counter 3B Task Running...");
 
     // Create Args
-    binary_counter_3b_create_args_t args = BINARY_COUNTER_3B_CREATE_ARGS_DEFAULT();
+    binary_counter_nb_create_args_t args = BINARY_COUNTER_NB_DEFAULT_CREATE_ARGS();
     args.name          = "binary_counter_3b";
-    args.bit0_gpio     = BINARY_COUNTER_3B_GPIO_BIT0;
-    args.bit1_gpio     = BINARY_COUNTER_3B_GPIO_BIT1;
-    args.bit2_gpio     = BINARY_COUNTER_3B_GPIO_BIT2;
+    args.num_bits      = 3;
+    args.bit_gpio[0]   = BINARY_COUNTER_3B_GPIO_BIT0;
+    args.bit_gpio[1]   = BINARY_COUNTER_3B_GPIO_BIT1;
+    args.bit_gpio[2]   = BINARY_COUNTER_3B_GPIO_BIT2;
     args.initial_value = BINARY_COUNTER_3B_INITIAL_VALUE;
 
     // Create Binary Counter 3B
-    binary_counter_3b_handle_t handle;
-    if ( (err = binary_counter_3b_create(&args, &handle)) ) {
+    binary_counter_nb_handle_t handle;
+    if ( (err = binary_counter_nb_create(&args, &handle)) ) {
         ESP_LOGE(BC_TASK, "Binary Counter 3B Create Failed: %s", esp_err_to_name(err));
         goto bc3b_task__error_at_start;
     }
@@ -164,9 +275,16 @@ void binary_counter_3b_task(void *pvParameter) {
         goto bc3b_task__error_after_timer_create;
     }
 
-    // Configure GPIO input interrupt type (when button pressed -> posedge)
-    if ( (err = gpio_set_intr_type(BINARY_COUNTER_3B_GPIO_RESET, GPIO_INTR_POSEDGE)) ) {
-        ESP_LOGE(BC_TASK, "GPIO Set Interrupt Type Failed: %s", esp_err_to_name(err));
+    // Configure GPIO input (when button pressed -> posedge)
+    gpio_config_t reset_gpio_config = {
+        .pin_bit_mask = 1ULL << BINARY_COUNTER_3B_GPIO_RESET,
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_POSEDGE
+    };
+    if ( (err = gpio_config(&reset_gpio_config)) ) {
+        ESP_LOGE(BC_TASK, "GPIO Input Config Failed: %s", esp_err_to_name(err));
         goto bc3b_task__error_after_isr_service_install;
     }
 
@@ -179,14 +297,27 @@ void binary_counter_3b_task(void *pvParameter) {
         goto bc3b_task__error_after_isr_service_install;
     }
 
+    // Create Reset Worker Task (above this task, so resets are applied promptly)
+    if (xTaskCreate(
+        _reset_worker_task_function,
+        "bc3b_reset_worker",
+        2048,
+        handle,
+        uxTaskPriorityGet(NULL) + 1,
+        &_reset_worker_task
+    ) != pdPASS) {
+        ESP_LOGE(BC_TASK, "Reset Worker Task Create Failed");
+        goto bc3b_task__error_after_timer_start_periodic;
+    }
+
     // Add GPIO input ISR handler
     if ( (err = gpio_isr_handler_add(
         BINARY_COUNTER_3B_GPIO_RESET,
         _gpio_input_isr_handler,
-        handle
+        NULL
     )) ) {
         ESP_LOGE(BC_TASK, "GPIO ISR Handler Add Failed: %s", esp_err_to_name(err));
-        goto bc3b_task__error_after_timer_start_periodic;
+        goto bc3b_task__error_after_reset_worker_create;
     }
 
     // Wait for delete notification
@@ -201,6 +332,10 @@ void binary_counter_3b_task(void *pvParameter) {
     if ( (err = gpio_isr_handler_remove(BINARY_COUNTER_3B_GPIO_RESET)) ) {
         ESP_LOGW(BC_TASK, "GPIO ISR Handler Remove Failed: %s", esp_err_to_name(err));
     }
+bc3b_task__error_after_reset_worker_create:
+    // Delete Reset Worker Task
+    vTaskDelete(_reset_worker_task);
+    _reset_worker_task = NULL;
 bc3b_task__error_after_timer_start_periodic:
     // Stop Timer
     if ( (err = esp_timer_stop(_binary_counter_3b_timer)) ) {
@@ -225,7 +360,7 @@ bc3b_task__error_after_register_event_handler:
     }
 bc3b_task__error_after_counter_create:
     // Delete Binary Counter 3B
-    binary_counter_3b_delete(handle);
+    binary_counter_nb_delete(handle);
 bc3b_task__error_at_start:
     vTaskDelete(NULL);
 }
@@ -12,10 +12,19 @@
    CONDITIONS OF ANY KIND, either express or implied.
 */
 #include <stdio.h>
+#include <string.h>
 #include "argtable3/argtable3.h"
 #include "driver/i2c.h"
 #include "esp_console.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "si7021_i2c.h"
+#include "si7021_i2c_console.h"
+#if CONFIG_I2C_BUS_SIM
+#include "i2c_bus_sim.h"
+#include "si7021_sim.h"
+#endif
 
 #define I2C_MASTER_TX_BUF_DISABLE 0 /*!< I2C master doesn't need buffer */
 #define I2C_MASTER_RX_BUF_DISABLE 0 /*!< I2C master doesn't need buffer */
@@ -26,6 +35,20 @@
 #define ACK_VAL 0x0                 /*!< I2C ack value */
 #define NACK_VAL 0x1                /*!< I2C nack value */
 
+#define I2CDETECT_TIMEOUT_MS 10     /*!< Per address; only hit if the bus is stuck */
+#define I2CDETECT_FAST_FREQ 400000  /*!< i2cdetect --fast clock (Hz) */
+#define I2CDUMP_TIMEOUT_MS 50       /*!< Per transaction */
+#define I2CDUMP_LEN 128             /*!< Registers 0x00 to 0x7f */
+#define I2CBENCH_TIMEOUT_MS 50      /*!< Per transaction */
+#define I2CBENCH_MAX_FREQS 8        /*!< Clock speeds per run */
+#define I2CBENCH_MAX_COUNT 10000    /*!< Transactions per clock speed */
+#define I2CBENCH_MAX_LEN 256        /*!< Bytes per transaction */
+#define I2CBATCH_TIMEOUT_MS 50      /*!< Per transaction */
+#define I2CBATCH_MAX_OPS 512        /*!< Statements per script */
+#define I2CBATCH_MAX_DATA 4096      /*!< Bytes written & read by a script */
+#define I2CBATCH_MAX_FILE 16384     /*!< Script file size */
+#define SI7021READ_MAX_COUNT 1000   /*!< Measurements per run */
+
 static const char *TAG = "cmd_i2ctools";
 
 #if CONFIG_IDF_TARGET_ESP32S3 || CONFIG_IDF_TARGET_ESP32H2
@@ -41,6 +64,9 @@ static gpio_num_t i2c_gpio_scl = 19;
 
 static uint32_t i2c_frequency = 100000;
 static i2c_port_t i2c_port = I2C_NUM_0;
+static bool i2c_driver_installed = false;
+/* While attached, the Si7021 bus owns the port and its driver */
+static si7021_i2c_handle_t si7021_i2c = NULL;
 
 static esp_err_t i2c_get_port(int port, i2c_port_t *i2c_port)
 {
@@ -52,7 +78,7 @@ static esp_err_t i2c_get_port(int port, i2c_port_t *i2c_port)
     return ESP_OK;
 }
 
-static esp_err_t i2c_master_driver_initialize(void)
+static esp_err_t i2c_master_driver_config(uint32_t clk_speed)
 {
     i2c_config_t conf = {
         .mode = I2C_MODE_MASTER,
@@ -60,12 +86,42 @@ static esp_err_t i2c_master_driver_initialize(void)
         .sda_pullup_en = GPIO_PULLUP_ENABLE,
         .scl_io_num = i2c_gpio_scl,
         .scl_pullup_en = GPIO_PULLUP_ENABLE,
-        .master.clk_speed = i2c_frequency,
+        .master.clk_speed = clk_speed,
         // .clk_flags = 0,          /*!< Optional, you can use I2C_SCLK_SRC_FLAG_* flags to choose i2c source clock here. */
     };
     return i2c_param_config(i2c_port, &conf);
 }
 
+/* The driver stays installed across commands; i2cconfig uninstalls it so the
+ * next command installs it again with the new settings. */
+static esp_err_t i2c_master_driver_initialize(void)
+{
+    if (i2c_driver_installed || si7021_i2c) {
+        return ESP_OK;
+    }
+    esp_err_t ret = i2c_driver_install(i2c_port, I2C_MODE_MASTER, I2C_MASTER_RX_BUF_DISABLE, I2C_MASTER_TX_BUF_DISABLE, 0);
+    if (ret == ESP_OK) {
+        ret = i2c_master_driver_config(i2c_frequency);
+        if (ret != ESP_OK) {
+            i2c_driver_delete(i2c_port);
+        }
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Could not initialize I2C driver: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    i2c_driver_installed = true;
+    return ESP_OK;
+}
+
+static void i2c_master_driver_uninstall(void)
+{
+    if (i2c_driver_installed) {
+        i2c_driver_delete(i2c_port);
+        i2c_driver_installed = false;
+    }
+}
+
 static struct {
     struct arg_int *port;
     struct arg_int *freq;
@@ -82,6 +138,14 @@ static int do_i2cconfig_cmd(int argc, char **argv)
         return 0;
     }
 
+    if (si7021_i2c) {
+        printf("Run 'si7021detach' first: the Si7021 bus owns the port\r\n");
+        return 1;
+    }
+
+    /* Applied when the driver is next installed */
+    i2c_master_driver_uninstall();
+
     /* Check "--port" option */
     if (i2cconfig_args.port->count) {
         if (i2c_get_port(i2cconfig_args.port->ival[0], &i2c_port) != ESP_OK) {
@@ -116,26 +180,63 @@ static void register_i2cconfig(void)
     ESP_ERROR_CHECK(esp_console_cmd_register(&i2cconfig_cmd));
 }
 
+static struct {
+    struct arg_int *timeout;
+    struct arg_lit *fast;
+    struct arg_end *end;
+} i2cdetect_args;
+
 static int do_i2cdetect_cmd(int argc, char **argv)
 {
-    i2c_driver_install(i2c_port, I2C_MODE_MASTER, I2C_MASTER_RX_BUF_DISABLE, I2C_MASTER_TX_BUF_DISABLE, 0);
-    i2c_master_driver_initialize();
-    uint8_t address;
+    int nerrors = arg_parse(argc, argv, (void **)&i2cdetect_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, i2cdetect_args.end, argv[0]);
+        return 0;
+    }
+
+    /* Check timeout: "-t" option */
+    int timeout_ms = I2CDETECT_TIMEOUT_MS;
+    if (i2cdetect_args.timeout->count) {
+        timeout_ms = i2cdetect_args.timeout->ival[0];
+    }
+    TickType_t timeout = pdMS_TO_TICKS(timeout_ms);
+    if (timeout == 0) {
+        timeout = 1;
+    }
+    /* Check fast clock: "-f" option */
+    bool fast = i2cdetect_args.fast->count && i2c_frequency < I2CDETECT_FAST_FREQ;
+
+    if (i2c_master_driver_initialize() != ESP_OK) {
+        return 1;
+    }
+    if (fast) {
+        i2c_master_driver_config(I2CDETECT_FAST_FREQ);
+    }
+
+    /* Probe every address first, print afterwards */
+    esp_err_t result[128];
+    int64_t start = esp_timer_get_time();
+    for (int address = 0; address < 128; address++) {
+        i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+        i2c_master_start(cmd);
+        i2c_master_write_byte(cmd, (address << 1) | WRITE_BIT, ACK_CHECK_EN);
+        i2c_master_stop(cmd);
+        result[address] = i2c_master_cmd_begin(i2c_port, cmd, timeout);
+        i2c_cmd_link_delete(cmd);
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+
+    if (fast) {
+        i2c_master_driver_config(i2c_frequency);
+    }
+
     printf("     0  1  2  3  4  5  6  7  8  9  a  b  c  d  e  f\r\n");
     for (int i = 0; i < 128; i += 16) {
         printf("%02x: ", i);
         for (int j = 0; j < 16; j++) {
-            fflush(stdout);
-            address = i + j;
-            i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-            i2c_master_start(cmd);
-            i2c_master_write_byte(cmd, (address << 1) | WRITE_BIT, ACK_CHECK_EN);
-            i2c_master_stop(cmd);
-            esp_err_t ret = i2c_master_cmd_begin(i2c_port, cmd, 50 / portTICK_PERIOD_MS);
-            i2c_cmd_link_delete(cmd);
-            if (ret == ESP_OK) {
-                printf("%02x ", address);
-            } else if (ret == ESP_ERR_TIMEOUT) {
+            if (result[i + j] == ESP_OK) {
+                printf("%02x ", i + j);
+            } else if (result[i + j] == ESP_ERR_TIMEOUT) {
                 printf("UU ");
             } else {
                 printf("-- ");
@@ -143,19 +244,22 @@ static int do_i2cdetect_cmd(int argc, char **argv)
         }
         printf("\r\n");
     }
-
-    i2c_driver_delete(i2c_port);
+    printf("Scanned in %lld us (%u Hz)\r\n", elapsed,
+           (unsigned)(fast ? I2CDETECT_FAST_FREQ : i2c_frequency));
     return 0;
 }
 
 static void register_i2cdetect(void)
 {
+    i2cdetect_args.timeout = arg_int0("t", "timeout", "<ms>", "Set the timeout of each probe (default 10 ms)");
+    i2cdetect_args.fast = arg_lit0("f", "fast", "Scan at 400 kHz, then restore the bus frequency");
+    i2cdetect_args.end = arg_end(1);
     const esp_console_cmd_t i2cdetect_cmd = {
         .command = "i2cdetect",
         .help = "Scan I2C bus for devices",
         .hint = NULL,
         .func = &do_i2cdetect_cmd,
-        .argtable = NULL
+        .argtable = &i2cdetect_args
     };
     ESP_ERROR_CHECK(esp_console_cmd_register(&i2cdetect_cmd));
 }
@@ -189,8 +293,10 @@ static int do_i2cget_cmd(int argc, char **argv)
     }
     uint8_t *data = malloc(len);
 
-    i2c_driver_install(i2c_port, I2C_MODE_MASTER, I2C_MASTER_RX_BUF_DISABLE, I2C_MASTER_TX_BUF_DISABLE, 0);
-    i2c_master_driver_initialize();
+    if (i2c_master_driver_initialize() != ESP_OK) {
+        free(data);
+        return 1;
+    }
     i2c_cmd_handle_t cmd = i2c_cmd_link_create();
     i2c_master_start(cmd);
     if (data_addr != -1) {
@@ -222,7 +328,6 @@ static int do_i2cget_cmd(int argc, char **argv)
         ESP_LOGW(TAG, "Read failed");
     }
     free(data);
-    i2c_driver_delete(i2c_port);
     return 0;
 }
 
@@ -267,8 +372,9 @@ static int do_i2cset_cmd(int argc, char **argv)
     /* Check data: "-d" option */
     int len = i2cset_args.data->count;
 
-    i2c_driver_install(i2c_port, I2C_MODE_MASTER, I2C_MASTER_RX_BUF_DISABLE, I2C_MASTER_TX_BUF_DISABLE, 0);
-    i2c_master_driver_initialize();
+    if (i2c_master_driver_initialize() != ESP_OK) {
+        return 1;
+    }
     i2c_cmd_handle_t cmd = i2c_cmd_link_create();
     i2c_master_start(cmd);
     i2c_master_write_byte(cmd, chip_addr << 1 | WRITE_BIT, ACK_CHECK_EN);
@@ -288,7 +394,6 @@ static int do_i2cset_cmd(int argc, char **argv)
     } else {
         ESP_LOGW(TAG, "Write Failed");
     }
-    i2c_driver_delete(i2c_port);
     return 0;
 }
 
@@ -311,9 +416,26 @@ static void register_i2cset(void)
 static struct {
     struct arg_int *chip_address;
     struct arg_int *size;
+    struct arg_lit *block;
     struct arg_end *end;
 } i2cdump_args;
 
+/* Read <len> registers starting at <data_addr> in a single transaction */
+static esp_err_t i2cdump_read(int chip_addr, uint8_t data_addr, uint8_t *data, size_t len)
+{
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, chip_addr << 1 | WRITE_BIT, ACK_CHECK_EN);
+    i2c_master_write_byte(cmd, data_addr, ACK_CHECK_EN);
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, chip_addr << 1 | READ_BIT, ACK_CHECK_EN);
+    i2c_master_read(cmd, data, len, I2C_MASTER_LAST_NACK);
+    i2c_master_stop(cmd);
+    esp_err_t ret = i2c_master_cmd_begin(i2c_port, cmd, I2CDUMP_TIMEOUT_MS / portTICK_PERIOD_MS);
+    i2c_cmd_link_delete(cmd);
+    return ret;
+}
+
 static int do_i2cdump_cmd(int argc, char **argv)
 {
     int nerrors = arg_parse(argc, argv, (void **)&i2cdump_args);
@@ -324,7 +446,7 @@ static int do_i2cdump_cmd(int argc, char **argv)
 
     /* Check chip address: "-c" option */
     int chip_addr = i2cdump_args.chip_address->ival[0];
-    /* Check read size: "-s" option */
+    /* Check read size: "-s" option (block read: "-b" option) */
     int size = 1;
     if (i2cdump_args.size->count) {
         size = i2cdump_args.size->ival[0];
@@ -333,59 +455,54 @@ static int do_i2cdump_cmd(int argc, char **argv)
         ESP_LOGE(TAG, "Wrong read size. Only support 1,2,4");
         return 1;
     }
-    i2c_driver_install(i2c_port, I2C_MODE_MASTER, I2C_MASTER_RX_BUF_DISABLE, I2C_MASTER_TX_BUF_DISABLE, 0);
-    i2c_master_driver_initialize();
-    uint8_t data_addr;
-    uint8_t data[4];
-    int32_t block[16];
+    if (i2cdump_args.block->count) {
+        size = I2CDUMP_LEN;
+    }
+    if (i2c_master_driver_initialize() != ESP_OK) {
+        return 1;
+    }
+
+    /* Read every register first, print afterwards */
+    uint8_t data[I2CDUMP_LEN];
+    bool valid[I2CDUMP_LEN];
+    int transactions = 0;
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < I2CDUMP_LEN; i += size) {
+        esp_err_t ret = i2cdump_read(chip_addr, i, &data[i], size);
+        for (int k = 0; k < size; k++) {
+            valid[i + k] = ret == ESP_OK;
+        }
+        transactions++;
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+
     printf("     0  1  2  3  4  5  6  7  8  9  a  b  c  d  e  f"
            "    0123456789abcdef\r\n");
-    for (int i = 0; i < 128; i += 16) {
+    for (int i = 0; i < I2CDUMP_LEN; i += 16) {
         printf("%02x: ", i);
-        for (int j = 0; j < 16; j += size) {
-            fflush(stdout);
-            data_addr = i + j;
-            i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-            i2c_master_start(cmd);
-            i2c_master_write_byte(cmd, chip_addr << 1 | WRITE_BIT, ACK_CHECK_EN);
-            i2c_master_write_byte(cmd, data_addr, ACK_CHECK_EN);
-            i2c_master_start(cmd);
-            i2c_master_write_byte(cmd, chip_addr << 1 | READ_BIT, ACK_CHECK_EN);
-            if (size > 1) {
-                i2c_master_read(cmd, data, size - 1, ACK_VAL);
-            }
-            i2c_master_read_byte(cmd, data + size - 1, NACK_VAL);
-            i2c_master_stop(cmd);
-            esp_err_t ret = i2c_master_cmd_begin(i2c_port, cmd, 50 / portTICK_PERIOD_MS);
-            i2c_cmd_link_delete(cmd);
-            if (ret == ESP_OK) {
-                for (int k = 0; k < size; k++) {
-                    printf("%02x ", data[k]);
-                    block[j + k] = data[k];
-                }
+        for (int j = 0; j < 16; j++) {
+            if (valid[i + j]) {
+                printf("%02x ", data[i + j]);
             } else {
-                for (int k = 0; k < size; k++) {
-                    printf("XX ");
-                    block[j + k] = -1;
-                }
+                printf("XX ");
             }
         }
         printf("   ");
-        for (int k = 0; k < 16; k++) {
-            if (block[k] < 0) {
+        for (int j = 0; j < 16; j++) {
+            uint8_t c = data[i + j];
+            if (!valid[i + j]) {
                 printf("X");
-            }
-            if ((block[k] & 0xff) == 0x00 || (block[k] & 0xff) == 0xff) {
+            } else if (c == 0x00 || c == 0xff) {
                 printf(".");
-            } else if ((block[k] & 0xff) < 32 || (block[k] & 0xff) >= 127) {
+            } else if (c < 32 || c >= 127) {
                 printf("?");
             } else {
-                printf("%c", (char)(block[k] & 0xff));
+                printf("%c", (char)c);
             }
         }
         printf("\r\n");
     }
-    i2c_driver_delete(i2c_port);
+    printf("Read in %lld us (%d transactions)\r\n", elapsed, transactions);
     return 0;
 }
 
@@ -393,6 +510,7 @@ static void register_i2cdump(void)
 {
     i2cdump_args.chip_address = arg_int1("c", "chip", "<chip_addr>", "Specify the address of the chip on that bus");
     i2cdump_args.size = arg_int0("s", "size", "<size>", "Specify the size of each read");
+    i2cdump_args.block = arg_lit0("b", "block", "Read all registers at once (chip must auto-increment the register address)");
     i2cdump_args.end = arg_end(1);
     const esp_console_cmd_t i2cdump_cmd = {
         .command = "i2cdump",
@@ -404,6 +522,686 @@ static void register_i2cdump(void)
     ESP_ERROR_CHECK(esp_console_cmd_register(&i2cdump_cmd));
 }
 
+static struct {
+    struct arg_int *chip_address;
+    struct arg_int *register_address;
+    struct arg_int *data_length;
+    struct arg_int *count;
+    struct arg_int *freq;
+    struct arg_end *end;
+} i2cbench_args;
+
+#if CONFIG_I2C_BUS_SIM
+/* Loopback slave standing in for the chip on the simulated bus: a register
+ * file whose address is set by the first byte written and auto-increments. */
+static struct {
+    int address;
+    uint8_t pointer;
+    uint8_t regs[256];
+} i2cbench_sim = { .address = -1 };
+
+static esp_err_t i2cbench_sim_write(void *ctx, uint8_t const *data, size_t len)
+{
+    i2cbench_sim.pointer = data[0];
+    for (size_t i = 1; i < len; i++) {
+        i2cbench_sim.regs[i2cbench_sim.pointer++] = data[i];
+    }
+    return ESP_OK;
+}
+
+static esp_err_t i2cbench_sim_read(void *ctx, uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        data[i] = i2cbench_sim.regs[i2cbench_sim.pointer++];
+    }
+    return ESP_OK;
+}
+
+static esp_err_t i2cbench_sim_attach(int chip_addr)
+{
+    if (i2cbench_sim.address == chip_addr) {
+        return ESP_OK;
+    }
+    if (i2cbench_sim.address >= 0) {
+        i2c_bus_sim_detach(i2c_port, i2cbench_sim.address);
+        i2cbench_sim.address = -1;
+    }
+    i2c_bus_sim_target_t target = {
+        .write = &i2cbench_sim_write,
+        .read = &i2cbench_sim_read,
+        .ctx = NULL,
+    };
+    esp_err_t ret = i2c_bus_sim_attach(i2c_port, chip_addr, &target);
+    if (ret == ESP_OK) {
+        i2cbench_sim.address = chip_addr;
+    }
+    return ret;
+}
+#endif
+
+/* One benchmark transaction: [write <data_addr>, repeated start] read <len> */
+static esp_err_t i2cbench_transfer(int chip_addr, int data_addr, uint8_t *data, size_t len)
+{
+#if CONFIG_I2C_BUS_SIM
+    uint8_t reg = data_addr;
+    return i2c_bus_sim_execute(i2c_port, chip_addr, &reg, data_addr >= 0 ? 1 : 0,
+                               data, len, I2CBENCH_TIMEOUT_MS / portTICK_PERIOD_MS);
+#else
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    i2c_master_start(cmd);
+    if (data_addr >= 0) {
+        i2c_master_write_byte(cmd, chip_addr << 1 | WRITE_BIT, ACK_CHECK_EN);
+        i2c_master_write_byte(cmd, data_addr, ACK_CHECK_EN);
+        i2c_master_start(cmd);
+    }
+    i2c_master_write_byte(cmd, chip_addr << 1 | READ_BIT, ACK_CHECK_EN);
+    i2c_master_read(cmd, data, len, I2C_MASTER_LAST_NACK);
+    i2c_master_stop(cmd);
+    esp_err_t ret = i2c_master_cmd_begin(i2c_port, cmd, I2CBENCH_TIMEOUT_MS / portTICK_PERIOD_MS);
+    i2c_cmd_link_delete(cmd);
+    return ret;
+#endif
+}
+
+static int i2cbench_compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int do_i2cbench_cmd(int argc, char **argv)
+{
+    int nerrors = arg_parse(argc, argv, (void **)&i2cbench_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, i2cbench_args.end, argv[0]);
+        return 0;
+    }
+
+    /* Check chip address: "-c" option */
+    int chip_addr = i2cbench_args.chip_address->ival[0];
+    /* Check register address: "-r" option */
+    int data_addr = -1;
+    if (i2cbench_args.register_address->count) {
+        data_addr = i2cbench_args.register_address->ival[0];
+    }
+    /* Check data length: "-l" option */
+    int len = 2;
+    if (i2cbench_args.data_length->count) {
+        len = i2cbench_args.data_length->ival[0];
+    }
+    /* Check transactions: "-n" option */
+    int count = 100;
+    if (i2cbench_args.count->count) {
+        count = i2cbench_args.count->ival[0];
+    }
+    if (len < 1 || len > I2CBENCH_MAX_LEN || count < 1 || count > I2CBENCH_MAX_COUNT) {
+        ESP_LOGE(TAG, "Length must be 1-%d and count 1-%d", I2CBENCH_MAX_LEN, I2CBENCH_MAX_COUNT);
+        return 1;
+    }
+    /* Check clock speeds: "-f" option (default: standard, fast, fast plus) */
+    int freqs[I2CBENCH_MAX_FREQS] = { 100000, 400000, 1000000 };
+    int nfreqs = 3;
+    if (i2cbench_args.freq->count) {
+        nfreqs = i2cbench_args.freq->count;
+        for (int i = 0; i < nfreqs; i++) {
+            freqs[i] = i2cbench_args.freq->ival[i];
+        }
+    }
+
+#if CONFIG_I2C_BUS_SIM
+    if (i2cbench_sim_attach(chip_addr) != ESP_OK) {
+        return 1;
+    }
+    printf("Simulated bus: latencies are software only, clock speeds are labels\r\n");
+#else
+    if (i2c_master_driver_initialize() != ESP_OK) {
+        return 1;
+    }
+#endif
+
+    uint8_t *data = malloc(len);
+    uint32_t *latency = malloc(count * sizeof(uint32_t));
+    if (!data || !latency) {
+        ESP_LOGE(TAG, "Could not allocate memory");
+        free(data);
+        free(latency);
+        return 1;
+    }
+
+    printf("      Hz    txn/s      B/s  p50 us  p99 us   nack  timeout  other\r\n");
+    for (int f = 0; f < nfreqs; f++) {
+#if !CONFIG_I2C_BUS_SIM
+        if (i2c_master_driver_config(freqs[f]) != ESP_OK) {
+            printf("%8d  not supported\r\n", freqs[f]);
+            continue;
+        }
+#endif
+        int ok = 0, nacks = 0, timeouts = 0, others = 0;
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < count; i++) {
+            int64_t t0 = esp_timer_get_time();
+            esp_err_t ret = i2cbench_transfer(chip_addr, data_addr, data, len);
+            int64_t t1 = esp_timer_get_time();
+            if (ret == ESP_OK) {
+                latency[ok++] = (uint32_t)(t1 - t0);
+            } else if (ret == ESP_FAIL) {
+                nacks++;
+            } else if (ret == ESP_ERR_TIMEOUT) {
+                timeouts++;
+            } else {
+                others++;
+            }
+        }
+        int64_t elapsed = esp_timer_get_time() - start;
+        if (elapsed < 1) {
+            elapsed = 1;
+        }
+
+        /* Percentiles of the successful transactions */
+        uint32_t p50 = 0, p99 = 0;
+        if (ok) {
+            qsort(latency, ok, sizeof(uint32_t), &i2cbench_compare);
+            p50 = latency[(ok - 1) * 50 / 100];
+            p99 = latency[(ok - 1) * 99 / 100];
+        }
+        printf("%8d %8lld %8lld %7u %7u %6d %8d %6d\r\n", freqs[f],
+               count * 1000000LL / elapsed, (long long)ok * len * 1000000LL / elapsed,
+               (unsigned)p50, (unsigned)p99, nacks, timeouts, others);
+    }
+
+#if !CONFIG_I2C_BUS_SIM
+    i2c_master_driver_config(i2c_frequency);
+#endif
+    free(data);
+    free(latency);
+    return 0;
+}
+
+static void register_i2cbench(void)
+{
+    i2cbench_args.chip_address = arg_int1("c", "chip", "<chip_addr>", "Specify the address of the chip on that bus");
+    i2cbench_args.register_address = arg_int0("r", "register", "<register_addr>", "Write this register address before each read");
+    i2cbench_args.data_length = arg_int0("l", "length", "<length>", "Specify the bytes read per transaction (default 2)");
+    i2cbench_args.count = arg_int0("n", "count", "<count>", "Specify the transactions per clock speed (default 100)");
+    i2cbench_args.freq = arg_intn("f", "freq", "<Hz>", 0, I2CBENCH_MAX_FREQS, "Clock speeds to test (default 100000 400000 1000000)");
+    i2cbench_args.end = arg_end(2);
+    const esp_console_cmd_t i2cbench_cmd = {
+        .command = "i2cbench",
+        .help = "Measure I2C throughput, latency and errors at several clock speeds",
+        .hint = NULL,
+        .func = &do_i2cbench_cmd,
+        .argtable = &i2cbench_args
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&i2cbench_cmd));
+}
+
+/* Batch mode: a script of i2cset, i2cget and delay statements, separated by
+ * newlines or ';' ('#' starts a comment), is compiled into a list of
+ * transactions first and then run back-to-back; results are printed at the
+ * end. Statements take the options of the console commands:
+ *   i2cset -c <chip> [-r <register>] <data>...
+ *   i2cget -c <chip> [-r <register>] [-l <length>]
+ *   delay <ms>
+ */
+typedef enum {
+    I2CBATCH_WRITE,
+    I2CBATCH_READ,
+    I2CBATCH_DELAY,
+} i2cbatch_kind_t;
+
+typedef struct {
+    i2cbatch_kind_t kind;
+    uint8_t chip;
+    int16_t reg;        /*!< -1: no register address */
+    uint16_t offset;    /*!< Write data or read result in the data buffer */
+    uint16_t len;       /*!< Bytes (delay: ms) */
+    uint16_t statement; /*!< For error messages */
+} i2cbatch_op_t;
+
+typedef struct {
+    i2cbatch_op_t ops[I2CBATCH_MAX_OPS];
+    uint8_t data[I2CBATCH_MAX_DATA];
+    int nops;
+    int ndata;
+} i2cbatch_t;
+
+static bool i2cbatch_parse_int(const char *token, long min, long max, long *out)
+{
+    char *end = NULL;
+    if (!token) {
+        return false;
+    }
+    long value = strtol(token, &end, 0);
+    if (end == token || *end != '\0' || value < min || value > max) {
+        return false;
+    }
+    *out = value;
+    return true;
+}
+
+/* Compile one statement (modified in place) into <batch> */
+static esp_err_t i2cbatch_compile_statement(i2cbatch_t *batch, char *statement, int number)
+{
+    char *save = NULL;
+    char *name = strtok_r(statement, " \t\r", &save);
+    if (!name) {
+        return ESP_OK; /* Empty or comment only */
+    }
+    if (batch->nops == I2CBATCH_MAX_OPS) {
+        ESP_LOGE(TAG, "Statement %d: more than %d statements", number, I2CBATCH_MAX_OPS);
+        return ESP_ERR_NO_MEM;
+    }
+    i2cbatch_op_t *op = &batch->ops[batch->nops];
+    op->chip = 0;
+    op->reg = -1;
+    op->offset = batch->ndata;
+    op->len = 0;
+    op->statement = number;
+
+    long value;
+    char *token;
+    if (strcmp(name, "delay") == 0) {
+        if (!i2cbatch_parse_int(strtok_r(NULL, " \t\r", &save), 0, 60000, &value)) {
+            ESP_LOGE(TAG, "Statement %d: delay needs <ms> (0-60000)", number);
+            return ESP_ERR_INVALID_ARG;
+        }
+        op->kind = I2CBATCH_DELAY;
+        op->len = value;
+        batch->nops++;
+        return ESP_OK;
+    }
+    if (strcmp(name, "i2cset") == 0) {
+        op->kind = I2CBATCH_WRITE;
+    } else if (strcmp(name, "i2cget") == 0) {
+        op->kind = I2CBATCH_READ;
+        op->len = 1;
+    } else {
+        ESP_LOGE(TAG, "Statement %d: unknown command '%s'", number, name);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    bool chip = false;
+    while ((token = strtok_r(NULL, " \t\r", &save))) {
+        if (strcmp(token, "-c") == 0 || strcmp(token, "--chip") == 0) {
+            chip = i2cbatch_parse_int(strtok_r(NULL, " \t\r", &save), 0, 0x7f, &value);
+            if (!chip) {
+                break;
+            }
+            op->chip = value;
+        } else if (strcmp(token, "-r") == 0 || strcmp(token, "--register") == 0) {
+            if (!i2cbatch_parse_int(strtok_r(NULL, " \t\r", &save), 0, 0xff, &value)) {
+                ESP_LOGE(TAG, "Statement %d: bad register address", number);
+                return ESP_ERR_INVALID_ARG;
+            }
+            op->reg = value;
+        } else if (op->kind == I2CBATCH_READ && (strcmp(token, "-l") == 0 || strcmp(token, "--length") == 0)) {
+            if (!i2cbatch_parse_int(strtok_r(NULL, " \t\r", &save), 1, 256, &value)) {
+                ESP_LOGE(TAG, "Statement %d: bad length (1-256)", number);
+                return ESP_ERR_INVALID_ARG;
+            }
+            op->len = value;
+        } else if (op->kind == I2CBATCH_WRITE && i2cbatch_parse_int(token, 0, 0xff, &value)) {
+            if (batch->ndata == I2CBATCH_MAX_DATA) {
+                ESP_LOGE(TAG, "Statement %d: more than %d data bytes", number, I2CBATCH_MAX_DATA);
+                return ESP_ERR_NO_MEM;
+            }
+            batch->data[batch->ndata++] = value;
+            op->len++;
+        } else {
+            ESP_LOGE(TAG, "Statement %d: unexpected '%s'", number, token);
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    if (!chip) {
+        ESP_LOGE(TAG, "Statement %d: needs a valid -c <chip_addr>", number);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (op->kind == I2CBATCH_WRITE && op->reg < 0 && op->len == 0) {
+        ESP_LOGE(TAG, "Statement %d: nothing to write", number);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (op->kind == I2CBATCH_READ) {
+        if (batch->ndata + op->len > I2CBATCH_MAX_DATA) {
+            ESP_LOGE(TAG, "Statement %d: more than %d data bytes", number, I2CBATCH_MAX_DATA);
+            return ESP_ERR_NO_MEM;
+        }
+        batch->ndata += op->len;
+    }
+    batch->nops++;
+    return ESP_OK;
+}
+
+/* Compile <script> (modified in place) into <batch> */
+static esp_err_t i2cbatch_compile(i2cbatch_t *batch, char *script)
+{
+    batch->nops = 0;
+    batch->ndata = 0;
+    int number = 0;
+    char *statement = script;
+    while (statement) {
+        char *next = strpbrk(statement, ";\n");
+        if (next) {
+            *next++ = '\0';
+        }
+        char *comment = strchr(statement, '#');
+        if (comment) {
+            *comment = '\0';
+        }
+        esp_err_t ret = i2cbatch_compile_statement(batch, statement, ++number);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        statement = next;
+    }
+    return ESP_OK;
+}
+
+/* Run one transaction, with a command link on the stack */
+static esp_err_t i2cbatch_run_op(i2cbatch_t *batch, const i2cbatch_op_t *op)
+{
+    uint8_t buffer[I2C_LINK_RECOMMENDED_SIZE(2)] = { 0 }; // Write & read
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(buffer, sizeof(buffer));
+    if (!cmd) {
+        return ESP_ERR_NO_MEM;
+    }
+    i2c_master_start(cmd);
+    if (op->kind == I2CBATCH_WRITE || op->reg >= 0) {
+        i2c_master_write_byte(cmd, op->chip << 1 | WRITE_BIT, ACK_CHECK_EN);
+        if (op->reg >= 0) {
+            i2c_master_write_byte(cmd, op->reg, ACK_CHECK_EN);
+        }
+    }
+    if (op->kind == I2CBATCH_WRITE) {
+        if (op->len) {
+            i2c_master_write(cmd, &batch->data[op->offset], op->len, ACK_CHECK_EN);
+        }
+    } else {
+        if (op->reg >= 0) {
+            i2c_master_start(cmd);
+        }
+        i2c_master_write_byte(cmd, op->chip << 1 | READ_BIT, ACK_CHECK_EN);
+        i2c_master_read(cmd, &batch->data[op->offset], op->len, I2C_MASTER_LAST_NACK);
+    }
+    i2c_master_stop(cmd);
+    esp_err_t ret = i2c_master_cmd_begin(i2c_port, cmd, I2CBATCH_TIMEOUT_MS / portTICK_PERIOD_MS);
+    i2c_cmd_link_delete_static(cmd);
+    return ret;
+}
+
+/* Read a script file (NULL if it cannot be read) */
+static char *i2cbatch_read_file(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        ESP_LOGE(TAG, "Could not open %s", path);
+        return NULL;
+    }
+    char *script = malloc(I2CBATCH_MAX_FILE + 1);
+    size_t len = script ? fread(script, 1, I2CBATCH_MAX_FILE + 1, f) : 0;
+    fclose(f);
+    if (!script || len > I2CBATCH_MAX_FILE) {
+        ESP_LOGE(TAG, "Script must be at most %d bytes", I2CBATCH_MAX_FILE);
+        free(script);
+        return NULL;
+    }
+    script[len] = '\0';
+    return script;
+}
+
+static struct {
+    struct arg_str *file;
+    struct arg_str *script;
+    struct arg_end *end;
+} i2cbatch_args;
+
+static int do_i2cbatch_cmd(int argc, char **argv)
+{
+    int nerrors = arg_parse(argc, argv, (void **)&i2cbatch_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, i2cbatch_args.end, argv[0]);
+        return 0;
+    }
+
+    /* Check script: "-f" option or inline */
+    char *script = NULL;
+    if (i2cbatch_args.file->count) {
+        script = i2cbatch_read_file(i2cbatch_args.file->sval[0]);
+    } else if (i2cbatch_args.script->count) {
+        script = strdup(i2cbatch_args.script->sval[0]);
+    } else {
+        ESP_LOGE(TAG, "Give a script, inline or with -f <path>");
+        return 1;
+    }
+    i2cbatch_t *batch = malloc(sizeof(i2cbatch_t));
+    if (!script || !batch) {
+        free(script);
+        free(batch);
+        return 1;
+    }
+
+    /* Compile everything before touching the bus */
+    esp_err_t ret = i2cbatch_compile(batch, script);
+    free(script);
+    if (ret == ESP_OK) {
+        ret = i2c_master_driver_initialize();
+    }
+    if (ret != ESP_OK) {
+        free(batch);
+        return 1;
+    }
+
+    /* Run back-to-back, stopping at the first error */
+    int done = 0;
+    int64_t start = esp_timer_get_time();
+    for (; done < batch->nops; done++) {
+        const i2cbatch_op_t *op = &batch->ops[done];
+        if (op->kind == I2CBATCH_DELAY) {
+            vTaskDelay((op->len + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS);
+            continue;
+        }
+        ret = i2cbatch_run_op(batch, op);
+        if (ret != ESP_OK) {
+            break;
+        }
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+
+    /* Results: one line per i2cget */
+    char line[8 + 3 * 256];
+    for (int i = 0; i < done; i++) {
+        const i2cbatch_op_t *op = &batch->ops[i];
+        if (op->kind != I2CBATCH_READ) {
+            continue;
+        }
+        int n = sprintf(line, "%3d:", op->statement);
+        for (int k = 0; k < op->len; k++) {
+            n += sprintf(line + n, " %02x", batch->data[op->offset + k]);
+        }
+        printf("%s\r\n", line);
+    }
+    if (ret != ESP_OK) {
+        const i2cbatch_op_t *op = &batch->ops[done];
+        printf("Statement %d (chip 0x%02x) failed: %s\r\n", op->statement, op->chip,
+               ret == ESP_ERR_TIMEOUT ? "bus is busy" : esp_err_to_name(ret));
+    }
+    printf("%d of %d statements in %lld us\r\n", done, batch->nops, elapsed);
+    free(batch);
+    return ret == ESP_OK ? 0 : 1;
+}
+
+static void register_i2cbatch(void)
+{
+    i2cbatch_args.file = arg_str0("f", "file", "<path>", "Read the script from a file (e.g. on the FATFS partition)");
+    i2cbatch_args.script = arg_str0(NULL, NULL, "<script>", "Statements separated by ';' (quoted)");
+    i2cbatch_args.end = arg_end(2);
+    const esp_console_cmd_t i2cbatch_cmd = {
+        .command = "i2cbatch",
+        .help = "Run a script of i2cset, i2cget and delay statements back-to-back",
+        .hint = NULL,
+        .func = &do_i2cbatch_cmd,
+        .argtable = &i2cbatch_args
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&i2cbatch_cmd));
+}
+
+#if CONFIG_I2C_BUS_SIM
+/* Sensor model standing in for the Si7021 on the simulated bus */
+static si7021_sim_handle_t si7021_sim = NULL;
+#endif
+
+static int do_si7021attach_cmd(int argc, char **argv)
+{
+    if (si7021_i2c) {
+        printf("Si7021 already attached\r\n");
+        return 0;
+    }
+    /* The Si7021 bus installs the driver with the i2cconfig settings */
+    i2c_master_driver_uninstall();
+    esp_err_t ret;
+
+#if CONFIG_I2C_BUS_SIM
+    si7021_sim_create_args_t sim_args = SI7021_SIM_DEFAULT_CREATE_ARGS();
+    sim_args.i2c_port = i2c_port;
+    ret = si7021_sim_create(&sim_args, &si7021_sim);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Could not create Si7021 model: %s", esp_err_to_name(ret));
+        return 1;
+    }
+#endif
+    si7021_i2c_create_args_t args = SI7021_I2C_DEFAULT_CREATE_ARGS();
+    args.i2c_port = i2c_port;
+    args.i2c_driver.install = true;
+    args.i2c_driver.set_config = true;
+    args.i2c_driver.uninstall_at_delete = true;
+    args.i2c_driver.config.sda_io_num = i2c_gpio_sda;
+    args.i2c_driver.config.scl_io_num = i2c_gpio_scl;
+    args.i2c_driver.config.master.clk_speed = i2c_frequency;
+    ret = si7021_i2c_create(&args, &si7021_i2c);
+    if (ret == ESP_OK) {
+        ret = si7021_i2c_console_register(si7021_i2c);
+        if (ret != ESP_OK) {
+            si7021_i2c_delete(si7021_i2c);
+            si7021_i2c = NULL;
+        }
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Could not attach Si7021: %s", esp_err_to_name(ret));
+#if CONFIG_I2C_BUS_SIM
+        si7021_sim_delete(si7021_sim);
+        si7021_sim = NULL;
+#endif
+        return 1;
+    }
+    printf("Si7021 attached on port %d; try 'si7021read' and 'si7021_i2c_stats'\r\n", i2c_port);
+    return 0;
+}
+
+static void register_si7021attach(void)
+{
+    const esp_console_cmd_t si7021attach_cmd = {
+        .command = "si7021attach",
+        .help = "Attach a Si7021 on the i2cconfig port (its bus owns the port until detached)",
+        .hint = NULL,
+        .func = &do_si7021attach_cmd,
+        .argtable = NULL
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&si7021attach_cmd));
+}
+
+static int do_si7021detach_cmd(int argc, char **argv)
+{
+    if (!si7021_i2c) {
+        printf("No Si7021 attached\r\n");
+        return 0;
+    }
+    si7021_i2c_console_unregister(si7021_i2c);
+    esp_err_t ret = si7021_i2c_delete(si7021_i2c);
+    si7021_i2c = NULL;
+#if CONFIG_I2C_BUS_SIM
+    si7021_sim_delete(si7021_sim);
+    si7021_sim = NULL;
+#endif
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Could not delete Si7021 handle: %s", esp_err_to_name(ret));
+        return 1;
+    }
+    return 0;
+}
+
+static void register_si7021detach(void)
+{
+    const esp_console_cmd_t si7021detach_cmd = {
+        .command = "si7021detach",
+        .help = "Detach the Si7021 and give the port back to i2c-tools",
+        .hint = NULL,
+        .func = &do_si7021detach_cmd,
+        .argtable = NULL
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&si7021detach_cmd));
+}
+
+static struct {
+    struct arg_int *count;
+    struct arg_end *end;
+} si7021read_args;
+
+/* Hold master RH & temperature of the same conversion, <count> times, so that
+ * 'si7021_i2c_stats' has latencies (and CRC checks) to show */
+static int do_si7021read_cmd(int argc, char **argv)
+{
+    int nerrors = arg_parse(argc, argv, (void **)&si7021read_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, si7021read_args.end, argv[0]);
+        return 0;
+    }
+    if (!si7021_i2c) {
+        printf("Run 'si7021attach' first\r\n");
+        return 1;
+    }
+    int count = 1;
+    if (si7021read_args.count->count) {
+        count = si7021read_args.count->ival[0];
+        if (count < 1 || count > SI7021READ_MAX_COUNT) {
+            printf("Count must be 1 to %d\r\n", SI7021READ_MAX_COUNT);
+            return 1;
+        }
+    }
+
+    int failed = 0;
+    for (int i = 0; i < count; i++) {
+        uint16_t rh, temp;
+        esp_err_t ret = si7021_i2c_measure_rh_hold_master(si7021_i2c, &rh, true, 0);
+        if (ret == ESP_OK) {
+            ret = si7021_i2c_read_temp_from_prev_rh_measurement(si7021_i2c, &temp, 0);
+        }
+        if (ret != ESP_OK) {
+            printf("%3d: %s\r\n", i, esp_err_to_name(ret));
+            failed++;
+            continue;
+        }
+        /* Datasheet conversions */
+        printf("%3d: %.2f %%RH, %.2f C\r\n", i, 125.0f * rh / 65536 - 6,
+               175.72f * temp / 65536 - 46.85f);
+    }
+    printf("%d of %d measurements failed\r\n", failed, count);
+    return failed ? 1 : 0;
+}
+
+static void register_si7021read(void)
+{
+    si7021read_args.count = arg_int0("n", "count", "<count>", "Measurements to take (default 1)");
+    si7021read_args.end = arg_end(1);
+    const esp_console_cmd_t si7021read_cmd = {
+        .command = "si7021read",
+        .help = "Measure RH & temperature with the attached Si7021",
+        .hint = NULL,
+        .func = &do_si7021read_cmd,
+        .argtable = &si7021read_args
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&si7021read_cmd));
+}
+
 void register_i2ctools(void)
 {
     register_i2cconfig();
@@ -411,4 +1209,9 @@ void register_i2ctools(void)
     register_i2cget();
     register_i2cset();
     register_i2cdump();
+    register_i2cbench();
+    register_i2cbatch();
+    register_si7021attach();
+    register_si7021detach();
+    register_si7021read();
 }
\ No newline at end of file
@@ -47,6 +47,8 @@ void app_main(void)
     repl_config.history_save_path = HISTORY_PATH;
 #endif
     repl_config.prompt = "i2c-tools>";
+    // room for i2cbatch scripts pasted in one line
+    repl_config.max_cmdline_length = 1024;
 
     // install console REPL environment
 #if CONFIG_ESP_CONSOLE_UART
@@ -71,6 +73,9 @@ void app_main(void)
     printf(" |  4. Try 'i2cget' to get the content of specific register   |\n");
     printf(" |  5. Try 'i2cset' to set the value of specific register     |\n");
     printf(" |  6. Try 'i2cdump' to dump all the register (Experiment)    |\n");
+    printf(" |  7. Try 'i2cbench' to measure the bus at several speeds    |\n");
+    printf(" |  8. Try 'i2cbatch' to run a script of i2cset/i2cget        |\n");
+    printf(" |  9. Try 'si7021attach', 'si7021read' & 'si7021_i2c_stats'  |\n");
     printf(" |                                                            |\n");
     printf(" ==============================================================\n\n");
 
@@ -5,10 +5,9 @@
 // include for periodic timer
 #include "esp_timer.h"
 
-// include for RTOS locks
+// include for vTaskDelay
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "freertos/semphr.h"
 
 
 #include "esp_err.h"
@@ -20,20 +19,14 @@ static const char *TAG = "main";
 
 #define APP_SI7021_PERIOD_MS  /* 1000 */ CONFIG_APP_SI7021_PERIOD_MS
 
-// I2C LOCK //
-SemaphoreHandle_t i2c_lock = NULL;
-
 // Periodic timer callback
 void si7021_periodic_timer_callback(void *arg)
 {
     si7021_handle_t si7021 = (si7021_handle_t)arg;
 
-    // Measure Rh and Temp (with lock)
+    // Measure Rh and Temp (the I2C bus serializes access, no lock needed)
     float rh, temp;
-    if (xSemaphoreTake(i2c_lock, portMAX_DELAY) == pdTRUE) {
-        si7021_measure_rh_and_temp(si7021, &rh, &temp);
-        xSemaphoreGive(i2c_lock);
-
+    if (si7021_measure_rh_and_temp(si7021, &rh, &temp) == ESP_OK) {
         // Log values
         ESP_LOGI(TAG, "RH: %.2f%% | Temp: %.2fC", rh, temp);
     }
@@ -45,16 +38,9 @@ void app_main(void)
 {
     esp_err_t err;
 
-    // I2C LOCK //
-    i2c_lock = xSemaphoreCreateMutex();
-    if (i2c_lock == NULL) {
-        ESP_LOGE(TAG, "Could not create I2C lock");
-        return;
-    }
-
     // SI7021 //
     si7021_create_args_t si7021_create_args = SI7021_DEFAULT_CREATE_ARGS();
-    si7021_create_args.crc_config = SI7021_CRC_CONFIG_ALL(false); // CRC not implemented (avoid LOGW)
+    SI7021_CREATE_ARGS_CRC_CONFIG_SET_ALL(si7021_create_args.crc_config, false);
 
     si7021_handle_t si7021;
     if ( (err = si7021_create(&si7021_create_args, &si7021)) != ESP_OK) {
@@ -109,9 +95,6 @@ void app_main(void)
         return;
     }
 
-    // Delete I2C lock //
-    vSemaphoreDelete(i2c_lock);
-
     ESP_LOGI(TAG, "Done");
 
     return;
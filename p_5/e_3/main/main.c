@@ -1,14 +1,14 @@
 #include <stdio.h>
 
 #include "si7021.h"
+#include "si7021_service.h"
 
-// include for periodic timer
+// include for esp_timer_get_time
 #include "esp_timer.h"
 
-// include for RTOS locks
+// include for vTaskDelay
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "freertos/semphr.h"
 
 
 #include "esp_err.h"
@@ -20,23 +20,19 @@ static const char *TAG = "main";
 
 #define APP_SI7021_PERIOD_MS  /* 1000 */ CONFIG_APP_SI7021_PERIOD_MS
 
-// I2C LOCK //
-SemaphoreHandle_t i2c_lock = NULL;
-
-// Periodic timer callback
-void si7021_periodic_timer_callback(void *arg)
+// Log latest values (lock-free: no bus access from this task)
+static void log_latest(si7021_service_handle_t service)
 {
-    si7021_handle_t si7021 = (si7021_handle_t)arg;
-
-    // Measure Rh and Temp (with lock)
-    float rh, temp;
-    if (xSemaphoreTake(i2c_lock, portMAX_DELAY) == pdTRUE) {
-        si7021_measure_rh_and_temp(si7021, &rh, &temp);
-        xSemaphoreGive(i2c_lock);
-
-        // Log values
-        ESP_LOGI(TAG, "RH: %.2f%% | Temp: %.2fC", rh, temp);
+    si7021_service_sample_t sample;
+    if (si7021_service_get_latest(service, &sample) != ESP_OK) {
+        ESP_LOGW(TAG, "No values yet (%u errors)", (unsigned)sample.errors);
+        return;
     }
+
+    int64_t age_ms = (esp_timer_get_time() - sample.timestamp_us) / 1000;
+    ESP_LOGI(TAG, "RH: %.2f%% | Temp: %.2fC | Age: %lld ms | Errors: %u",
+        sample.rh_percent, sample.temp_celsius, (long long)age_ms,
+        (unsigned)sample.errors);
 }
 
 
@@ -45,13 +41,6 @@ void app_main(void)
 {
     esp_err_t err;
 
-    // I2C LOCK //
-    i2c_lock = xSemaphoreCreateMutex();
-    if (i2c_lock == NULL) {
-        ESP_LOGE(TAG, "Could not create I2C lock");
-        return;
-    }
-
     // SI7021 //
     si7021_create_args_t si7021_create_args = SI7021_DEFAULT_CREATE_ARGS();
     si7021_create_args.at_init.dump.crc_config = true;
@@ -61,44 +50,35 @@ void app_main(void)
         return;
     }
 
-    // Periodic timer //
-    const esp_timer_create_args_t periodic_timer_args = {
-        .callback = &si7021_periodic_timer_callback,
-        .arg = si7021,
-        .name = "si7021_periodic_timer"
-    };
-    esp_timer_handle_t periodic_timer;
-    if ( (err = esp_timer_create(&periodic_timer_args, &periodic_timer)) != ESP_OK) {
-        ESP_LOGE(TAG, "Could not create periodic timer: %d", err);
+    // SI7021 service (owns the measurement cadence) //
+    si7021_service_create_args_t service_create_args =
+        SI7021_SERVICE_DEFAULT_CREATE_ARGS();
+    service_create_args.si7021 = si7021;
+    service_create_args.period_ms = APP_SI7021_PERIOD_MS;
+    si7021_service_handle_t service;
+    if ( (err = si7021_service_create(&service_create_args, &service)) != ESP_OK) {
+        ESP_LOGE(TAG, "Could not create SI7021 service: %d", err);
         return;
     }
 
     // ---
 
-    // Start periodic timer //
-    if ( (err = esp_timer_start_periodic(periodic_timer, APP_SI7021_PERIOD_MS * 1000)) != ESP_OK) {
-        ESP_LOGE(TAG, "Could not start periodic timer: %d", err);
-        return;
+    // Log latest values every APP_SI7021_PERIOD_MS for APP_DURATION_MS //
+    // (forever if APP_DURATION_MS is 0)
+    TickType_t period = APP_SI7021_PERIOD_MS / portTICK_PERIOD_MS;
+    TickType_t duration = APP_DURATION_MS / portTICK_PERIOD_MS;
+    TickType_t start = xTaskGetTickCount();
+    TickType_t last_wake = start;
+    while (!APP_DURATION_MS || xTaskGetTickCount() - start < duration) {
+        vTaskDelayUntil(&last_wake, period);
+        log_latest(service);
     }
 
-    if (!APP_DURATION_MS) {
-        return;
-    }
-
-    // Wait for APP_DURATION_MS //
-    vTaskDelay(APP_DURATION_MS / portTICK_PERIOD_MS);
-
     // ---
 
-    // Stop periodic timer //
-    if ( (err = esp_timer_stop(periodic_timer)) != ESP_OK) {
-        ESP_LOGE(TAG, "Could not stop periodic timer: %d", err);
-        return;
-    }
-
-    // Delete periodic timer //
-    if ( (err = esp_timer_delete(periodic_timer)) != ESP_OK) {
-        ESP_LOGE(TAG, "Could not delete periodic timer: %d", err);
+    // Delete SI7021 service //
+    if ( (err = si7021_service_delete(service)) != ESP_OK) {
+        ESP_LOGE(TAG, "Could not delete SI7021 service: %d", err);
         return;
     }
 
@@ -108,9 +88,6 @@ void app_main(void)
         return;
     }
 
-    // Delete I2C lock //
-    vSemaphoreDelete(i2c_lock);
-
     ESP_LOGI(TAG, "Done");
 
     return;
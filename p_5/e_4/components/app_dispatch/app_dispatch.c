@@ -0,0 +1,249 @@
+#include "app_dispatch.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdlib.h>              // for calloc, free
+#include <string.h>              // for memcpy, memset
+#include <stdbool.h>             // for bool
+#include "esp_timer.h"           // for esp_timer_get_time (latency)
+#include "freertos/task.h"       // for dispatch task & notifications
+#include "freertos/queue.h"      // for lanes
+#include "freertos/semphr.h"     // for stop handshake
+
+/* Logging */
+#include "esp_log.h"
+static const char *TAG = "App Dispatch";
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Event (payload inline, in a fixed size slot) */
+typedef struct {
+    uint16_t id;
+    int64_t  posted_us; // Latency start
+    union {
+        uint8_t  bytes[APP_DISPATCH_PAYLOAD_SIZE];
+        uint32_t align;
+    } payload;
+} app_dispatch_event_t;
+
+/* App Dispatch */
+/* Posting queues the event in its lane and then notifies the task; the task
+ * drains HIGH before each LOW event and only sleeps when both are empty (a
+ * post racing with the sleep leaves the notification pending).
+ */
+struct app_dispatch {
+    app_dispatch_entry_t const *table;
+    size_t                      table_len;
+    void                       *ctx;
+
+    QueueHandle_t     lanes[APP_DISPATCH_LANES];
+    TaskHandle_t      task;
+    bool              running; // Cleared at delete
+    SemaphoreHandle_t stopped; // Given by the task on its way out
+
+    portMUX_TYPE              lock; // Protects stats
+    app_dispatch_lane_stats_t stats[APP_DISPATCH_LANES];
+};
+
+// -----------------------------------------------------------------------------
+
+// MACROS ----------------------------------------------------------------------
+
+#define CHECK_ERR_ARG(cond, msg)                                               \
+    if (!(cond)) {                                                             \
+        ESP_LOGE(TAG, msg);                                                    \
+        return ESP_ERR_INVALID_ARG;                                            \
+    }
+
+#define CHECK_ERR_MALLOC(ptr, dispatch)                                        \
+    if (!ptr) {                                                                \
+        ESP_LOGE(TAG, "Could not allocate memory.");                           \
+        _app_dispatch_free(dispatch);                                          \
+        return ESP_ERR_NO_MEM;                                                 \
+    }
+
+// -----------------------------------------------------------------------------
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+/* Free Dispatch (and whatever was created) */
+static void _app_dispatch_free(
+    app_dispatch_handle_t dispatch )
+{
+    if (!dispatch) return;
+    for (int i = 0; i < APP_DISPATCH_LANES; i++)
+        if (dispatch->lanes[i]) vQueueDelete(dispatch->lanes[i]);
+    if (dispatch->stopped) vSemaphoreDelete(dispatch->stopped);
+    free(dispatch);
+}
+
+/* Add a Dispatched Event of <lane> (posted at <posted_us>) */
+static void _app_dispatch_stats_dispatched(
+    app_dispatch_handle_t const dispatch  ,
+    app_dispatch_lane_t         lane      ,
+    int64_t                     posted_us )
+{
+    int64_t latency_us = esp_timer_get_time() - posted_us;
+    if (latency_us < 0) latency_us = 0;
+
+    portENTER_CRITICAL(&dispatch->lock);
+    app_dispatch_lane_stats_t *stats = &dispatch->stats[lane];
+    stats->dispatched++;
+    stats->latency_us += (uint64_t) latency_us;
+    if (latency_us > stats->latency_max_us)
+        stats->latency_max_us = (uint32_t) latency_us;
+    portEXIT_CRITICAL(&dispatch->lock);
+}
+
+/* Dispatch Task */
+static void _app_dispatch_task(
+    void *arg )
+{
+    app_dispatch_handle_t dispatch = (app_dispatch_handle_t) arg;
+    app_dispatch_event_t  event;
+
+    while (dispatch->running) {
+        // > Next event, HIGH lane first (sleep if there is none)
+        QueueHandle_t *lanes = dispatch->lanes;
+        if (
+            xQueueReceive(lanes[APP_DISPATCH_LANE_HIGH], &event, 0) != pdTRUE &&
+            xQueueReceive(lanes[APP_DISPATCH_LANE_LOW],  &event, 0) != pdTRUE
+        ) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        // > Handler by id (checked at post)
+        _app_dispatch_stats_dispatched(
+            dispatch, dispatch->table[event.id].lane, event.posted_us);
+        dispatch->table[event.id].handler(dispatch->ctx, event.payload.bytes);
+    }
+
+    // > Stopped (last access to the handle)
+    xSemaphoreGive(dispatch->stopped);
+    vTaskDelete(NULL);
+}
+
+// -----------------------------------------------------------------------------
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+/* Create App Dispatch */
+esp_err_t app_dispatch_create(
+    app_dispatch_create_args_t const *create_args ,
+    app_dispatch_handle_t            *out_handle  )
+{
+    CHECK_ERR_ARG(create_args, "Pointer to create args is NULL.");
+    CHECK_ERR_ARG(out_handle, "Pointer to out handle is NULL.");
+    CHECK_ERR_ARG(create_args->table && create_args->table_len,
+        "Handler table is empty.");
+
+    // > Allocate Handle & Lanes
+    app_dispatch_handle_t dispatch = calloc(1, sizeof(struct app_dispatch));
+    CHECK_ERR_MALLOC(dispatch, dispatch);
+    dispatch->table     = create_args->table;
+    dispatch->table_len = create_args->table_len;
+    dispatch->ctx       = create_args->ctx;
+    dispatch->running   = true;
+    portMUX_INITIALIZE(&dispatch->lock);
+    for (int i = 0; i < APP_DISPATCH_LANES; i++) {
+        dispatch->lanes[i] = xQueueCreate(
+            create_args->queue_size[i], sizeof(app_dispatch_event_t));
+        CHECK_ERR_MALLOC(dispatch->lanes[i], dispatch);
+    }
+    dispatch->stopped = xSemaphoreCreateBinary();
+    CHECK_ERR_MALLOC(dispatch->stopped, dispatch);
+
+    // > Dispatch Task
+    BaseType_t ok = xTaskCreate(
+        &_app_dispatch_task          ,
+        create_args->task_name       ,
+        create_args->task_stack_size ,
+        dispatch                     ,
+        create_args->task_priority   ,
+        &dispatch->task             );
+    if (ok != pdPASS) {
+        ESP_LOGE(TAG, "Could not create dispatch task.");
+        _app_dispatch_free(dispatch);
+        return ESP_ERR_NO_MEM;
+    }
+
+    *out_handle = dispatch;
+    return ESP_OK;
+}
+
+/* Delete App Dispatch */
+esp_err_t app_dispatch_delete(
+    app_dispatch_handle_t dispatch )
+{
+    CHECK_ERR_ARG(dispatch, "App dispatch handle is NULL.");
+
+    // > Stop the task (after the handler in progress) & wait for it
+    dispatch->running = false;
+    xTaskNotifyGive(dispatch->task);
+    xSemaphoreTake(dispatch->stopped, portMAX_DELAY);
+
+    _app_dispatch_free(dispatch);
+    return ESP_OK;
+}
+
+/* Post Event */
+esp_err_t app_dispatch_post(
+    app_dispatch_handle_t  dispatch ,
+    uint16_t               id       ,
+    void           const  *payload  ,
+    size_t                 size     ,
+    TickType_t             timeout  )
+{
+    CHECK_ERR_ARG(dispatch, "App dispatch handle is NULL.");
+    CHECK_ERR_ARG(id < dispatch->table_len && dispatch->table[id].handler,
+        "Event id has no handler.");
+    CHECK_ERR_ARG(size <= APP_DISPATCH_PAYLOAD_SIZE && (payload || !size),
+        "Payload does not fit in an event.");
+
+    app_dispatch_event_t event = { .id = id };
+    if (size) memcpy(event.payload.bytes, payload, size);
+
+    app_dispatch_lane_t lane = dispatch->table[id].lane;
+    event.posted_us = esp_timer_get_time();
+    if (xQueueSend(dispatch->lanes[lane], &event, timeout) != pdTRUE) {
+        portENTER_CRITICAL(&dispatch->lock);
+        dispatch->stats[lane].dropped++;
+        portEXIT_CRITICAL(&dispatch->lock);
+        return ESP_ERR_TIMEOUT;
+    }
+    xTaskNotifyGive(dispatch->task);
+    return ESP_OK;
+}
+
+/* Get Lane Stats */
+esp_err_t app_dispatch_get_stats(
+    app_dispatch_handle_t      const  dispatch  ,
+    app_dispatch_lane_t               lane      ,
+    app_dispatch_lane_stats_t        *out_stats )
+{
+    CHECK_ERR_ARG(dispatch, "App dispatch handle is NULL.");
+    CHECK_ERR_ARG(lane < APP_DISPATCH_LANES, "Lane does not exist.");
+    CHECK_ERR_ARG(out_stats, "Pointer to out stats is NULL.");
+
+    portENTER_CRITICAL(&dispatch->lock);
+    *out_stats = dispatch->stats[lane];
+    portEXIT_CRITICAL(&dispatch->lock);
+    return ESP_OK;
+}
+
+/* Reset Stats (every lane) */
+esp_err_t app_dispatch_reset_stats(
+    app_dispatch_handle_t const dispatch )
+{
+    CHECK_ERR_ARG(dispatch, "App dispatch handle is NULL.");
+
+    portENTER_CRITICAL(&dispatch->lock);
+    memset(dispatch->stats, 0, sizeof(dispatch->stats));
+    portEXIT_CRITICAL(&dispatch->lock);
+    return ESP_OK;
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,103 @@
+#ifndef __APP_DISPATCH_H__
+#define __APP_DISPATCH_H__
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>             // uint8_t, uint16_t, uint32_t, uint64_t
+#include <stddef.h>             // size_t
+#include "esp_err.h"            // esp_err_t
+#include "freertos/FreeRTOS.h"  // TickType_t, UBaseType_t
+
+// -----------------------------------------------------------------------------
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define APP_DISPATCH_PAYLOAD_SIZE 16 // Bytes copied inline with each event
+
+// -----------------------------------------------------------------------------
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* App Dispatch Handle */
+typedef struct app_dispatch *app_dispatch_handle_t;
+
+/* App Dispatch Lane (HIGH events always go first) */
+typedef enum {
+    APP_DISPATCH_LANE_HIGH ,
+    APP_DISPATCH_LANE_LOW  ,
+    APP_DISPATCH_LANES     ,
+} app_dispatch_lane_t;
+
+/* App Dispatch Handler (<payload> as posted, aligned to 4 bytes) */
+typedef void (*app_dispatch_handler_t)(void *ctx, void const *payload);
+
+/* App Dispatch Table Entry (the table is indexed by event id) */
+typedef struct {
+    app_dispatch_handler_t handler; // NULL: posting this id fails
+    app_dispatch_lane_t    lane;    // Queue the event waits in
+} app_dispatch_entry_t;
+
+/* App Dispatch Create Args */
+typedef struct {
+    app_dispatch_entry_t const *table;     // Handlers by event id (kept)
+    size_t                      table_len; // Event ids: 0 to table_len - 1
+    void                       *ctx;       // Passed to every handler
+
+    size_t      queue_size[APP_DISPATCH_LANES]; // Events waiting per lane
+    const char *task_name;
+    UBaseType_t task_priority;
+    uint32_t    task_stack_size;
+} app_dispatch_create_args_t;
+
+/* App Dispatch Lane Stats */
+typedef struct {
+    uint32_t dispatched;     // Events handled
+    uint32_t dropped;        // Posts that found the lane full (ESP_ERR_TIMEOUT)
+    uint64_t latency_us;     // Post to handler start, summed (mean: / dispatched)
+    uint32_t latency_max_us; // Post to handler start, worst
+} app_dispatch_lane_stats_t;
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS -------------------------------------------------------------------
+
+/* Create & Delete */
+/* One task runs the handlers of both lanes: a LOW event is only taken when
+ * no HIGH one is waiting. Handlers run to completion, one at a time. Delete
+ * waits for the handler in progress, drops the events still waiting and must
+ * not race with posts (nor be called from a handler).
+ */
+esp_err_t app_dispatch_create(
+    app_dispatch_create_args_t const *create_args ,
+    app_dispatch_handle_t            *out_handle  );
+
+esp_err_t app_dispatch_delete(
+    app_dispatch_handle_t dispatch );
+
+/* Post */
+/* Copies <size> bytes of <payload> (at most APP_DISPATCH_PAYLOAD_SIZE) into
+ * the lane of <id>, waiting up to <timeout> for room. Not from ISRs.
+ */
+esp_err_t app_dispatch_post(
+    app_dispatch_handle_t  dispatch ,
+    uint16_t               id       ,
+    void           const  *payload  ,
+    size_t                 size     ,
+    TickType_t             timeout  );
+
+/* Stats */
+/* Per lane, updated by the dispatch task and posters and copied under the
+ * handle lock. Latency is what an event waits behind the handlers before it:
+ * HIGH events only wait for the handler in progress.
+ */
+esp_err_t app_dispatch_get_stats(
+    app_dispatch_handle_t      const  dispatch  ,
+    app_dispatch_lane_t               lane      ,
+    app_dispatch_lane_stats_t        *out_stats );
+
+esp_err_t app_dispatch_reset_stats(
+    app_dispatch_handle_t const dispatch );
+
+// -----------------------------------------------------------------------------
+
+#endif // __APP_DISPATCH_H__
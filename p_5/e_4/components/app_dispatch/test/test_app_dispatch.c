@@ -0,0 +1,184 @@
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdio.h>
+
+#include "unity.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include "app_dispatch.h"
+
+// DEFINITIONS -----------------------------------------------------------------
+
+#define TEST_QUEUE_SIZE 8  // Events waiting per lane
+#define TEST_BLOCK_MS   20 // How long the first handler holds the task
+#define TEST_LOW_EVENTS 4  // Readings & logs queued behind it
+#define TEST_WORK_MS    5  // Time each LOW handler takes
+
+// STRUCTURES ------------------------------------------------------------------
+
+typedef enum {
+    TEST_EVENT_BLOCK, // LOW: holds the task until released
+    TEST_EVENT_LOW,   // LOW: reading or log (TEST_WORK_MS)
+    TEST_EVENT_HIGH,  // HIGH: LED change
+    TEST_EVENT_COUNT,
+} test_event_t;
+
+/* Handler context: the order events ran in */
+typedef struct {
+    SemaphoreHandle_t entered; // Given by the blocking handler
+    SemaphoreHandle_t release; // Taken by the blocking handler
+    SemaphoreHandle_t done;    // Given by every handler
+    int               order[TEST_QUEUE_SIZE * 2];
+    volatile int      count;
+} test_ctx_t;
+
+// PRIVATE FUNCTIONS -----------------------------------------------------------
+
+static void _record(test_ctx_t *ctx, void const *payload)
+{
+    ctx->order[ctx->count++] = *(int const *) payload;
+    xSemaphoreGive(ctx->done);
+}
+
+static void _on_block(void *ctx, void const *payload)
+{
+    test_ctx_t *test = (test_ctx_t *) ctx;
+    xSemaphoreGive(test->entered);
+    xSemaphoreTake(test->release, portMAX_DELAY);
+    _record(test, payload);
+}
+
+static void _on_low(void *ctx, void const *payload)
+{
+    vTaskDelay(pdMS_TO_TICKS(TEST_WORK_MS));
+    _record((test_ctx_t *) ctx, payload);
+}
+
+static void _on_high(void *ctx, void const *payload)
+{
+    _record((test_ctx_t *) ctx, payload);
+}
+
+static const app_dispatch_entry_t _table[TEST_EVENT_COUNT] = {
+    [TEST_EVENT_BLOCK] = { _on_block , APP_DISPATCH_LANE_LOW  },
+    [TEST_EVENT_LOW]   = { _on_low   , APP_DISPATCH_LANE_LOW  },
+    [TEST_EVENT_HIGH]  = { _on_high  , APP_DISPATCH_LANE_HIGH },
+};
+
+static void _setup(test_ctx_t *ctx, app_dispatch_handle_t *dispatch)
+{
+    *ctx = (test_ctx_t) {
+        .entered = xSemaphoreCreateBinary(),
+        .release = xSemaphoreCreateBinary(),
+        .done    = xSemaphoreCreateCounting(TEST_QUEUE_SIZE * 2, 0),
+    };
+    app_dispatch_create_args_t args = {
+        .table           = _table,
+        .table_len       = TEST_EVENT_COUNT,
+        .ctx             = ctx,
+        .queue_size      = { TEST_QUEUE_SIZE, TEST_QUEUE_SIZE },
+        .task_name       = "test_dispatch",
+        .task_priority   = 5,
+        .task_stack_size = 3072,
+    };
+    TEST_ESP_OK(app_dispatch_create(&args, dispatch));
+}
+
+static void _teardown(test_ctx_t *ctx, app_dispatch_handle_t dispatch)
+{
+    TEST_ESP_OK(app_dispatch_delete(dispatch));
+    vSemaphoreDelete(ctx->entered);
+    vSemaphoreDelete(ctx->release);
+    vSemaphoreDelete(ctx->done);
+}
+
+/* Post <id> with <tag> as payload (recorded by its handler) */
+static esp_err_t _post(app_dispatch_handle_t dispatch, test_event_t id, int tag)
+{
+    return app_dispatch_post(dispatch, id, &tag, sizeof(tag), 0);
+}
+
+static void _wait_handlers(test_ctx_t *ctx, int count)
+{
+    for (int i = 0; i < count; i++)
+        TEST_ASSERT_TRUE(xSemaphoreTake(ctx->done, pdMS_TO_TICKS(1000)));
+}
+
+// TESTS -----------------------------------------------------------------------
+
+TEST_CASE("HIGH events run ahead of the LOW ones waiting", "[app_dispatch]")
+{
+    test_ctx_t            ctx;
+    app_dispatch_handle_t dispatch;
+    _setup(&ctx, &dispatch);
+
+    // > Task busy: LOW events queue first, then HIGH ones
+    TEST_ESP_OK(_post(dispatch, TEST_EVENT_BLOCK, 0));
+    TEST_ASSERT_TRUE(xSemaphoreTake(ctx.entered, pdMS_TO_TICKS(1000)));
+    for (int i = 0; i < TEST_LOW_EVENTS; i++)
+        TEST_ESP_OK(_post(dispatch, TEST_EVENT_LOW, 10 + i));
+    TEST_ESP_OK(_post(dispatch, TEST_EVENT_HIGH, 20));
+    TEST_ESP_OK(_post(dispatch, TEST_EVENT_HIGH, 21));
+    xSemaphoreGive(ctx.release);
+    _wait_handlers(&ctx, 3 + TEST_LOW_EVENTS);
+
+    // > Handler in progress, HIGH in post order, then LOW in post order
+    int expected[] = { 0, 20, 21, 10, 11, 12, 13 };
+    TEST_ASSERT_EQUAL(3 + TEST_LOW_EVENTS, ctx.count);
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, ctx.order, 3 + TEST_LOW_EVENTS);
+
+    _teardown(&ctx, dispatch);
+}
+
+TEST_CASE("lane stats measure post to dispatch latency and count drops", "[app_dispatch]")
+{
+    test_ctx_t                ctx;
+    app_dispatch_handle_t     dispatch;
+    app_dispatch_lane_stats_t high, low;
+    _setup(&ctx, &dispatch);
+
+    // > LOW lane filled behind a busy handler: the next post is dropped
+    TEST_ESP_OK(_post(dispatch, TEST_EVENT_BLOCK, 0));
+    TEST_ASSERT_TRUE(xSemaphoreTake(ctx.entered, pdMS_TO_TICKS(1000)));
+    for (int i = 0; i < TEST_QUEUE_SIZE; i++)
+        TEST_ESP_OK(_post(dispatch, TEST_EVENT_LOW, 10 + i));
+    TEST_ESP_ERR(ESP_ERR_TIMEOUT, _post(dispatch, TEST_EVENT_LOW, 99));
+
+    // > A HIGH event posted while the task is busy only waits for it
+    vTaskDelay(pdMS_TO_TICKS(TEST_BLOCK_MS));
+    TEST_ESP_OK(_post(dispatch, TEST_EVENT_HIGH, 20));
+    xSemaphoreGive(ctx.release);
+    _wait_handlers(&ctx, 2 + TEST_QUEUE_SIZE);
+
+    TEST_ESP_OK(app_dispatch_get_stats(dispatch, APP_DISPATCH_LANE_HIGH, &high));
+    TEST_ESP_OK(app_dispatch_get_stats(dispatch, APP_DISPATCH_LANE_LOW, &low));
+    printf("Latency HIGH: mean %u us, max %u us | LOW: mean %u us, max %u us\n",
+        (unsigned) (high.latency_us / high.dispatched),
+        (unsigned) high.latency_max_us,
+        (unsigned) (low.latency_us / low.dispatched),
+        (unsigned) low.latency_max_us);
+
+    TEST_ASSERT_EQUAL(1, high.dispatched);
+    TEST_ASSERT_EQUAL(0, high.dropped);
+    TEST_ASSERT_EQUAL(1 + TEST_QUEUE_SIZE, low.dispatched);
+    TEST_ASSERT_EQUAL(1, low.dropped);
+
+    // > The last LOW event waited for the block, the HIGH one and the other
+    //   LOW handlers; the HIGH one for none of the LOW handlers
+    TEST_ASSERT_GREATER_OR_EQUAL(
+        (TEST_BLOCK_MS + (TEST_QUEUE_SIZE - 1) * TEST_WORK_MS) * 1000,
+        low.latency_max_us);
+    TEST_ASSERT_LESS_THAN(TEST_WORK_MS * 1000, high.latency_max_us);
+
+    // > Reset clears every lane
+    TEST_ESP_OK(app_dispatch_reset_stats(dispatch));
+    TEST_ESP_OK(app_dispatch_get_stats(dispatch, APP_DISPATCH_LANE_LOW, &low));
+    TEST_ASSERT_EQUAL(0, low.dispatched);
+    TEST_ASSERT_EQUAL(0, low.dropped);
+    TEST_ASSERT_EQUAL(0, low.latency_max_us);
+
+    _teardown(&ctx, dispatch);
+}
@@ -2,7 +2,7 @@
 
 #include "driver/gpio.h"
 #include "esp_err.h"
-#include "esp_timer.h"
+#include "waveform_output.h"
 #include "stdio.h"
 #include "string.h"
 
@@ -26,9 +26,8 @@ const static gpio_num_t _gpio_led[] = {
 /* APP LEDS init */
 static bool _initialized = false;
 
-/* Blink Timer */
-static esp_timer_handle_t _blink_timer = NULL;
-static uint8_t _blink = 0;
+/* Blink Output (LEDC driven, no CPU involvement while blinking) */
+static waveform_output_handle_t _blink_output = NULL;
 
 /* GPIO Log Level */
 static esp_log_level_t _gpio_default_log_level;
@@ -76,38 +75,39 @@ static esp_log_level_t _gpio_default_log_level;
 
 //// ---------------------------------------------------------------------------
 
-//// TIMER ERRORS --------------------------------------------------------------
+//// BLINK OUTPUT ERRORS -------------------------------------------------------
 
-#define CHECK_ERR_CREATE_TIMER(err)                                            \
+#define CHECK_ERR_CREATE_BLINK(err)                                            \
     if (err) {                                                                 \
-        ESP_LOGE(TAG, "Error creating timer: %s", esp_err_to_name(err));       \
+        ESP_LOGE(TAG, "Error creating blink output: %s", esp_err_to_name(err));\
         return err;                                                            \
     }
 
-#define CHECK_WARN_DELETE_TIMER(err)                                           \
-    if (err) ESP_LOGW(TAG, "Error deleting timer: %s", esp_err_to_name(err));
+#define CHECK_WARN_DELETE_BLINK(err)                                           \
+    if (err) ESP_LOGW(TAG, "Error deleting blink output: %s",                  \
+        esp_err_to_name(err));
 
-#define CHECK_ERR_START_TIMER(err)                                             \
+#define CHECK_ERR_START_BLINK(err)                                             \
     if (err) {                                                                 \
-        ESP_LOGE(TAG, "Error starting timer: %s", esp_err_to_name(err));       \
+        ESP_LOGE(TAG, "Error starting blink: %s", esp_err_to_name(err));       \
         return err;                                                            \
     }
 
-#define CHECK_ERR_STOP_TIMER(err)                                              \
+#define CHECK_ERR_STOP_BLINK(err)                                              \
     if (err) {                                                                 \
-        ESP_LOGE(TAG, "Error stopping timer: %s", esp_err_to_name(err));       \
+        ESP_LOGE(TAG, "Error stopping blink: %s", esp_err_to_name(err));       \
         return err;                                                            \
     }
 
-#define CHECK_IF_BLINK_TIMER_ACTIVE()                                          \
-    if (esp_timer_is_active(_blink_timer)) {                                   \
-        ESP_LOGW(TAG, "Blink timer already active.");                          \
+#define CHECK_IF_BLINK_ACTIVE()                                                \
+    if (waveform_output_is_active(_blink_output)) {                            \
+        ESP_LOGW(TAG, "Blink already active.");                                \
         return ESP_OK;                                                         \
     }
 
-#define CHECK_IF_BLINK_TIMER_NOT_ACTIVE()                                      \
-    if (!esp_timer_is_active(_blink_timer)) {                                  \
-        ESP_LOGW(TAG, "Blink timer already not active.");                      \
+#define CHECK_IF_BLINK_NOT_ACTIVE()                                            \
+    if (!waveform_output_is_active(_blink_output)) {                           \
+        ESP_LOGW(TAG, "Blink already not active.");                            \
         return ESP_OK;                                                         \
     }
 
@@ -116,17 +116,6 @@ static esp_log_level_t _gpio_default_log_level;
 
 // PRIVATE FUNCTIONS -----------------------------------------------------------
 
-//// TEMP MODE -----------------------------------------------------------------
-
-/* Blink Mode Timer Callback */
-static void _blink_timer_cb(void *arg)
-{
-    if (_blink) app_leds_all_off();
-    else app_leds_all_on();
-
-    _blink ^= 1;
-}
-
 /* Get GPIO mask */
 static uint64_t _get_gpio_mask(void)
 {
@@ -179,15 +168,15 @@ esp_err_t app_leds_init(void)
     err = gpio_config(&gpio_conf);
     CHECK_ERR_GPIO_CONFIG(err);
 
-    // Create blink timer
-    esp_timer_create_args_t blink_timer_args = {
-        .callback        = &_blink_timer_cb ,
-        .arg             = NULL             ,
-        .dispatch_method = ESP_TIMER_TASK   ,
-        .name            = "blink_timer"   };
-    err = esp_timer_create(&blink_timer_args, &_blink_timer);
+    // Create blink output (all LEDs)
+    waveform_output_create_args_t blink_args = WAVEFORM_OUTPUT_DEFAULT_CREATE_ARGS();
+    blink_args.name     = "app_leds_blink";
+    blink_args.num_gpio = APP_LEDS_NUM;
+    for (int i = 0; i < APP_LEDS_NUM; i++)
+        blink_args.gpio[i] = _gpio_led[i];
+    err = waveform_output_create(&blink_args, &_blink_output);
     if (err) _deinit_gpio();
-    CHECK_ERR_CREATE_TIMER(err);
+    CHECK_ERR_CREATE_BLINK(err);
 
     // Log LEDs gpios
     char gpio_str[256] = "GPIOs:\n";
@@ -211,14 +200,10 @@ esp_err_t app_leds_deinit(void)
     esp_err_t err;
     int err_count = 0;
 
-    // Delete blink timer
-    err = esp_timer_delete(_blink_timer);
-    if (err) err_count++;
-    CHECK_WARN_DELETE_TIMER(err);
-
-    // Deinit GPIOs
-    err = _deinit_gpio();
+    // Delete blink output (resets the LED GPIOs)
+    err = waveform_output_delete(_blink_output);
     if (err) err_count++;
+    CHECK_WARN_DELETE_BLINK(err);
 
     // Set gpio log level to default
     esp_log_level_set("gpio", _gpio_default_log_level);
@@ -290,13 +275,13 @@ esp_err_t app_leds_set_meter(uint8_t level)
 esp_err_t app_leds_start_blink(void)
 {
     CHECK_IF_APP_LEDS_INIT();
-    CHECK_IF_BLINK_TIMER_ACTIVE();
+    CHECK_IF_BLINK_ACTIVE();
     esp_err_t err = ESP_OK;
 
-    // Start blink timer
-    err = esp_timer_start_periodic(_blink_timer,
-        APP_LEDS_BLINK_PERIOD_MS * 1000);
-    CHECK_ERR_START_TIMER(err);
+    // Start blink (LEDs toggle every APP_LEDS_BLINK_PERIOD_MS)
+    err = waveform_output_start_square(_blink_output,
+        2 * APP_LEDS_BLINK_PERIOD_MS * 1000, 50);
+    CHECK_ERR_START_BLINK(err);
 
     return err;
 }
@@ -305,12 +290,12 @@ esp_err_t app_leds_start_blink(void)
 esp_err_t app_leds_stop_blink(void)
 {
     CHECK_IF_APP_LEDS_INIT();
-    CHECK_IF_BLINK_TIMER_NOT_ACTIVE();
+    CHECK_IF_BLINK_NOT_ACTIVE();
     esp_err_t err = ESP_OK;
 
-    // Stop blink timer
-    err = esp_timer_stop(_blink_timer);
-    CHECK_ERR_STOP_TIMER(err);
+    // Stop blink (LEDs back to GPIO driver)
+    err = waveform_output_stop(_blink_output, 0);
+    CHECK_ERR_STOP_BLINK(err);
 
     // Set all LEDS Off
     err = app_leds_all_off();
@@ -2,26 +2,37 @@
 // Tasks
 // - Sample Hall Sensor each second
 // - Sample temperature (Si7021) each 2 seconds
+// - The app timer only ticks: a sensor task does the (blocking) reads, so
+//   the shared esp_timer task never waits on a sensor.
 // - Log Hall and Temperature readings to UART each 5 seconds
 // - Set GPIO outs for LEDS array
-// - At startup, first temperature reading is set as baseline.
+// - At startup, Hall and temperature baselines are taken together by a
+//   calibration task at a bounded rate (trimmed mean); the app starts when
+//   it posts its completion event.
+// - The temperature baseline sets the LED meter:
 //   At this temperature, 1 LED is lit. Each 1 degree above baseline,
 //   1 more LED is lit. Each 1 degree below baseline, 1 less LED is lit.
 // - Events are post for each temperature change (above or below baseline)
 // - When Hall sensor varies more than 20% (???) from baseline, all LEDs are
 //   set to blink.
+// - One dispatcher task runs every event handler, LED events first (they
+//   never wait behind readings or logs).
+// - Si7021 heater pulses when RH nears saturation (condensation recovery),
+//   driven by the si7021 heater controller in its own task.
 
 #include <stdio.h>
+#include <math.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
 #include "hall_sensor.h"
 #include "app_leds.h"
 #include "si7021.h"
+#include "si7021_heater.h"
 
 #include "esp_timer.h"
 
-#include "esp_event.h"
+#include "app_dispatch.h"
 #include "esp_log.h"
 
 static const char *TAG = "App Main";
@@ -37,83 +48,158 @@ static const char *TAG = "App Main";
 #define APP_HALL_BASE_TIMEOUT_MS /* 5000 */ CONFIG_APP_HALL_BASE_TIMEOUT_MS
 #define APP_TEMP_BASE_TIMEOUT_MS /* 5000 */ CONFIG_APP_TEMP_BASE_TIMEOUT_MS
 
-ESP_EVENT_DEFINE_BASE(APP_TIMER_EVENTS);
-
-enum {
-    APP_TIMER_EVENT_HALL_READING,
-    APP_TIMER_EVENT_TEMP_READING,
-    APP_TIMER_EVENT_LOG_READINGS,
-} app_timer_event_t;
-
-ESP_EVENT_DEFINE_BASE(APP_LEDS_EVENTS);
-
-enum {
-    APP_LEDS_EVENT_BLINK_START,
-    APP_LEDS_EVENT_BLINK_STOP,
-    APP_LEDS_EVENT_SET_METER,
-} app_leds_event_t;
+#define APP_SENSOR_TASK_PRIORITY /* 2 */ CONFIG_APP_SENSOR_TASK_PRIORITY
+
+#define APP_TIMER_JITTER_PROBE /* 0 */ CONFIG_APP_TIMER_JITTER_PROBE
+#define APP_TIMER_JITTER_PROBE_PERIOD_MS 10
+
+#define APP_CALIB_PERIOD_MS /* 20 */ CONFIG_APP_CALIB_PERIOD_MS
+#define APP_CALIB_TEMP_EVERY /* 5 */ CONFIG_APP_CALIB_TEMP_EVERY
+#define APP_CALIB_TRIM_SIGMAS /* 2 */ CONFIG_APP_CALIB_TRIM_SIGMAS
+#define APP_CALIB_MAX_SAMPLES 128 // per sensor (sampling stops when full)
+
+// App Events (ids index app_dispatch_table)
+typedef enum {
+    APP_EVENT_HALL_READING,
+    APP_EVENT_TEMP_READING,
+    APP_EVENT_LOG_READINGS,
+    APP_EVENT_CALIB_DONE,
+    APP_EVENT_LEDS_BLINK_START,
+    APP_EVENT_LEDS_BLINK_STOP,
+    APP_EVENT_LEDS_SET_METER,
+    APP_EVENT_COUNT,
+} app_event_t;
+
+// Post (no wait)
+// The sensor task and the handlers must not block on a full lane: the event
+// is dropped, and logged so a lane too short for the load shows up.
+static void app_post(
+    app_dispatch_handle_t  dispatch ,
+    app_event_t            id       ,
+    void           const  *payload  ,
+    size_t                 size     )
+{
+    esp_err_t err = app_dispatch_post(dispatch, id, payload, size, 0);
+    if (err) ESP_LOGW(TAG, "Event %d dropped: %s", id, esp_err_to_name(err));
+}
 
 // Timer State
 typedef struct {
-    esp_event_loop_handle_t app_timer_event_loop;
+    app_dispatch_handle_t dispatch; // Gets the readings
 
-    si7021_handle_t si7021;
+    si7021_heater_ctrl_handle_t heater_ctrl; // Measures through it
+    TaskHandle_t sensor_task;                // Does the sensor I/O
 
     uint8_t read_hall;
     uint8_t read_temp;
     uint8_t log_readings;
 } app_timer_data_t;
 
+// Sensor Task Notification Bits (what is due this tick)
+#define APP_SENSOR_READ_HALL    (1 << 0)
+#define APP_SENSOR_READ_TEMP    (1 << 1)
+#define APP_SENSOR_LOG_READINGS (1 << 2)
+
 // Timer Callback
+// Runs in the esp_timer task, shared with every other esp_timer callback
+// (blink with the timer backend, jitter probe): it only tells the sensor task
+// what is due, never waits on a sensor.
 void app_timer_callback(
     void *arg
 ) {
-    // Get event loop handle
     app_timer_data_t *timer = (app_timer_data_t *) arg;
+    uint32_t due = 0;
 
-    // Hall
-    if (timer->read_hall == 0) {
-        int hall_reading = hall_sensor_get_reading();
-        esp_event_post_to(
-            timer->app_timer_event_loop  ,
-            APP_TIMER_EVENTS             ,
-            APP_TIMER_EVENT_HALL_READING ,
-            &hall_reading                ,
-            sizeof(hall_reading)         ,
-            0                           );
-    }
+    if (timer->read_hall == 0) due |= APP_SENSOR_READ_HALL;
     timer->read_hall = (timer->read_hall + 1) % APP_TIMER_READ_HALL_EVERY;
 
-    // Temp
-    if (timer->read_temp == 0) {
-        float temp_reading = 0;
-        si7021_measure_temp(timer->si7021, &temp_reading);
-        esp_event_post_to(
-            timer->app_timer_event_loop  ,
-            APP_TIMER_EVENTS             ,
-            APP_TIMER_EVENT_TEMP_READING ,
-            &temp_reading                ,
-            sizeof(temp_reading)         ,
-            0                           );
-    }
+    if (timer->read_temp == 0) due |= APP_SENSOR_READ_TEMP;
     timer->read_temp = (timer->read_temp + 1) % APP_TIMER_READ_TEMP_EVERY;
 
-    // Log
-    if (timer->log_readings == 0) {
-        esp_event_post_to(
-            timer->app_timer_event_loop  ,
-            APP_TIMER_EVENTS             ,
-            APP_TIMER_EVENT_LOG_READINGS ,
-            NULL                         ,
-            0                            ,
-            0                           );
-    }
+    if (timer->log_readings == 0) due |= APP_SENSOR_LOG_READINGS;
     timer->log_readings = (timer->log_readings + 1) % APP_TIMER_LOG_READINGS_EVERY;
+
+    if (due) xTaskNotify(timer->sensor_task, due, eSetBits);
+}
+
+// Sensor Task
+// Does the blocking reads of the ticks it is notified of (a late tick adds
+// its bits to the pending ones) and posts the readings.
+void app_sensor_task(
+    void *arg
+) {
+    app_timer_data_t *timer = (app_timer_data_t *) arg;
+
+    while (1) {
+        uint32_t due = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &due, portMAX_DELAY);
+
+        // Hall
+        if (due & APP_SENSOR_READ_HALL) {
+            int hall_reading = hall_sensor_get_reading();
+            app_post(
+                timer->dispatch        ,
+                APP_EVENT_HALL_READING ,
+                &hall_reading          ,
+                sizeof(hall_reading)   );
+        }
+
+        // Temp
+        if (due & APP_SENSOR_READ_TEMP) {
+            // (paused & compensated around heater pulses by the controller)
+            float temp;
+            if (si7021_heater_ctrl_measure_temp(timer->heater_ctrl, &temp) == ESP_OK) {
+                int32_t temp_reading = (int32_t) (temp * 100.0f); // centi-degrees
+                app_post(
+                    timer->dispatch        ,
+                    APP_EVENT_TEMP_READING ,
+                    &temp_reading          ,
+                    sizeof(temp_reading)   );
+            }
+        }
+
+        // Log (after the readings of the same tick)
+        if (due & APP_SENSOR_LOG_READINGS) {
+            app_post(
+                timer->dispatch        ,
+                APP_EVENT_LOG_READINGS ,
+                NULL                   ,
+                0                      );
+        }
+    }
 }
 
+#if APP_TIMER_JITTER_PROBE
+// Jitter Probe
+// A periodic esp_timer callback recording how late the esp_timer task runs
+// it: what a blocking callback costs every other one (e.g. the blink timer
+// with the esp_timer waveform backend). Logged with the readings.
+typedef struct {
+    int64_t  next_us;  // Expected run time
+    int64_t  max_us;   // Latest run
+    int64_t  total_us; // For the mean
+    uint32_t count;
+} app_jitter_t;
+
+static app_jitter_t app_jitter;
+
+void app_jitter_probe_callback(
+    void *arg
+) {
+    int64_t now = esp_timer_get_time();
+    int64_t late = now - app_jitter.next_us;
+    if (late < 0) late = 0;
+
+    if (late > app_jitter.max_us) app_jitter.max_us = late;
+    app_jitter.total_us += late;
+    app_jitter.count++;
+    app_jitter.next_us += APP_TIMER_JITTER_PROBE_PERIOD_MS * 1000;
+}
+#endif
+
 // App Timer FSM
 typedef struct {
-    esp_event_loop_handle_t app_leds_event_loop;
+    app_dispatch_handle_t dispatch; // Gets the LED events
 
     // Hall
     int hall_base;
@@ -121,10 +207,10 @@ typedef struct {
     int     hall_reading_mean;
     uint8_t hall_reading_count;
 
-    // Temp
-    float temp_base;
+    // Temp (centi-degrees)
+    int32_t temp_base;
 
-    float   temp_reading_mean;
+    int32_t temp_reading_sum; // Mean taken at log time (no truncation)
     uint8_t temp_reading_count;
 
     // Blink flag
@@ -134,161 +220,372 @@ typedef struct {
     uint8_t temp_state;
 } app_timer_fsm_t;
 
-// App Timer Event Handler
-void app_timer_event_handler(
-    void *handler_arg   ,
-    esp_event_base_t base,
-    int32_t id         ,
-    void *event_data   )
+// App (context of every event handler)
+typedef struct {
+    app_dispatch_handle_t  dispatch;
+    app_timer_fsm_t       *fsm;
+    app_timer_data_t      *timer_data;
+    esp_timer_handle_t     timer;
+    si7021_handle_t        si7021;
+} app_t;
+
+// App Timer Event Handlers
+void app_on_hall_reading(
+    void       *ctx     ,
+    void const *payload )
 {
-    // Get timer handle
-    app_timer_fsm_t *arg = (app_timer_fsm_t *) handler_arg;
-
-    switch(id) {
-        case APP_TIMER_EVENT_HALL_READING: ;
-            // Get hall reading
-            int hall_reading = *((int *) event_data);
-
-            // Update hall reading mean
-            arg->hall_reading_mean = (
-                (arg->hall_reading_mean * arg->hall_reading_count) +
-                hall_reading
-            ) / (arg->hall_reading_count + 1);
-
-            // Update hall reading count
-            arg->hall_reading_count++;
-
-            // If not blinking, check if hall reading is out of threshold
-            if (!arg->blink) {
-                if (
-                    (hall_reading > (arg->hall_base + APP_HALL_THRESH)) ||
-                    (hall_reading < (arg->hall_base - APP_HALL_THRESH))
-                ) {
-                    // Post event to start blinking
-                    esp_event_post_to(
-                        arg->app_leds_event_loop ,
-                        APP_LEDS_EVENTS            ,
-                        APP_LEDS_EVENT_BLINK_START ,
-                        NULL                       ,
-                        0                          ,
-                        0                         );
-
-                    arg->blink = true;
-                }
-            }
+    // Get timer FSM
+    app_timer_fsm_t *arg = ((app_t *) ctx)->fsm;
+
+    // Get hall reading
+    int hall_reading = *((int const *) payload);
+
+    // Update hall reading mean
+    arg->hall_reading_mean = (
+        (arg->hall_reading_mean * arg->hall_reading_count) +
+        hall_reading
+    ) / (arg->hall_reading_count + 1);
+
+    // Update hall reading count
+    arg->hall_reading_count++;
+
+    // If not blinking, check if hall reading is out of threshold
+    if (!arg->blink) {
+        if (
+            (hall_reading > (arg->hall_base + APP_HALL_THRESH)) ||
+            (hall_reading < (arg->hall_base - APP_HALL_THRESH))
+        ) {
+            // Post event to start blinking
+            app_post(
+                arg->dispatch              ,
+                APP_EVENT_LEDS_BLINK_START ,
+                NULL                       ,
+                0                          );
+
+            arg->blink = true;
+        }
+    }
 
-            // If blinking, check if hall reading is within threshold
-            if (arg->blink) {
-                if (
-                    (hall_reading < (arg->hall_base + APP_HALL_THRESH)) &&
-                    (hall_reading > (arg->hall_base - APP_HALL_THRESH))
-                ) {
-                    // Post event to stop blinking
-                    esp_event_post_to(
-                        arg->app_leds_event_loop ,
-                        APP_LEDS_EVENTS            ,
-                        APP_LEDS_EVENT_BLINK_STOP  ,
-                        NULL                       ,
-                        0                          ,
-                        0                         );
-                    
-                    // Post event to set meter (value is temp state)
-                    esp_event_post_to(
-                        arg->app_leds_event_loop ,
-                        APP_LEDS_EVENTS            ,
-                        APP_LEDS_EVENT_SET_METER   ,
-                        &(arg->temp_state)         ,
-                        sizeof(arg->temp_state)    ,
-                        0                         );
-
-                    arg->blink = false;
-                }
-            }
-            break;
-
-        case APP_TIMER_EVENT_TEMP_READING: ;
-            // Get temp reading
-            float temp_reading = *((float *) event_data);
-
-            // Update temp reading mean
-            arg->temp_reading_mean = (
-                (arg->temp_reading_mean * arg->temp_reading_count) +
-                temp_reading
-            ) / (arg->temp_reading_count + 1);
-
-            // Update temp reading count
-            arg->temp_reading_count++;
-
-            // Set new temp state
-            int diff = (int) temp_reading - (int) arg->temp_base;
-            arg->temp_state = diff < 0 ? 0 : (uint8_t) diff;
-
-            // If not blinking, post event to set meter (value is temp state)
-            if (!arg->blink) {
-                esp_event_post_to(
-                    arg->app_leds_event_loop ,
-                    APP_LEDS_EVENTS            ,
-                    APP_LEDS_EVENT_SET_METER   ,
-                    &(arg->temp_state)         ,
-                    sizeof(arg->temp_state)    ,
-                    0                         );
-            }
-            break;
+    // If blinking, check if hall reading is within threshold
+    if (arg->blink) {
+        if (
+            (hall_reading < (arg->hall_base + APP_HALL_THRESH)) &&
+            (hall_reading > (arg->hall_base - APP_HALL_THRESH))
+        ) {
+            // Post event to stop blinking
+            app_post(
+                arg->dispatch             ,
+                APP_EVENT_LEDS_BLINK_STOP ,
+                NULL                      ,
+                0                         );
+            
+            // Post event to set meter (value is temp state)
+            app_post(
+                arg->dispatch            ,
+                APP_EVENT_LEDS_SET_METER ,
+                &(arg->temp_state)       ,
+                sizeof(arg->temp_state)  );
+
+            arg->blink = false;
+        }
+    }
+}
 
-        case APP_TIMER_EVENT_LOG_READINGS:
-            // Log hall reading mean
-            if (arg->hall_reading_count > 0) {
-                ESP_LOGI(TAG, "Hall Reading Mean: %d", arg->hall_reading_mean);
-            }
-            else {
-                ESP_LOGI(TAG, "Hall Reading Mean: N/A");
-            }
+void app_on_temp_reading(
+    void       *ctx     ,
+    void const *payload )
+{
+    // Get timer FSM
+    app_timer_fsm_t *arg = ((app_t *) ctx)->fsm;
+
+    // Get temp reading
+    int32_t temp_reading = *((int32_t const *) payload);
+
+    // Update temp reading sum and count
+    arg->temp_reading_sum += temp_reading;
+    arg->temp_reading_count++;
+
+    // Set new temp state
+    int diff = temp_reading / 100 - arg->temp_base / 100;
+    arg->temp_state = diff < 0 ? 0 : (uint8_t) diff;
+
+    // If not blinking, post event to set meter (value is temp state)
+    if (!arg->blink) {
+        app_post(
+            arg->dispatch            ,
+            APP_EVENT_LEDS_SET_METER ,
+            &(arg->temp_state)       ,
+            sizeof(arg->temp_state)  );
+    }
+}
+
+void app_on_log_readings(
+    void       *ctx     ,
+    void const *payload )
+{
+    // Get timer FSM
+    app_timer_fsm_t *arg = ((app_t *) ctx)->fsm;
+
+    // Log hall reading mean
+    if (arg->hall_reading_count > 0) {
+        ESP_LOGI(TAG, "Hall Reading Mean: %d", arg->hall_reading_mean);
+    }
+    else {
+        ESP_LOGI(TAG, "Hall Reading Mean: N/A");
+    }
+
+    // Reset hall reading mean and count
+    arg->hall_reading_mean = 0;
+    arg->hall_reading_count = 0;
+
+    // Log temp reading mean
+    if (arg->temp_reading_count > 0) {
+        ESP_LOGI(TAG, "Temp Reading Mean: %f",
+            arg->temp_reading_sum / 100.0f / arg->temp_reading_count);
+    }
+    else {
+        ESP_LOGI(TAG, "Temp Reading Mean: N/A");
+    }
+
+    // Reset temp reading sum and count
+    arg->temp_reading_sum = 0;
+    arg->temp_reading_count = 0;
+
+#if APP_TIMER_JITTER_PROBE
+    // Log esp_timer task lateness (then reset)
+    if (app_jitter.count > 0) {
+        ESP_LOGI(TAG, "esp_timer Lateness: mean %lld us, max %lld us",
+            app_jitter.total_us / app_jitter.count, app_jitter.max_us);
+    }
+    app_jitter.max_us = 0;
+    app_jitter.total_us = 0;
+    app_jitter.count = 0;
+#endif
+
+    // Log dispatch lane latency and drops (then reset)
+    app_dispatch_handle_t dispatch = ((app_t *) ctx)->dispatch;
+    for (int lane = 0; lane < APP_DISPATCH_LANES; ++lane) {
+        app_dispatch_lane_stats_t stats;
+        if (app_dispatch_get_stats(dispatch, lane, &stats) != ESP_OK) continue;
+        if (stats.dispatched == 0 && stats.dropped == 0) continue;
+        ESP_LOGI(TAG, "Lane %s: mean %llu us, max %u us, %u dropped",
+            lane == APP_DISPATCH_LANE_HIGH ? "HIGH" : "LOW",
+            (unsigned long long) (stats.dispatched ?
+                stats.latency_us / stats.dispatched : 0),
+            (unsigned) stats.latency_max_us, (unsigned) stats.dropped);
+    }
+    app_dispatch_reset_stats(dispatch);
+}
+
+// App LEDs Event Handlers
+void app_on_leds_blink_start(
+    void       *ctx     ,
+    void const *payload )
+{
+    app_leds_start_blink();
+}
+
+void app_on_leds_blink_stop(
+    void       *ctx     ,
+    void const *payload )
+{
+    app_leds_stop_blink();
+}
+
+void app_on_leds_set_meter(
+    void       *ctx     ,
+    void const *payload )
+{
+    app_leds_set_meter(*((uint8_t const *) payload));
+}
+
+// Welford Accumulator (running mean & variance, no per-sample division of
+// the whole sum)
+typedef struct {
+    int   count;
+    float mean;
+    float m2; // Sum of squared differences from the mean
+} app_welford_t;
+
+static void app_welford_add(
+    app_welford_t *w ,
+    float          x )
+{
+    w->count++;
+    float delta = x - w->mean;
+    w->mean += delta / w->count;
+    w->m2   += delta * (x - w->mean);
+}
+
+static float app_welford_stddev(
+    app_welford_t const *w )
+{
+    return w->count > 1 ? sqrtf(w->m2 / (w->count - 1)) : 0.0f;
+}
 
-            // Reset hall reading mean and count
-            arg->hall_reading_mean = 0;
-            arg->hall_reading_count = 0;
+// Trimmed Mean: mean of the samples within APP_CALIB_TRIM_SIGMAS standard
+// deviations of the mean of all of them
+static float app_trimmed_mean(
+    float const *samples  ,
+    int          count    ,
+    int         *out_kept )
+{
+    app_welford_t all = { 0 };
+    for (int i = 0; i < count; i++) app_welford_add(&all, samples[i]);
+
+    float limit = APP_CALIB_TRIM_SIGMAS * app_welford_stddev(&all);
+    app_welford_t kept = { 0 };
+    for (int i = 0; i < count; i++) {
+        if (fabsf(samples[i] - all.mean) <= limit) {
+            app_welford_add(&kept, samples[i]);
+        }
+    }
 
-            // Log temp reading mean
-            if (arg->temp_reading_count > 0) {
-                ESP_LOGI(TAG, "Temp Reading Mean: %f", arg->temp_reading_mean);
+    *out_kept = kept.count;
+    return kept.count ? kept.mean : all.mean;
+}
+
+// Calibration Result (posted with APP_EVENT_CALIB_DONE)
+typedef struct {
+    int     hall_base;
+    int     hall_samples; // kept after trimming
+    int32_t temp_mean;    // centi-degrees
+    int     temp_samples; // kept after trimming
+} app_calib_result_t;
+
+// Calibration Task Args
+typedef struct {
+    app_dispatch_handle_t dispatch; // Gets APP_EVENT_CALIB_DONE
+    si7021_handle_t       si7021;
+} app_calib_args_t;
+
+// Calibration Task
+// Samples Hall every APP_CALIB_PERIOD_MS and temperature every
+// APP_CALIB_TEMP_EVERY periods, for their base timeouts (both at once),
+// then posts the trimmed means and deletes itself.
+void app_calib_task(
+    void *arg
+) {
+    app_calib_args_t *calib = (app_calib_args_t *) arg;
+
+    // (static: too big for the task stack, and there is one calibration)
+    static float hall_samples[APP_CALIB_MAX_SAMPLES];
+    static float temp_samples[APP_CALIB_MAX_SAMPLES];
+    int hall_count = 0;
+    int temp_count = 0;
+
+    TickType_t period = APP_CALIB_PERIOD_MS / portTICK_PERIOD_MS;
+    if (period == 0) period = 1;
+    TickType_t hall_timeout = APP_HALL_BASE_TIMEOUT_MS / portTICK_PERIOD_MS;
+    TickType_t temp_timeout = APP_TEMP_BASE_TIMEOUT_MS / portTICK_PERIOD_MS;
+
+    TickType_t ticks_start = xTaskGetTickCount();
+    TickType_t wake = ticks_start;
+    bool hall_done = false;
+    bool temp_done = false;
+    for (int n = 0; !hall_done || !temp_done; n++) {
+        TickType_t elapsed = xTaskGetTickCount() - ticks_start;
+
+        // Hall
+        hall_done = hall_done || hall_count == APP_CALIB_MAX_SAMPLES ||
+            (hall_count > 0 && elapsed >= hall_timeout);
+        if (!hall_done) {
+            hall_samples[hall_count++] = hall_sensor_get_reading();
+        }
+
+        // Temp
+        temp_done = temp_done || temp_count == APP_CALIB_MAX_SAMPLES ||
+            (temp_count > 0 && elapsed >= temp_timeout);
+        if (!temp_done && n % APP_CALIB_TEMP_EVERY == 0) {
+            int32_t temp_reading;
+            if (si7021_measure_temp_centi(calib->si7021, &temp_reading) == ESP_OK) {
+                temp_samples[temp_count++] = temp_reading;
             }
-            else {
-                ESP_LOGI(TAG, "Temp Reading Mean: N/A");
+            else if (elapsed >= temp_timeout) {
+                // No reading in time: give up with what there is
+                temp_done = true;
             }
+        }
 
-            // Reset temp reading mean and count
-            arg->temp_reading_mean = 0;
-            arg->temp_reading_count = 0;
-            break;
-        default:
-            ESP_LOGW(TAG, "Unhandled event ID: %d", id);
-            break;
+        if (!hall_done || !temp_done) vTaskDelayUntil(&wake, period);
     }
+
+    // Trimmed means
+    app_calib_result_t result = { 0 };
+    result.hall_base = (int) lroundf(
+        app_trimmed_mean(hall_samples, hall_count, &result.hall_samples));
+    result.temp_mean = (int32_t) lroundf(
+        app_trimmed_mean(temp_samples, temp_count, &result.temp_samples));
+
+    ESP_LOGI(TAG, "Calibration done in %d ms",
+        (int) ((xTaskGetTickCount() - ticks_start) * portTICK_PERIOD_MS));
+    app_dispatch_post(
+        calib->dispatch      ,
+        APP_EVENT_CALIB_DONE ,
+        &result              ,
+        sizeof(result)       ,
+        portMAX_DELAY       );
+
+    vTaskDelete(NULL);
 }
 
-// App LEDs Event Handler
-void app_leds_event_handler(
-    void *handler_arg   ,
-    esp_event_base_t base,
-    int32_t id         ,
-    void *event_data   )
+// App Calibration Event Handler (starts the app)
+void app_on_calib_done(
+    void       *ctx     ,
+    void const *payload )
 {
-    switch(id) {
-        case APP_LEDS_EVENT_BLINK_START:
-            app_leds_start_blink();
-            break;
-        case APP_LEDS_EVENT_BLINK_STOP:
-            app_leds_stop_blink();
-            break;
-        case APP_LEDS_EVENT_SET_METER:
-            app_leds_set_meter(*((uint8_t *) event_data));
-            break;
-        default:
-            ESP_LOGW(TAG, "Unhandled event ID: %d", id);
-            break;
+    app_t *start = (app_t *) ctx;
+    app_calib_result_t const *result = (app_calib_result_t const *) payload;
+
+    if (result->temp_samples == 0) {
+        ESP_LOGE(TAG, "No temperature readings for the baseline");
+        return;
+    }
+
+    // Baselines
+    ESP_LOGI(TAG, "Hall Base: %d (%d samples)",
+        result->hall_base, result->hall_samples);
+    ESP_LOGI(TAG, "Current Temp: %f (%d samples)",
+        result->temp_mean / 100.0f, result->temp_samples);
+    start->fsm->hall_base = result->hall_base;
+    start->fsm->temp_base = (result->temp_mean / 100 - 1) * 100;
+    ESP_LOGI(TAG, "Temp Base: %f", start->fsm->temp_base / 100.0f);
+
+    // Post event with current temp state
+    app_post(
+        start->dispatch                ,
+        APP_EVENT_LEDS_SET_METER       ,
+        &(start->fsm->temp_state)      ,
+        sizeof(start->fsm->temp_state) );
+
+    // Create Si7021 Heater Controller (condensation recovery, on its timer)
+    si7021_heater_ctrl_create_args_t heater_ctrl_args =
+        SI7021_HEATER_CTRL_DEFAULT_CREATE_ARGS();
+    heater_ctrl_args.si7021 = start->si7021;
+
+    if (si7021_heater_ctrl_create(
+        &heater_ctrl_args, &start->timer_data->heater_ctrl) != ESP_OK) {
+        ESP_LOGE(TAG, "Si7021 heater controller creation failed");
+        return;
+    }
+
+    // Start App Timer
+    if (esp_timer_start_periodic(start->timer, APP_TIMER_PERIOD_MS * 1000) != ESP_OK) {
+        ESP_LOGE(TAG, "App Timer start failed");
+        return;
     }
 }
 
+// App Dispatch Table (LED events jump ahead of readings & logs)
+static const app_dispatch_entry_t app_dispatch_table[APP_EVENT_COUNT] = {
+    [APP_EVENT_HALL_READING]     = { app_on_hall_reading     , APP_DISPATCH_LANE_LOW  },
+    [APP_EVENT_TEMP_READING]     = { app_on_temp_reading     , APP_DISPATCH_LANE_LOW  },
+    [APP_EVENT_LOG_READINGS]     = { app_on_log_readings     , APP_DISPATCH_LANE_LOW  },
+    [APP_EVENT_CALIB_DONE]       = { app_on_calib_done       , APP_DISPATCH_LANE_LOW  },
+    [APP_EVENT_LEDS_BLINK_START] = { app_on_leds_blink_start , APP_DISPATCH_LANE_HIGH },
+    [APP_EVENT_LEDS_BLINK_STOP]  = { app_on_leds_blink_stop  , APP_DISPATCH_LANE_HIGH },
+    [APP_EVENT_LEDS_SET_METER]   = { app_on_leds_set_meter   , APP_DISPATCH_LANE_HIGH },
+};
 
 void app_main(void)
 {
@@ -319,25 +616,32 @@ void app_main(void)
         return;
     }
 
-    // Create App Timer Event Loop
-    esp_event_loop_args_t app_timer_event_loop_args = {
-        .queue_size = 10,
-        .task_name = "App Timer Event Loop Task",
+    // Create App Dispatch (one task for every event handler)
+    app_t app = { 0 }; // Handler context, filled below before any event
+    app_dispatch_create_args_t app_dispatch_args = {
+        .table = app_dispatch_table,
+        .table_len = APP_EVENT_COUNT,
+        .ctx = &app,
+        .queue_size = {
+            [APP_DISPATCH_LANE_HIGH] = 10,
+            [APP_DISPATCH_LANE_LOW] = 10,
+        },
+        .task_name = "App Dispatch Task",
         .task_priority = 1,
-        .task_stack_size = 2048,
-        .task_core_id = tskNO_AFFINITY,
+        .task_stack_size = 3072,
     };
 
-    esp_event_loop_handle_t app_timer_event_loop;
-    if (esp_event_loop_create(&app_timer_event_loop_args, &app_timer_event_loop) != ESP_OK) {
-        ESP_LOGE(TAG, "App Timer Event Loop creation failed");
+    app_dispatch_handle_t app_dispatch;
+    if (app_dispatch_create(&app_dispatch_args, &app_dispatch) != ESP_OK) {
+        ESP_LOGE(TAG, "App Dispatch creation failed");
         return;
     }
 
-    // Make App Timer Data
+    // Make App Timer Data (heater controller set after the calibration)
     app_timer_data_t app_timer_data = {
-        .app_timer_event_loop = app_timer_event_loop,
-        .si7021 = si7021,
+        .dispatch = app_dispatch,
+        .heater_ctrl = NULL,
+        .sensor_task = NULL,
         .read_hall = 0,
         .read_temp = 0,
         .log_readings = 0,
@@ -357,148 +661,77 @@ void app_main(void)
         return;
     }
 
-    // Create App LEDs Event Loop
-    esp_event_loop_args_t app_leds_event_loop_args = {
-        .queue_size = 10,
-        .task_name = "App LEDs Event Loop Task",
-        .task_priority = 1,
-        .task_stack_size = 2048,
-        .task_core_id = tskNO_AFFINITY,
-    };
-
-    esp_event_loop_handle_t app_leds_event_loop;
-    if (esp_event_loop_create(&app_leds_event_loop_args, &app_leds_event_loop) != ESP_OK) {
-        ESP_LOGE(TAG, "App LEDs Event Loop creation failed");
+    // Create Sensor Task (waits for App Timer ticks)
+    if (xTaskCreate(
+        app_sensor_task,
+        "App Sensor Task",
+        3072,
+        &app_timer_data,
+        APP_SENSOR_TASK_PRIORITY,
+        &app_timer_data.sensor_task
+    ) != pdPASS) {
+        ESP_LOGE(TAG, "App Sensor Task creation failed");
         return;
     }
 
-    // Take Hall Base
-    TickType_t hall_base_timeout = APP_HALL_BASE_TIMEOUT_MS / portTICK_PERIOD_MS;
-    TickType_t ticks_start = xTaskGetTickCount();
-    int hall_base = hall_sensor_get_reading();
-    int hall_count = 1;
-    while (xTaskGetTickCount() - ticks_start < hall_base_timeout) {
-        // Do Mean
-        hall_base = (
-            (hall_base * hall_count) +
-            hall_sensor_get_reading()
-        ) / (hall_count + 1);
-        hall_count++;
-    }
-    ESP_LOGI(TAG, "Hall Base: %d (%d samples)", hall_base, hall_count);
+#if APP_TIMER_JITTER_PROBE
+    // Create & Start Jitter Probe
+    esp_timer_create_args_t jitter_probe_args = {
+        .callback = app_jitter_probe_callback,
+        .arg = NULL,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "App Jitter Probe",
+    };
 
-    // Take Temp Base
-    TickType_t temp_base_timeout = APP_TEMP_BASE_TIMEOUT_MS / portTICK_PERIOD_MS;
-    ticks_start = xTaskGetTickCount();
-    float temp_base = 0;
-    int temp_count = 0;
-    while (xTaskGetTickCount() - ticks_start < temp_base_timeout) {
-        float temp_reading = 0;
-        si7021_measure_temp(si7021, &temp_reading);
-        // Do Mean
-        temp_base = (
-            (temp_base * temp_count) +
-            temp_reading
-        ) / (temp_count + 1);
-        temp_count++;
+    esp_timer_handle_t jitter_probe;
+    app_jitter.next_us = esp_timer_get_time() + APP_TIMER_JITTER_PROBE_PERIOD_MS * 1000;
+    if (
+        esp_timer_create(&jitter_probe_args, &jitter_probe) != ESP_OK ||
+        esp_timer_start_periodic(jitter_probe, APP_TIMER_JITTER_PROBE_PERIOD_MS * 1000) != ESP_OK
+    ) {
+        ESP_LOGE(TAG, "App Jitter Probe start failed");
+        return;
     }
-    ESP_LOGI(TAG, "Current Temp: %f (%d samples)", temp_base, temp_count);
-    temp_base = (float)((uint8_t) temp_base - 1);
-    ESP_LOGI(TAG, "Temp Base: %f", temp_base);
+#endif
 
-    // Make App Timer FSM
+    // Make App Timer FSM (baselines set by the calibration)
     app_timer_fsm_t app_timer_fsm = {
-        .app_leds_event_loop = app_leds_event_loop,
-        .hall_base = hall_base,
+        .dispatch = app_dispatch,
+        .hall_base = 0,
         .hall_reading_mean = 0,
         .hall_reading_count = 0,
-        .temp_base = temp_base,
-        .temp_reading_mean = 0,
+        .temp_base = 0,
+        .temp_reading_sum = 0,
         .temp_reading_count = 0,
         .blink = false,
         .temp_state = 1, // current temp is 1 LED
     };
 
-    // Register App Timer Event Handler
-    if (esp_event_handler_register_with(
-        app_timer_event_loop,
-        APP_TIMER_EVENTS,
-        ESP_EVENT_ANY_ID,
-        app_timer_event_handler,
-        &app_timer_fsm
-    ) != ESP_OK) {
-        ESP_LOGE(TAG, "App Timer Event Handler registration failed");
-        return;
-    }
-
+    // Fill App Context (read by the handlers)
+    app.dispatch = app_dispatch;
+    app.fsm = &app_timer_fsm;
+    app.timer_data = &app_timer_data;
+    app.timer = app_timer;
+    app.si7021 = si7021;
 
+    // Start Calibration Task (Hall & Temp baselines)
+    app_calib_args_t app_calib_args = {
+        .dispatch = app_dispatch,
+        .si7021 = si7021,
+    };
 
-    // Register App LEDs Event Handler
-    if (esp_event_handler_register_with(
-        app_leds_event_loop,
-        APP_LEDS_EVENTS,
-        ESP_EVENT_ANY_ID,
-        app_leds_event_handler,
+    if (xTaskCreate(
+        app_calib_task,
+        "App Calibration Task",
+        3072,
+        &app_calib_args,
+        1,
         NULL
-    ) != ESP_OK) {
-        ESP_LOGE(TAG, "App LEDs Event Handler registration failed");
-        return;
-    }
-
-    // Post event with current temp state
-    esp_event_post_to(
-        app_leds_event_loop              ,
-        APP_LEDS_EVENTS                  ,
-        APP_LEDS_EVENT_SET_METER         ,
-        &(app_timer_fsm.temp_state)      ,
-        sizeof(app_timer_fsm.temp_state) ,
-        0                               );
-
-    // Start App Timer
-    if (esp_timer_start_periodic(app_timer, APP_TIMER_PERIOD_MS * 1000) != ESP_OK) {
-        ESP_LOGE(TAG, "App Timer start failed");
+    ) != pdPASS) {
+        ESP_LOGE(TAG, "App Calibration Task creation failed");
         return;
     }
 
-    // Wait 5 seconds
-    vTaskDelay(5000 / portTICK_PERIOD_MS);
-
-    esp_err_t err;
-    // Set Heater Level to 1st level
-    if ( (err = si7021_set_heater_level(si7021, SI7021_HEATER_LEVEL_3_09_MA)) ) {
-        ESP_LOGE(TAG, "Si7021 set heater level failed");
-        return;
-    }
-
-    // Set Heater ON
-    if ( (err = si7021_set_heater_state(si7021, SI7021_HEATER_STATE_ENABLE)) ) {
-        ESP_LOGE(TAG, "Si7021 set heater state failed");
-        return;
-    }
-    ESP_LOGI(TAG, "Heater ON");
-
-    // Wait 20 seconds
-    vTaskDelay(20000 / portTICK_PERIOD_MS);
-
-    // Set Heater Level to max level
-    if ( (err = si7021_set_heater_level(si7021, SI7021_HEATER_LEVEL_94_20_MA)) ) {
-        ESP_LOGE(TAG, "Si7021 set heater level failed");
-        return;
-    }
-    ESP_LOGI(TAG, "Heater Level: %d", SI7021_HEATER_LEVEL_94_20_MA);
-
-    // Wait 20 seconds
-    vTaskDelay(20000 / portTICK_PERIOD_MS);
-
-    // Set Heater Level to 1st level
-    if ( (err = si7021_set_heater_level(si7021, SI7021_HEATER_LEVEL_3_09_MA)) ) {
-        ESP_LOGE(TAG, "Si7021 set heater level failed");
-        return;
-    }
-    ESP_LOGI(TAG, "Heater Level: %d", SI7021_HEATER_LEVEL_3_09_MA);
-
-
-
     // Delay forever to conserve memory
     while (1) {
         vTaskDelay(portMAX_DELAY);
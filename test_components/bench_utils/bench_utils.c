@@ -0,0 +1,24 @@
+#include "bench_utils.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdio.h>
+#include <inttypes.h>
+
+// STRUCTURES ------------------------------------------------------------------
+
+static volatile uint32_t _sink;
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+void bench_report(const char *name, uint32_t iterations, int64_t elapsed_us)
+{
+    double ns = iterations ? (double)elapsed_us * 1000.0 / iterations : 0.0;
+    printf("BENCH %s: %" PRIu32 " it, %" PRId64 " us, %.1f ns/it\n",
+           name, iterations, elapsed_us, ns);
+}
+
+void bench_sink(uint32_t value)
+{
+    _sink ^= value;
+}
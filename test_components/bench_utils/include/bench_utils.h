@@ -0,0 +1,36 @@
+#ifndef __BENCH_UTILS_H__
+#define __BENCH_UTILS_H__
+
+// Timing helpers for the [bench] cases run by bench_app. Results are printed
+// one per line as "BENCH <name>: <iterations> it, <total> us, <ns> ns/it"
+// so runs can be diffed or grepped.
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>
+
+#include "esp_timer.h"
+
+// MACROS ----------------------------------------------------------------------
+
+/* Tag every benchmark case carries; test_app skips it, bench_app runs only it */
+#define BENCH_TAG "[bench]"
+
+/* Runs body iterations times and reports the per-iteration time */
+#define BENCH_RUN(name, iterations, body)                                      \
+    do {                                                                       \
+        uint32_t _bench_n = (iterations);                                      \
+        int64_t _bench_start = esp_timer_get_time();                           \
+        for (uint32_t _bench_i = 0; _bench_i < _bench_n; _bench_i++) { body; } \
+        bench_report((name), _bench_n, esp_timer_get_time() - _bench_start);   \
+    } while (0)
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+/* Prints one result line */
+void bench_report(const char *name, uint32_t iterations, int64_t elapsed_us);
+
+/* Keeps a computed value alive so the optimizer cannot drop the loop body */
+void bench_sink(uint32_t value);
+
+#endif // __BENCH_UTILS_H__
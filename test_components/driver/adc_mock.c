@@ -0,0 +1,91 @@
+#include "adc_mock.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+
+// STRUCTURES ------------------------------------------------------------------
+
+static portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+
+static int _adc1_raw[ADC1_CHANNEL_MAX];
+static int _adc2_raw[ADC2_CHANNEL_MAX];
+static uint32_t _reads;
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+//// Mock control ---------------------------------------------------------------
+
+void adc_mock_set_raw(adc_unit_t unit, int channel, int raw)
+{
+    portENTER_CRITICAL(&_lock);
+    if (unit == ADC_UNIT_1 && channel >= 0 && channel < ADC1_CHANNEL_MAX)
+        _adc1_raw[channel] = raw;
+    else if (unit == ADC_UNIT_2 && channel >= 0 && channel < ADC2_CHANNEL_MAX)
+        _adc2_raw[channel] = raw;
+    portEXIT_CRITICAL(&_lock);
+}
+
+uint32_t adc_mock_get_reads(void)
+{
+    portENTER_CRITICAL(&_lock);
+    uint32_t reads = _reads;
+    portEXIT_CRITICAL(&_lock);
+    return reads;
+}
+
+void adc_mock_reset(void)
+{
+    portENTER_CRITICAL(&_lock);
+    memset(_adc1_raw, 0, sizeof(_adc1_raw));
+    memset(_adc2_raw, 0, sizeof(_adc2_raw));
+    _reads = 0;
+    portEXIT_CRITICAL(&_lock);
+}
+
+//// driver/adc.h ---------------------------------------------------------------
+
+esp_err_t adc1_config_width(adc_bits_width_t width_bit)
+{
+    return (width_bit < ADC_WIDTH_MAX) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t adc1_config_channel_atten(adc1_channel_t channel, adc_atten_t atten)
+{
+    return (channel < ADC1_CHANNEL_MAX && atten < ADC_ATTEN_MAX)
+        ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+int adc1_get_raw(adc1_channel_t channel)
+{
+    if (channel >= ADC1_CHANNEL_MAX) return -1;
+
+    portENTER_CRITICAL(&_lock);
+    int raw = _adc1_raw[channel];
+    _reads++;
+    portEXIT_CRITICAL(&_lock);
+    return raw;
+}
+
+esp_err_t adc2_config_channel_atten(adc2_channel_t channel, adc_atten_t atten)
+{
+    return (channel < ADC2_CHANNEL_MAX && atten < ADC_ATTEN_MAX)
+        ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t adc2_get_raw(adc2_channel_t channel, adc_bits_width_t width_bit,
+                       int *raw_out)
+{
+    if (channel >= ADC2_CHANNEL_MAX || width_bit >= ADC_WIDTH_MAX)
+        return ESP_ERR_INVALID_ARG;
+
+    portENTER_CRITICAL(&_lock);
+    int raw = _adc2_raw[channel];
+    _reads++;
+    portEXIT_CRITICAL(&_lock);
+    if (raw < 0) return ESP_ERR_TIMEOUT;
+    *raw_out = raw;
+    return ESP_OK;
+}
@@ -0,0 +1,188 @@
+#include "gpio_mock.h"
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <string.h>
+#include <stdbool.h>
+
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "soc/gpio_struct.h"
+
+// STRUCTURES ------------------------------------------------------------------
+
+static portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+
+static gpio_mode_t     _mode[GPIO_NUM_MAX];
+static gpio_int_type_t _intr_type[GPIO_NUM_MAX];
+static uint32_t        _level[GPIO_NUM_MAX];
+static uint32_t        _toggles[GPIO_NUM_MAX];
+static uint32_t        _set_level_delay_us;
+
+static bool       _isr_service;
+static gpio_isr_t _isr_handler[GPIO_NUM_MAX];
+static void      *_isr_args[GPIO_NUM_MAX];
+
+/* ISR stand-in for the SoC GPIO registers (hal/gpio_ll.h) */
+gpio_dev_t GPIO;
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+//// Mock control ---------------------------------------------------------------
+
+uint32_t gpio_mock_get_toggles(gpio_num_t gpio)
+{
+    if (!GPIO_IS_VALID_GPIO(gpio)) return 0;
+
+    portENTER_CRITICAL(&_lock);
+    uint32_t toggles = _toggles[gpio];
+    portEXIT_CRITICAL(&_lock);
+    return toggles;
+}
+
+void gpio_mock_set_input(gpio_num_t gpio, uint32_t level)
+{
+    if (!GPIO_IS_VALID_GPIO(gpio)) return;
+
+    portENTER_CRITICAL(&_lock);
+    level = level ? 1 : 0;
+    gpio_int_type_t intr_type = _intr_type[gpio];
+    bool fire = _isr_service && _isr_handler[gpio] && _level[gpio] != level &&
+        (intr_type == GPIO_INTR_ANYEDGE ||
+         (intr_type == GPIO_INTR_POSEDGE &&  level) ||
+         (intr_type == GPIO_INTR_NEGEDGE && !level));
+    if (_level[gpio] != level) _toggles[gpio]++;
+    _level[gpio] = level;
+    gpio_isr_t handler = _isr_handler[gpio];
+    void      *args    = _isr_args[gpio];
+    portEXIT_CRITICAL(&_lock);
+
+    if (fire) handler(args);
+}
+
+void gpio_mock_set_level_delay(uint32_t us)
+{
+    portENTER_CRITICAL(&_lock);
+    _set_level_delay_us = us;
+    portEXIT_CRITICAL(&_lock);
+}
+
+void gpio_mock_reset(void)
+{
+    portENTER_CRITICAL(&_lock);
+    _set_level_delay_us = 0;
+    memset(_mode, 0, sizeof(_mode));
+    memset(_intr_type, 0, sizeof(_intr_type));
+    memset(_level, 0, sizeof(_level));
+    memset(_toggles, 0, sizeof(_toggles));
+    memset(_isr_handler, 0, sizeof(_isr_handler));
+    memset(_isr_args, 0, sizeof(_isr_args));
+    _isr_service = false;
+    portEXIT_CRITICAL(&_lock);
+}
+
+//// driver/gpio.h --------------------------------------------------------------
+
+esp_err_t gpio_config(const gpio_config_t *config)
+{
+    if (!config || config->pin_bit_mask >> GPIO_NUM_MAX)
+        return ESP_ERR_INVALID_ARG;
+
+    portENTER_CRITICAL(&_lock);
+    for (int gpio = 0; gpio < GPIO_NUM_MAX; gpio++)
+        if (config->pin_bit_mask & (1ULL << gpio)) {
+            _mode[gpio]      = config->mode;
+            _intr_type[gpio] = config->intr_type;
+        }
+    portEXIT_CRITICAL(&_lock);
+    return ESP_OK;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio)
+{
+    if (!GPIO_IS_VALID_GPIO(gpio)) return ESP_ERR_INVALID_ARG;
+
+    portENTER_CRITICAL(&_lock);
+    _mode[gpio]      = GPIO_MODE_DISABLE;
+    _intr_type[gpio] = GPIO_INTR_DISABLE;
+    portEXIT_CRITICAL(&_lock);
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio, uint32_t level)
+{
+    if (!GPIO_IS_VALID_OUTPUT_GPIO(gpio)) return ESP_ERR_INVALID_ARG;
+
+    portENTER_CRITICAL(&_lock);
+    level = level ? 1 : 0;
+    if (_level[gpio] != level) _toggles[gpio]++;
+    _level[gpio] = level;
+    int64_t end = esp_timer_get_time() + _set_level_delay_us;
+    portEXIT_CRITICAL(&_lock);
+
+    while (esp_timer_get_time() < end) { }
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio)
+{
+    if (!GPIO_IS_VALID_GPIO(gpio)) return 0;
+
+    portENTER_CRITICAL(&_lock);
+    int level = (int) _level[gpio];
+    portEXIT_CRITICAL(&_lock);
+    return level;
+}
+
+esp_err_t gpio_set_pull_mode(gpio_num_t gpio, gpio_pull_mode_t pull)
+{
+    if (!GPIO_IS_VALID_GPIO(gpio) || pull > GPIO_FLOATING)
+        return ESP_ERR_INVALID_ARG;
+    return ESP_OK;
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags)
+{
+    (void) intr_alloc_flags;
+
+    portENTER_CRITICAL(&_lock);
+    esp_err_t err = _isr_service ? ESP_ERR_INVALID_STATE : ESP_OK;
+    _isr_service = true;
+    portEXIT_CRITICAL(&_lock);
+    return err;
+}
+
+void gpio_uninstall_isr_service(void)
+{
+    portENTER_CRITICAL(&_lock);
+    _isr_service = false;
+    memset(_isr_handler, 0, sizeof(_isr_handler));
+    memset(_isr_args, 0, sizeof(_isr_args));
+    portEXIT_CRITICAL(&_lock);
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio, gpio_isr_t isr_handler, void *args)
+{
+    if (!GPIO_IS_VALID_GPIO(gpio)) return ESP_ERR_INVALID_ARG;
+
+    portENTER_CRITICAL(&_lock);
+    esp_err_t err = _isr_service ? ESP_OK : ESP_ERR_INVALID_STATE;
+    if (!err) {
+        _isr_handler[gpio] = isr_handler;
+        _isr_args[gpio]    = args;
+    }
+    portEXIT_CRITICAL(&_lock);
+    return err;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t gpio)
+{
+    if (!GPIO_IS_VALID_GPIO(gpio)) return ESP_ERR_INVALID_ARG;
+
+    portENTER_CRITICAL(&_lock);
+    esp_err_t err = _isr_service ? ESP_OK : ESP_ERR_INVALID_STATE;
+    _isr_handler[gpio] = NULL;
+    _isr_args[gpio]    = NULL;
+    portEXIT_CRITICAL(&_lock);
+    return err;
+}
@@ -0,0 +1,23 @@
+#ifndef __ADC_MOCK_H__
+#define __ADC_MOCK_H__
+
+// Programs the values returned by the host ADC stand-in
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>
+
+#include "driver/adc.h"
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+/* Sets the raw code every following read of the channel returns (-1 fails) */
+void adc_mock_set_raw(adc_unit_t unit, int channel, int raw);
+
+/* Number of raw reads served since the last adc_mock_reset() */
+uint32_t adc_mock_get_reads(void);
+
+/* Clears programmed codes (all read 0) and the read count */
+void adc_mock_reset(void);
+
+#endif // __ADC_MOCK_H__
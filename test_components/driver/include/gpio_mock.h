@@ -0,0 +1,30 @@
+#ifndef __GPIO_MOCK_H__
+#define __GPIO_MOCK_H__
+
+// Reads back what was driven on the host GPIO stand-in, and drives its inputs
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>
+
+#include "driver/gpio.h"
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+/* Level changes driven on <gpio> since the last gpio_mock_reset() */
+uint32_t gpio_mock_get_toggles(gpio_num_t gpio);
+
+/* Drives input <gpio> to <level>. A level change matching the interrupt type
+ * of <gpio> calls its ISR handler, in the caller's context.
+ */
+void gpio_mock_set_input(gpio_num_t gpio, uint32_t level);
+
+/* Busy waits <us> in every gpio_set_level, to widen races with the caller */
+void gpio_mock_set_level_delay(uint32_t us);
+
+/* Clears levels (all 0), modes, toggle counts, the set level delay, the ISR
+ * handlers and the ISR service
+ */
+void gpio_mock_reset(void);
+
+#endif // __GPIO_MOCK_H__
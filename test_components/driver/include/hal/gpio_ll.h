@@ -0,0 +1,22 @@
+#ifndef __MOCK_HAL_GPIO_LL_H__
+#define __MOCK_HAL_GPIO_LL_H__
+
+// Host stand-in for hal/gpio_ll.h: the input level, as driven through
+// gpio_mock.h
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>
+
+#include "driver/gpio.h"
+#include "soc/gpio_struct.h"
+
+// FUNCTIONS -------------------------------------------------------------------
+
+static inline int gpio_ll_get_level(gpio_dev_t *hw, uint32_t gpio_num)
+{
+    (void) hw;
+    return gpio_get_level((gpio_num_t) gpio_num);
+}
+
+#endif // __MOCK_HAL_GPIO_LL_H__
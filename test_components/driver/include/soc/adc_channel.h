@@ -0,0 +1,26 @@
+#ifndef __MOCK_SOC_ADC_CHANNEL_H__
+#define __MOCK_SOC_ADC_CHANNEL_H__
+
+// Host stand-in for soc/adc_channel.h (ESP32 GPIO to ADC channel map)
+
+#define ADC1_GPIO36_CHANNEL ADC1_CHANNEL_0
+#define ADC1_GPIO37_CHANNEL ADC1_CHANNEL_1
+#define ADC1_GPIO38_CHANNEL ADC1_CHANNEL_2
+#define ADC1_GPIO39_CHANNEL ADC1_CHANNEL_3
+#define ADC1_GPIO32_CHANNEL ADC1_CHANNEL_4
+#define ADC1_GPIO33_CHANNEL ADC1_CHANNEL_5
+#define ADC1_GPIO34_CHANNEL ADC1_CHANNEL_6
+#define ADC1_GPIO35_CHANNEL ADC1_CHANNEL_7
+
+#define ADC2_GPIO4_CHANNEL  ADC2_CHANNEL_0
+#define ADC2_GPIO0_CHANNEL  ADC2_CHANNEL_1
+#define ADC2_GPIO2_CHANNEL  ADC2_CHANNEL_2
+#define ADC2_GPIO15_CHANNEL ADC2_CHANNEL_3
+#define ADC2_GPIO13_CHANNEL ADC2_CHANNEL_4
+#define ADC2_GPIO12_CHANNEL ADC2_CHANNEL_5
+#define ADC2_GPIO14_CHANNEL ADC2_CHANNEL_6
+#define ADC2_GPIO27_CHANNEL ADC2_CHANNEL_7
+#define ADC2_GPIO25_CHANNEL ADC2_CHANNEL_8
+#define ADC2_GPIO26_CHANNEL ADC2_CHANNEL_9
+
+#endif // __MOCK_SOC_ADC_CHANNEL_H__
@@ -0,0 +1,12 @@
+#ifndef __MOCK_SOC_GPIO_STRUCT_H__
+#define __MOCK_SOC_GPIO_STRUCT_H__
+
+// Host stand-in for soc/gpio_struct.h (GPIO register block, no registers)
+
+typedef struct {
+    int unused;
+} gpio_dev_t;
+
+extern gpio_dev_t GPIO;
+
+#endif // __MOCK_SOC_GPIO_STRUCT_H__
@@ -0,0 +1,32 @@
+#include "esp_adc_cal.h"
+
+// STRUCTURES ------------------------------------------------------------------
+
+/* Nominal full-scale input (mV) per attenuation */
+static const uint32_t _full_scale_mv[ADC_ATTEN_MAX] = { 950, 1250, 1750, 3100 };
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+esp_adc_cal_value_t esp_adc_cal_characterize(adc_unit_t adc_num,
+                                             adc_atten_t atten,
+                                             adc_bits_width_t bit_width,
+                                             uint32_t default_vref,
+                                             esp_adc_cal_characteristics_t *chars)
+{
+    chars->unit = adc_num;
+    chars->atten = atten;
+    chars->bit_width = bit_width;
+    chars->vref = default_vref;
+    chars->full_scale_mv = _full_scale_mv[atten < ADC_ATTEN_MAX ? atten : ADC_ATTEN_DB_11];
+    chars->max_code = (1u << (9 + (bit_width < ADC_WIDTH_MAX ? bit_width : ADC_WIDTH_BIT_12))) - 1;
+
+    // Same code a board with eFuse Vref reports
+    return ESP_ADC_CAL_VAL_EFUSE_VREF;
+}
+
+uint32_t esp_adc_cal_raw_to_voltage(uint32_t adc_reading,
+                                    const esp_adc_cal_characteristics_t *chars)
+{
+    if (adc_reading > chars->max_code) adc_reading = chars->max_code;
+    return (adc_reading * chars->full_scale_mv + chars->max_code / 2) / chars->max_code;
+}
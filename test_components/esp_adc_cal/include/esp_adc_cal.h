@@ -0,0 +1,41 @@
+#ifndef __MOCK_ESP_ADC_CAL_H__
+#define __MOCK_ESP_ADC_CAL_H__
+
+// Host stand-in for esp_adc_cal.h: an ideal linear characteristic with the
+// nominal full-scale voltage of each attenuation
+
+// INCLUDES --------------------------------------------------------------------
+
+#include <stdint.h>
+
+#include "driver/adc.h"
+
+// STRUCTURES ------------------------------------------------------------------
+
+typedef enum {
+    ESP_ADC_CAL_VAL_EFUSE_VREF = 0,
+    ESP_ADC_CAL_VAL_EFUSE_TP = 1,
+    ESP_ADC_CAL_VAL_DEFAULT_VREF = 2,
+} esp_adc_cal_value_t;
+
+typedef struct {
+    adc_unit_t unit;
+    adc_atten_t atten;
+    adc_bits_width_t bit_width;
+    uint32_t vref;
+    uint32_t full_scale_mv;
+    uint32_t max_code;
+} esp_adc_cal_characteristics_t;
+
+// PUBLIC FUNCTIONS ------------------------------------------------------------
+
+esp_adc_cal_value_t esp_adc_cal_characterize(adc_unit_t adc_num,
+                                             adc_atten_t atten,
+                                             adc_bits_width_t bit_width,
+                                             uint32_t default_vref,
+                                             esp_adc_cal_characteristics_t *chars);
+
+uint32_t esp_adc_cal_raw_to_voltage(uint32_t adc_reading,
+                                    const esp_adc_cal_characteristics_t *chars);
+
+#endif // __MOCK_ESP_ADC_CAL_H__